@@ -181,6 +181,10 @@ void OpcUaMachineBackend::machineDesignationRead(QOpcUa::NodeAttributes attr)
 
 void OpcUaMachineBackend::setpointWritten(QOpcUa::NodeAttribute attr, QOpcUa::UaStatusCode status)
 {
+    // Setpoints replaced by a newer value from the slider are not sent
+    if (status == QOpcUa::UaStatusCode::GoodEntryReplaced)
+        return;
+
     if (attr == QOpcUa::NodeAttribute::Value && status == QOpcUa::UaStatusCode::Good)
         setMessage("Setpoint successfully set");
     else if (attr == QOpcUa::NodeAttribute::Value && status != QOpcUa::UaStatusCode::Good)
@@ -324,8 +328,13 @@ void OpcUaMachineBackend::connectToEndpoint(const QString &url, qint32 index)
 
     if (!m_client || (m_client && m_client->backend() != m_backends.at(index))) {
         m_client.reset(provider.createClient(m_backends.at(index)));
-        if (m_client)
+        if (m_client) {
             QObject::connect(m_client.data(), &QOpcUaClient::stateChanged, this, &OpcUaMachineBackend::clientStateHandler);
+            // Update the bindings at most once per frame
+            m_client->setDispatchInterval(16);
+            // Only send the newest setpoint while the slider is moved
+            m_client->setWriteCoalescingInterval(50);
+        }
     }
 
     if (!m_client) {
@@ -11,20 +11,48 @@ SOURCES += \
     client/qopcuatype.cpp \
     client/qopcuaclientimpl.cpp \
     client/qopcuanodeimpl.cpp \
+    client/qopcuanodeid.cpp \
     client/qopcuaclientprivate.cpp \
     client/qopcuabackend.cpp \
     client/qopcuamonitoringparameters.cpp \
     client/qopcuareferencedescription.cpp \
-    client/qopcuabinarydataencoding.cpp
+    client/qopcuabinarydataencoding.cpp \
+    client/qopcuareaditem.cpp \
+    client/qopcuawriteitem.cpp \
+    client/qopcuaaddressspacecache.cpp \
+    client/qopcuabackendthreadpool.cpp \
+    client/qopcuaclientstatistics.cpp \
+    client/qopcuastatisticscollector.cpp \
+    client/qopcuatracer.cpp \
+    client/qopcuaencodedvalue.cpp \
+    client/qopcuaclientsidefilter.cpp \
+    client/qopcuaarraydelta.cpp
 
 HEADERS += \
     client/qopcuaclient_p.h \
     client/qopcuaclientimpl_p.h \
     client/qopcuanode_p.h \
     client/qopcuanodeimpl_p.h \
+    client/qopcuahandletable_p.h \
     client/qopcuabackend_p.h \
     client/qopcuamonitoringparameters.h \
     client/qopcuamonitoringparameters_p.h \
     client/qopcuareferencedescription.h \
     client/qopcuareferencedescription_p.h \
-    client/qopcuabinarydataencoding_p.h
+    client/qopcuabinarydataencoding_p.h \
+    client/qopcuareaditem.h \
+    client/qopcuareaditem_p.h \
+    client/qopcuawriteitem.h \
+    client/qopcuawriteitem_p.h \
+    client/qopcuanodeid.h \
+    client/qopcuaaddressspacecache_p.h \
+    client/qopcuahistorybuffer_p.h \
+    client/qopcuabackendthreadpool_p.h \
+    client/qopcuaclientstatistics.h \
+    client/qopcuaclientstatistics_p.h \
+    client/qopcuastatisticscollector_p.h \
+    client/qopcuatracer_p.h \
+    client/qopcuaencodedvalue_p.h \
+    client/qopcuaclientsidefilter_p.h \
+    client/qopcuasnapshothash_p.h \
+    client/qopcuaarraydelta.h
@@ -0,0 +1,615 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#include "qopcuaaddressspacecache_p.h"
+
+#include <QtOpcUa/qopcuanodeid.h>
+#include <private/qopcuabackend_p.h>
+
+#include <QtCore/qcryptographichash.h>
+#include <QtCore/qloggingcategory.h>
+#include <QtCore/qmap.h>
+#include <QtCore/qsavefile.h>
+
+#include <algorithm>
+#include <cstring>
+
+QT_BEGIN_NAMESPACE
+
+Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA)
+
+// The file consists of a header followed by the node table, the browse result table,
+// the reference table and the string data (UTF-16). All values are stored in host byte order,
+// a file written on a machine with a different byte order fails the magic number check.
+static const quint32 cacheMagic = 0x43415551; // "QUAC"
+static const quint32 cacheFormatVersion = 1;
+
+struct QOpcUaAddressSpaceCache::StringRef
+{
+    quint32 offset; // in characters
+    quint32 length;
+};
+
+struct QOpcUaAddressSpaceCache::FileHeader
+{
+    quint32 magic;
+    quint32 formatVersion;
+    char key[20];
+    quint32 nodeCount;
+    quint32 browseSetCount;
+    quint32 referenceCount;
+    quint32 stringDataSize; // in characters
+};
+
+struct QOpcUaAddressSpaceCache::NodeEntry
+{
+    StringRef nodeId;
+    StringRef browseName;
+    StringRef displayNameLocale;
+    StringRef displayNameText;
+    StringRef dataType;
+    quint32 browseNameNamespace;
+    qint32 nodeClass;
+    quint32 attributes;
+    quint32 firstBrowseSet;
+    quint32 browseSetCount;
+};
+
+namespace {
+
+struct BrowseSetEntry
+{
+    quint32 referenceType;
+    quint32 nodeClassMask;
+    quint32 firstReference;
+    quint32 referenceCount;
+};
+
+struct ReferenceEntry
+{
+    quint32 targetNode; // Index into the node table
+    quint32 referenceType;
+};
+
+QString normalizedNodeId(const QString &nodeId)
+{
+    const QOpcUaNodeId id = QOpcUaNodeId::fromString(nodeId);
+    return id.isNull() ? nodeId : id.toString();
+}
+
+} // namespace
+
+QOpcUaAddressSpaceCache::QOpcUaAddressSpaceCache()
+    : m_data(nullptr)
+    , m_size(0)
+    , m_open(false)
+{
+}
+
+QOpcUaAddressSpaceCache::~QOpcUaAddressSpaceCache()
+{
+    close();
+}
+
+/*
+    Returns the attributes which are assumed not to change as long as the cache key is unchanged.
+*/
+QOpcUa::NodeAttributes QOpcUaAddressSpaceCache::cacheableAttributes()
+{
+    return QOpcUa::NodeAttribute::NodeClass | QOpcUa::NodeAttribute::BrowseName |
+            QOpcUa::NodeAttribute::DisplayName | QOpcUa::NodeAttribute::DataType;
+}
+
+QByteArray QOpcUaAddressSpaceCache::cacheKey(const QString &applicationUri, const QStringList &namespaceArray, const QString &modelVersion)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(applicationUri.toUtf8());
+    for (const QString &ns : namespaceArray) {
+        hash.addData("\n", 1);
+        hash.addData(ns.toUtf8());
+    }
+    hash.addData("\0", 1);
+    hash.addData(modelVersion.toUtf8());
+    return hash.result();
+}
+
+/*
+    Opens the cache file \a fileName. The content of an existing file is only used if it
+    has been written with the same \a key, otherwise the cache starts empty and the file
+    is replaced on the next save().
+
+    Returns \c true if existing content has been mapped.
+*/
+bool QOpcUaAddressSpaceCache::open(const QString &fileName, const QByteArray &key)
+{
+    close();
+
+    m_fileName = fileName;
+    m_key = key;
+    m_open = true;
+
+    m_file.setFileName(fileName);
+    if (!m_file.exists())
+        return false;
+
+    if (!m_file.open(QIODevice::ReadOnly)) {
+        qCWarning(QT_OPCUA) << "Unable to open address space cache" << fileName << m_file.errorString();
+        return false;
+    }
+
+    m_size = m_file.size();
+    if (m_size >= static_cast<qint64>(sizeof(FileHeader)))
+        m_data = m_file.map(0, m_size);
+
+    bool valid = false;
+    if (m_data) {
+        const FileHeader *header = reinterpret_cast<const FileHeader *>(m_data);
+        const quint64 expectedSize = sizeof(FileHeader) +
+                quint64(header->nodeCount) * sizeof(NodeEntry) +
+                quint64(header->browseSetCount) * sizeof(BrowseSetEntry) +
+                quint64(header->referenceCount) * sizeof(ReferenceEntry) +
+                quint64(header->stringDataSize) * sizeof(QChar);
+
+        valid = header->magic == cacheMagic && header->formatVersion == cacheFormatVersion &&
+                m_key.size() == static_cast<int>(sizeof(header->key)) &&
+                !std::memcmp(header->key, m_key.constData(), sizeof(header->key)) &&
+                expectedSize == static_cast<quint64>(m_size);
+    }
+
+    if (!valid) {
+        if (m_data)
+            m_file.unmap(const_cast<uchar *>(m_data));
+        m_data = nullptr;
+        m_size = 0;
+        m_file.close();
+    }
+
+    return valid;
+}
+
+/*
+    Writes all cached entries to the cache file and maps the new file.
+*/
+bool QOpcUaAddressSpaceCache::save()
+{
+    if (!m_open)
+        return false;
+
+    if (m_modified.isEmpty())
+        return true;
+
+    const QByteArray content = serialize();
+
+    // The file must not be mapped while it is replaced
+    if (m_data)
+        m_file.unmap(const_cast<uchar *>(m_data));
+    m_data = nullptr;
+    m_size = 0;
+    m_file.close();
+
+    QSaveFile file(m_fileName);
+    if (!file.open(QIODevice::WriteOnly) || file.write(content) != content.size() || !file.commit()) {
+        qCWarning(QT_OPCUA) << "Unable to write address space cache" << m_fileName << file.errorString();
+        const QHash<QString, CachedNode> modified = m_modified;
+        open(m_fileName, m_key);
+        m_modified = modified;
+        return false;
+    }
+
+    m_modified.clear();
+    open(m_fileName, m_key);
+    return true;
+}
+
+void QOpcUaAddressSpaceCache::close()
+{
+    if (m_data)
+        m_file.unmap(const_cast<uchar *>(m_data));
+    m_data = nullptr;
+    m_size = 0;
+    m_file.close();
+    m_modified.clear();
+    m_open = false;
+}
+
+bool QOpcUaAddressSpaceCache::isOpen() const
+{
+    return m_open;
+}
+
+int QOpcUaAddressSpaceCache::mappedNodeCount() const
+{
+    return m_data ? static_cast<int>(reinterpret_cast<const FileHeader *>(m_data)->nodeCount) : 0;
+}
+
+/*
+    Fills \a results with the cached values of \a attributes for \a nodeId.
+    Returns \c false if at least one of the attributes is not cached.
+*/
+bool QOpcUaAddressSpaceCache::readAttributes(const QString &nodeId, QOpcUa::NodeAttributes attributes, QVector<QOpcUaReadResult> &results) const
+{
+    if (!m_open || !attributes || (attributes & ~cacheableAttributes()))
+        return false;
+
+    CachedNode node;
+    if (!findNode(normalizedNodeId(nodeId), node, false) || (node.attributes & attributes) != attributes)
+        return false;
+
+    results.clear();
+    qt_forEachAttribute(attributes, [&](QOpcUa::NodeAttribute attr) {
+        QOpcUaReadResult result;
+        result.attributeId = attr;
+        result.statusCode = QOpcUa::UaStatusCode::Good;
+        if (attr == QOpcUa::NodeAttribute::NodeClass)
+            result.value = static_cast<qint32>(node.nodeClass);
+        else if (attr == QOpcUa::NodeAttribute::BrowseName)
+            result.value = QVariant::fromValue(node.browseName);
+        else if (attr == QOpcUa::NodeAttribute::DisplayName)
+            result.value = QVariant::fromValue(node.displayName);
+        else if (attr == QOpcUa::NodeAttribute::DataType)
+            result.value = node.dataType;
+        results.push_back(result);
+    });
+
+    return true;
+}
+
+void QOpcUaAddressSpaceCache::storeAttributes(const QString &nodeId, const QVector<QOpcUaReadResult> &results)
+{
+    if (!m_open)
+        return;
+
+    const bool hasCacheableAttribute = std::any_of(results.constBegin(), results.constEnd(), [](const QOpcUaReadResult &result) {
+        return result.statusCode == QOpcUa::UaStatusCode::Good && (cacheableAttributes() & result.attributeId);
+    });
+    if (!hasCacheableAttribute)
+        return;
+
+    const QString id = normalizedNodeId(nodeId);
+    CachedNode current;
+    findNode(id, current, false);
+    CachedNode updated = current;
+
+    for (const QOpcUaReadResult &result : results) {
+        if (result.statusCode != QOpcUa::UaStatusCode::Good || !(cacheableAttributes() & result.attributeId))
+            continue;
+
+        if (result.attributeId == QOpcUa::NodeAttribute::NodeClass) {
+            bool ok = false;
+            const int nodeClass = result.value.toInt(&ok);
+            if (!ok)
+                continue;
+            updated.nodeClass = static_cast<QOpcUa::NodeClass>(nodeClass);
+        } else if (result.attributeId == QOpcUa::NodeAttribute::BrowseName) {
+            if (result.value.userType() != qMetaTypeId<QOpcUa::QQualifiedName>())
+                continue;
+            updated.browseName = result.value.value<QOpcUa::QQualifiedName>();
+        } else if (result.attributeId == QOpcUa::NodeAttribute::DisplayName) {
+            if (result.value.userType() != qMetaTypeId<QOpcUa::QLocalizedText>())
+                continue;
+            updated.displayName = result.value.value<QOpcUa::QLocalizedText>();
+        } else if (result.attributeId == QOpcUa::NodeAttribute::DataType) {
+            if (result.value.toString().isEmpty())
+                continue;
+            updated.dataType = normalizedNodeId(result.value.toString());
+        }
+        updated.attributes |= result.attributeId;
+    }
+
+    if (updated.attributes == current.attributes && updated.nodeClass == current.nodeClass &&
+            updated.browseName == current.browseName && updated.displayName == current.displayName &&
+            updated.dataType == current.dataType)
+        return;
+
+    CachedNode &node = modifiableNode(id);
+    node.attributes = updated.attributes;
+    node.nodeClass = updated.nodeClass;
+    node.browseName = updated.browseName;
+    node.displayName = updated.displayName;
+    node.dataType = updated.dataType;
+}
+
+/*
+    Fills \a references with the cached result of a browse request with \a referenceType
+    and \a nodeClassMask on \a nodeId. Returns \c false if there is no such result.
+*/
+bool QOpcUaAddressSpaceCache::browseChildren(const QString &nodeId, QOpcUa::ReferenceTypeId referenceType, QOpcUa::NodeClasses nodeClassMask,
+                                             QVector<QOpcUaReferenceDescription> &references) const
+{
+    if (!m_open)
+        return false;
+
+    CachedNode node;
+    if (!findNode(normalizedNodeId(nodeId), node, true))
+        return false;
+
+    const auto it = node.browseResults.constFind(BrowseKey(static_cast<quint32>(referenceType), static_cast<quint32>(nodeClassMask)));
+    if (it == node.browseResults.constEnd())
+        return false;
+
+    references.clear();
+    references.reserve(it->size());
+    for (const CachedReference &reference : *it) {
+        CachedNode target;
+        if (!findNode(reference.first, target, false))
+            return false;
+
+        QOpcUaReferenceDescription description;
+        description.setNodeId(reference.first);
+        description.setRefType(static_cast<QOpcUa::ReferenceTypeId>(reference.second));
+        description.setNodeClass(target.nodeClass);
+        description.setBrowseName(target.browseName);
+        description.setDisplayName(target.displayName);
+        references.push_back(description);
+    }
+
+    return true;
+}
+
+void QOpcUaAddressSpaceCache::storeBrowseResult(const QString &nodeId, QOpcUa::ReferenceTypeId referenceType, QOpcUa::NodeClasses nodeClassMask,
+                                                const QVector<QOpcUaReferenceDescription> &references)
+{
+    if (!m_open)
+        return;
+
+    QVector<CachedReference> cachedReferences;
+    cachedReferences.reserve(references.size());
+
+    // The reference descriptions contain the static attributes of the target nodes
+    for (const QOpcUaReferenceDescription &reference : references) {
+        const QString targetId = normalizedNodeId(reference.nodeId());
+        cachedReferences.push_back(CachedReference(targetId, static_cast<quint32>(reference.refType())));
+
+        QVector<QOpcUaReadResult> attributes(3);
+        attributes[0].attributeId = QOpcUa::NodeAttribute::NodeClass;
+        attributes[0].value = static_cast<qint32>(reference.nodeClass());
+        attributes[1].attributeId = QOpcUa::NodeAttribute::BrowseName;
+        attributes[1].value = QVariant::fromValue(reference.browseName());
+        attributes[2].attributeId = QOpcUa::NodeAttribute::DisplayName;
+        attributes[2].value = QVariant::fromValue(reference.displayName());
+        for (QOpcUaReadResult &attribute : attributes)
+            attribute.statusCode = QOpcUa::UaStatusCode::Good;
+        storeAttributes(targetId, attributes);
+    }
+
+    const QString id = normalizedNodeId(nodeId);
+    const BrowseKey key(static_cast<quint32>(referenceType), static_cast<quint32>(nodeClassMask));
+
+    CachedNode current;
+    if (findNode(id, current, true) && current.browseResults.contains(key) && current.browseResults.value(key) == cachedReferences)
+        return;
+
+    modifiableNode(id).browseResults.insert(key, cachedReferences);
+}
+
+bool QOpcUaAddressSpaceCache::findNode(const QString &nodeId, CachedNode &node, bool withBrowseResults) const
+{
+    const auto it = m_modified.constFind(nodeId);
+    if (it != m_modified.constEnd()) {
+        node = *it;
+        return true;
+    }
+
+    const NodeEntry *entry = findMappedNode(nodeId);
+    if (!entry)
+        return false;
+
+    node = decodeMappedNode(entry, withBrowseResults);
+    return true;
+}
+
+QOpcUaAddressSpaceCache::CachedNode &QOpcUaAddressSpaceCache::modifiableNode(const QString &nodeId)
+{
+    auto it = m_modified.find(nodeId);
+    if (it != m_modified.end())
+        return *it;
+
+    const NodeEntry *entry = findMappedNode(nodeId);
+    return *m_modified.insert(nodeId, entry ? decodeMappedNode(entry, true) : CachedNode());
+}
+
+const QOpcUaAddressSpaceCache::NodeEntry *QOpcUaAddressSpaceCache::findMappedNode(const QString &nodeId) const
+{
+    if (!m_data)
+        return nullptr;
+
+    const FileHeader *header = reinterpret_cast<const FileHeader *>(m_data);
+    const NodeEntry *nodes = reinterpret_cast<const NodeEntry *>(m_data + sizeof(FileHeader));
+    const QChar *strings = reinterpret_cast<const QChar *>(m_data + m_size - header->stringDataSize * sizeof(QChar));
+
+    quint32 begin = 0;
+    quint32 end = header->nodeCount;
+    while (begin < end) {
+        const quint32 middle = begin + (end - begin) / 2;
+        const StringRef &ref = nodes[middle].nodeId;
+        if (quint64(ref.offset) + ref.length > header->stringDataSize)
+            return nullptr;
+
+        const int result = QString::compare(QString::fromRawData(strings + ref.offset, static_cast<int>(ref.length)), nodeId);
+        if (result == 0)
+            return &nodes[middle];
+        if (result < 0)
+            begin = middle + 1;
+        else
+            end = middle;
+    }
+
+    return nullptr;
+}
+
+QOpcUaAddressSpaceCache::CachedNode QOpcUaAddressSpaceCache::decodeMappedNode(const NodeEntry *entry, bool withBrowseResults) const
+{
+    CachedNode node;
+    node.attributes = QOpcUa::NodeAttributes(QFlag(static_cast<int>(entry->attributes))) & cacheableAttributes();
+    node.nodeClass = static_cast<QOpcUa::NodeClass>(entry->nodeClass);
+    node.browseName = QOpcUa::QQualifiedName(static_cast<quint16>(entry->browseNameNamespace), mappedString(entry->browseName));
+    node.displayName = QOpcUa::QLocalizedText(mappedString(entry->displayNameLocale), mappedString(entry->displayNameText));
+    node.dataType = mappedString(entry->dataType);
+
+    if (!withBrowseResults)
+        return node;
+
+    const FileHeader *header = reinterpret_cast<const FileHeader *>(m_data);
+    const NodeEntry *nodes = reinterpret_cast<const NodeEntry *>(m_data + sizeof(FileHeader));
+    const BrowseSetEntry *browseSets = reinterpret_cast<const BrowseSetEntry *>(nodes + header->nodeCount);
+    const ReferenceEntry *references = reinterpret_cast<const ReferenceEntry *>(browseSets + header->browseSetCount);
+
+    if (quint64(entry->firstBrowseSet) + entry->browseSetCount > header->browseSetCount)
+        return node;
+
+    for (quint32 i = entry->firstBrowseSet; i < entry->firstBrowseSet + entry->browseSetCount; ++i) {
+        const BrowseSetEntry &set = browseSets[i];
+        if (quint64(set.firstReference) + set.referenceCount > header->referenceCount)
+            continue;
+
+        QVector<CachedReference> targets;
+        targets.reserve(static_cast<int>(set.referenceCount));
+        for (quint32 j = set.firstReference; j < set.firstReference + set.referenceCount; ++j) {
+            if (references[j].targetNode >= header->nodeCount)
+                continue;
+            targets.push_back(CachedReference(mappedString(nodes[references[j].targetNode].nodeId), references[j].referenceType));
+        }
+        node.browseResults.insert(BrowseKey(set.referenceType, set.nodeClassMask), targets);
+    }
+
+    return node;
+}
+
+QString QOpcUaAddressSpaceCache::mappedString(const StringRef &ref) const
+{
+    const FileHeader *header = reinterpret_cast<const FileHeader *>(m_data);
+    if (quint64(ref.offset) + ref.length > header->stringDataSize)
+        return QString();
+
+    const QChar *strings = reinterpret_cast<const QChar *>(m_data + m_size - header->stringDataSize * sizeof(QChar));
+    return QString(strings + ref.offset, static_cast<int>(ref.length));
+}
+
+QByteArray QOpcUaAddressSpaceCache::serialize() const
+{
+    // Merge the mapped and the modified entries, the node table is sorted by node id
+    QMap<QString, CachedNode> allNodes;
+    if (m_data) {
+        const FileHeader *header = reinterpret_cast<const FileHeader *>(m_data);
+        const NodeEntry *nodes = reinterpret_cast<const NodeEntry *>(m_data + sizeof(FileHeader));
+        for (quint32 i = 0; i < header->nodeCount; ++i)
+            allNodes.insert(mappedString(nodes[i].nodeId), decodeMappedNode(&nodes[i], true));
+    }
+    for (auto it = m_modified.constBegin(); it != m_modified.constEnd(); ++it)
+        allNodes.insert(it.key(), it.value());
+
+    QHash<QString, quint32> nodeIndex;
+    quint32 index = 0;
+    for (auto it = allNodes.constBegin(); it != allNodes.constEnd(); ++it)
+        nodeIndex.insert(it.key(), index++);
+
+    QVector<NodeEntry> nodeEntries;
+    QVector<BrowseSetEntry> browseSetEntries;
+    QVector<ReferenceEntry> referenceEntries;
+    QString stringData;
+    QHash<QString, StringRef> stringRefs; // Display names are often equal to the browse names
+
+    const auto addString = [&](const QString &s) {
+        const auto it = stringRefs.constFind(s);
+        if (it != stringRefs.constEnd())
+            return *it;
+        const StringRef ref = { static_cast<quint32>(stringData.size()), static_cast<quint32>(s.size()) };
+        stringData.append(s);
+        stringRefs.insert(s, ref);
+        return ref;
+    };
+
+    nodeEntries.reserve(allNodes.size());
+    for (auto it = allNodes.constBegin(); it != allNodes.constEnd(); ++it) {
+        const CachedNode &node = it.value();
+
+        NodeEntry entry;
+        entry.nodeId = addString(it.key());
+        entry.browseName = addString(node.browseName.name);
+        entry.displayNameLocale = addString(node.displayName.locale);
+        entry.displayNameText = addString(node.displayName.text);
+        entry.dataType = addString(node.dataType);
+        entry.browseNameNamespace = node.browseName.namespaceIndex;
+        entry.nodeClass = static_cast<qint32>(node.nodeClass);
+        entry.attributes = static_cast<quint32>(node.attributes);
+        entry.firstBrowseSet = static_cast<quint32>(browseSetEntries.size());
+        entry.browseSetCount = 0;
+
+        for (auto set = node.browseResults.constBegin(); set != node.browseResults.constEnd(); ++set) {
+            BrowseSetEntry setEntry;
+            setEntry.referenceType = set.key().first;
+            setEntry.nodeClassMask = set.key().second;
+            setEntry.firstReference = static_cast<quint32>(referenceEntries.size());
+            setEntry.referenceCount = 0;
+
+            for (const CachedReference &reference : set.value()) {
+                const auto target = nodeIndex.constFind(reference.first);
+                if (target == nodeIndex.constEnd())
+                    continue;
+                referenceEntries.push_back({ *target, reference.second });
+                ++setEntry.referenceCount;
+            }
+
+            browseSetEntries.push_back(setEntry);
+            ++entry.browseSetCount;
+        }
+
+        nodeEntries.push_back(entry);
+    }
+
+    FileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    header.magic = cacheMagic;
+    header.formatVersion = cacheFormatVersion;
+    std::memcpy(header.key, m_key.constData(), qMin(sizeof(header.key), static_cast<size_t>(m_key.size())));
+    header.nodeCount = static_cast<quint32>(nodeEntries.size());
+    header.browseSetCount = static_cast<quint32>(browseSetEntries.size());
+    header.referenceCount = static_cast<quint32>(referenceEntries.size());
+    header.stringDataSize = static_cast<quint32>(stringData.size());
+
+    QByteArray content;
+    content.reserve(static_cast<int>(sizeof(header) + nodeEntries.size() * sizeof(NodeEntry) +
+                                     browseSetEntries.size() * sizeof(BrowseSetEntry) +
+                                     referenceEntries.size() * sizeof(ReferenceEntry) + stringData.size() * sizeof(QChar)));
+    content.append(reinterpret_cast<const char *>(&header), sizeof(header));
+    content.append(reinterpret_cast<const char *>(nodeEntries.constData()), nodeEntries.size() * static_cast<int>(sizeof(NodeEntry)));
+    content.append(reinterpret_cast<const char *>(browseSetEntries.constData()), browseSetEntries.size() * static_cast<int>(sizeof(BrowseSetEntry)));
+    content.append(reinterpret_cast<const char *>(referenceEntries.constData()), referenceEntries.size() * static_cast<int>(sizeof(ReferenceEntry)));
+    content.append(reinterpret_cast<const char *>(stringData.constData()), stringData.size() * static_cast<int>(sizeof(QChar)));
+
+    return content;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,134 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#ifndef QOPCUAADDRESSSPACECACHE_P_H
+#define QOPCUAADDRESSSPACECACHE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtOpcUa/qopcuaglobal.h>
+#include <QtOpcUa/qopcuareferencedescription.h>
+#include <QtOpcUa/qopcuatype.h>
+#include <private/qopcuanodeimpl_p.h>
+
+#include <QtCore/qfile.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qpair.h>
+#include <QtCore/qstringlist.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+// Persistent cache for static node attributes and browse results of one server.
+// The file is memory mapped and only read on lookup, entries learned during the session
+// are kept in memory until the cache is saved. save() writes a new file with all entries
+// sorted by node id, lookups in the mapped file use a binary search.
+class Q_OPCUA_EXPORT QOpcUaAddressSpaceCache
+{
+public:
+    QOpcUaAddressSpaceCache();
+    ~QOpcUaAddressSpaceCache();
+
+    static QOpcUa::NodeAttributes cacheableAttributes();
+    static QByteArray cacheKey(const QString &applicationUri, const QStringList &namespaceArray, const QString &modelVersion);
+
+    bool open(const QString &fileName, const QByteArray &key);
+    bool save();
+    void close();
+
+    bool isOpen() const;
+    int mappedNodeCount() const;
+
+    bool readAttributes(const QString &nodeId, QOpcUa::NodeAttributes attributes, QVector<QOpcUaReadResult> &results) const;
+    void storeAttributes(const QString &nodeId, const QVector<QOpcUaReadResult> &results);
+
+    bool browseChildren(const QString &nodeId, QOpcUa::ReferenceTypeId referenceType, QOpcUa::NodeClasses nodeClassMask,
+                        QVector<QOpcUaReferenceDescription> &references) const;
+    void storeBrowseResult(const QString &nodeId, QOpcUa::ReferenceTypeId referenceType, QOpcUa::NodeClasses nodeClassMask,
+                           const QVector<QOpcUaReferenceDescription> &references);
+
+private:
+    Q_DISABLE_COPY(QOpcUaAddressSpaceCache)
+
+    struct StringRef;
+    struct FileHeader;
+    struct NodeEntry;
+
+    typedef QPair<quint32, quint32> BrowseKey; // Reference type and node class mask of the browse request
+    typedef QPair<QString, quint32> CachedReference; // Target node id and reference type
+
+    struct CachedNode {
+        CachedNode()
+            : nodeClass(QOpcUa::NodeClass::Undefined)
+        {}
+
+        QOpcUa::NodeAttributes attributes;
+        QOpcUa::NodeClass nodeClass;
+        QOpcUa::QQualifiedName browseName;
+        QOpcUa::QLocalizedText displayName;
+        QString dataType;
+        QHash<BrowseKey, QVector<CachedReference>> browseResults;
+    };
+
+    bool findNode(const QString &nodeId, CachedNode &node, bool withBrowseResults) const;
+    CachedNode &modifiableNode(const QString &nodeId);
+    const NodeEntry *findMappedNode(const QString &nodeId) const;
+    CachedNode decodeMappedNode(const NodeEntry *entry, bool withBrowseResults) const;
+    QString mappedString(const StringRef &ref) const;
+    QByteArray serialize() const;
+
+    QFile m_file;
+    QString m_fileName;
+    QByteArray m_key;
+    const uchar *m_data;
+    qint64 m_size;
+    bool m_open;
+
+    // Entries which were added or changed since the file has been mapped
+    QHash<QString, CachedNode> m_modified;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUAADDRESSSPACECACHE_P_H
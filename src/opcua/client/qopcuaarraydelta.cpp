@@ -0,0 +1,282 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuaarraydelta.h"
+
+#include <cstring>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaArrayDelta
+    \inmodule QtOpcUa
+    \brief Describes the elements of an array value which have changed
+
+    QOpcUaArrayDelta compares two values of an array attribute and holds the index ranges of
+    the elements which differ. It is emitted by \l QOpcUaNode::arrayDeltaUpdated() if array deltas
+    have been enabled for a node, so consumers of large arrays don't have to compare the whole array
+    for each data change.
+
+    The ranges can be applied to a buffer which holds the previous value of the array:
+
+    \code
+    QVector<double> samples;
+    node->setArrayDeltaEnabled(QOpcUa::NodeAttribute::Value, true);
+    QObject::connect(node, &QOpcUaNode::arrayDeltaUpdated, [&samples](QOpcUa::NodeAttribute attr, QOpcUaArrayDelta delta) {
+        delta.applyTo(samples);
+        ...
+    });
+    \endcode
+
+    Typed arrays (see \l QOpcUaClient::setTypedArraysEnabled()) are compared bitwise in blocks,
+    QVariantList arrays are compared element by element.
+*/
+
+/*!
+    \typedef QOpcUaArrayDelta::Range
+
+    A range of changed elements, \c first is the index of the first and \c second is the index
+    of the last changed element.
+*/
+
+/*!
+    \fn template <typename T> bool QOpcUaArrayDelta::applyTo(QVector<T> &buffer) const
+
+    Copies the changed elements to \a buffer and resizes it to the length of the new value.
+    If the size of \a buffer doesn't match the previous length, all elements are copied.
+
+    The new value must be a QVector<T> or a QVariantList with elements convertible to \c T.
+    Returns \c false and leaves \a buffer unchanged otherwise.
+*/
+
+/*!
+    Creates an invalid delta.
+*/
+QOpcUaArrayDelta::QOpcUaArrayDelta()
+    : m_length(-1)
+    , m_previousLength(0)
+{}
+
+/*!
+    Creates the delta between the array values \a previous and \a current.
+
+    If \a previous is not an array or has a different representation than \a current,
+    all elements of \a current are reported as changed. The delta is invalid if \a current
+    is not an array.
+*/
+QOpcUaArrayDelta::QOpcUaArrayDelta(const QVariant &previous, const QVariant &current)
+    : m_value(current)
+    , m_length(-1)
+    , m_previousLength(0)
+{
+    compare(previous);
+}
+
+template <typename T>
+static inline const QVector<T> &qt_vector(const QVariant &value)
+{
+    return *static_cast<const QVector<T> *>(value.constData());
+}
+
+template <typename T>
+static inline bool qt_typedArrayLength(const QVariant &value, int &length)
+{
+    if (value.userType() != qMetaTypeId<QVector<T>>())
+        return false;
+    length = qt_vector<T>(value).size();
+    return true;
+}
+
+// Returns the number of elements of a QVariantList or a typed array, -1 for all other values
+static int qt_arrayLength(const QVariant &value)
+{
+    if (value.type() == QVariant::List)
+        return static_cast<const QVariantList *>(value.constData())->size();
+
+    int length = -1;
+    if (value.userType() >= QMetaType::User
+            && (qt_typedArrayLength<double>(value, length) || qt_typedArrayLength<float>(value, length)
+                || qt_typedArrayLength<qint64>(value, length) || qt_typedArrayLength<quint64>(value, length)
+                || qt_typedArrayLength<qint32>(value, length) || qt_typedArrayLength<quint32>(value, length)
+                || qt_typedArrayLength<qint16>(value, length) || qt_typedArrayLength<quint16>(value, length)
+                || qt_typedArrayLength<qint8>(value, length) || qt_typedArrayLength<quint8>(value, length))) {
+        return length;
+    }
+    return -1;
+}
+
+// Adds index i to the ranges, indices are added in ascending order
+static inline void qt_addIndex(QVector<QOpcUaArrayDelta::Range> &ranges, int i)
+{
+    if (!ranges.isEmpty() && ranges.last().second == i - 1)
+        ranges.last().second = i;
+    else
+        ranges.append(QOpcUaArrayDelta::Range(i, i));
+}
+
+template <typename T>
+static bool qt_compareTyped(const QVariant &previous, const QVariant &current, QVector<QOpcUaArrayDelta::Range> &ranges)
+{
+    if (current.userType() != qMetaTypeId<QVector<T>>())
+        return false;
+
+    const QVector<T> &b = qt_vector<T>(current);
+    const int common = previous.userType() == current.userType() ? qMin(qt_vector<T>(previous).size(), b.size()) : 0;
+
+    // Values which share their data are equal, equal blocks are skipped with one memcmp
+    if (common && qt_vector<T>(previous).constData() != b.constData()) {
+        const T *oldData = qt_vector<T>(previous).constData();
+        const T *newData = b.constData();
+        static const int blockSize = 256;
+        for (int block = 0; block < common; block += blockSize) {
+            const int size = qMin(blockSize, common - block);
+            if (std::memcmp(oldData + block, newData + block, size * sizeof(T)) == 0)
+                continue;
+            for (int i = block; i < block + size; ++i) {
+                if (std::memcmp(oldData + i, newData + i, sizeof(T)) != 0)
+                    qt_addIndex(ranges, i);
+            }
+        }
+    }
+
+    if (b.size() > common) {
+        qt_addIndex(ranges, common);
+        ranges.last().second = b.size() - 1;
+    }
+    return true;
+}
+
+void QOpcUaArrayDelta::compare(const QVariant &previous)
+{
+    m_length = qt_arrayLength(m_value);
+    if (m_length < 0)
+        return;
+    m_previousLength = qMax(0, qt_arrayLength(previous));
+
+    if (m_value.type() == QVariant::List) {
+        const QVariantList &b = *static_cast<const QVariantList *>(m_value.constData());
+        int common = 0;
+        if (previous.type() == QVariant::List) {
+            const QVariantList &a = *static_cast<const QVariantList *>(previous.constData());
+            common = qMin(a.size(), b.size());
+            if (a.constBegin() != b.constBegin()) {
+                for (int i = 0; i < common; ++i) {
+                    if (a.at(i) != b.at(i))
+                        qt_addIndex(m_ranges, i);
+                }
+            }
+        }
+        if (b.size() > common) {
+            qt_addIndex(m_ranges, common);
+            m_ranges.last().second = b.size() - 1;
+        }
+        return;
+    }
+
+    // The length check above has already matched one of the typed arrays
+    const bool compared = qt_compareTyped<double>(previous, m_value, m_ranges) || qt_compareTyped<float>(previous, m_value, m_ranges)
+            || qt_compareTyped<qint64>(previous, m_value, m_ranges) || qt_compareTyped<quint64>(previous, m_value, m_ranges)
+            || qt_compareTyped<qint32>(previous, m_value, m_ranges) || qt_compareTyped<quint32>(previous, m_value, m_ranges)
+            || qt_compareTyped<qint16>(previous, m_value, m_ranges) || qt_compareTyped<quint16>(previous, m_value, m_ranges)
+            || qt_compareTyped<qint8>(previous, m_value, m_ranges) || qt_compareTyped<quint8>(previous, m_value, m_ranges);
+    Q_ASSERT(compared);
+    Q_UNUSED(compared);
+}
+
+/*!
+    Returns \c true if the new value is an array.
+*/
+bool QOpcUaArrayDelta::isValid() const
+{
+    return m_length >= 0;
+}
+
+/*!
+    Returns \c true if no element has changed and the length of the array is unchanged.
+*/
+bool QOpcUaArrayDelta::isEmpty() const
+{
+    return m_ranges.isEmpty() && m_length == m_previousLength;
+}
+
+/*!
+    Returns the number of elements of the new value. Elements beyond the previous length
+    are contained in the last range.
+*/
+int QOpcUaArrayDelta::length() const
+{
+    return qMax(0, m_length);
+}
+
+/*!
+    Returns the number of elements of the previous value, 0 if the previous value was not an array.
+*/
+int QOpcUaArrayDelta::previousLength() const
+{
+    return m_previousLength;
+}
+
+/*!
+    Returns the ranges of changed elements in ascending order.
+*/
+QVector<QOpcUaArrayDelta::Range> QOpcUaArrayDelta::ranges() const
+{
+    return m_ranges;
+}
+
+/*!
+    Returns the range at \a index in the index range syntax of OPC UA, for example \c "5:9",
+    which can be passed to \l QOpcUaNode::readAttributeRange().
+*/
+QString QOpcUaArrayDelta::indexRange(int index) const
+{
+    if (index < 0 || index >= m_ranges.size())
+        return QString();
+    const Range &range = m_ranges.at(index);
+    if (range.first == range.second)
+        return QString::number(range.first);
+    return QString::number(range.first) + QLatin1Char(':') + QString::number(range.second);
+}
+
+/*!
+    Returns the new value.
+*/
+QVariant QOpcUaArrayDelta::value() const
+{
+    return m_value;
+}
+
+QT_END_NAMESPACE
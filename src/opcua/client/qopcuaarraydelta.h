@@ -0,0 +1,127 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUAARRAYDELTA_H
+#define QOPCUAARRAYDELTA_H
+
+#include <QtOpcUa/qopcuaglobal.h>
+
+#include <QtCore/qmetatype.h>
+#include <QtCore/qpair.h>
+#include <QtCore/qvariant.h>
+#include <QtCore/qvector.h>
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+class Q_OPCUA_EXPORT QOpcUaArrayDelta
+{
+public:
+    typedef QPair<int, int> Range; // First and last index, both inclusive
+
+    QOpcUaArrayDelta();
+    QOpcUaArrayDelta(const QVariant &previous, const QVariant &current);
+
+    bool isValid() const;
+    bool isEmpty() const;
+
+    int length() const;
+    int previousLength() const;
+    QVector<Range> ranges() const;
+    QString indexRange(int index) const;
+    QVariant value() const;
+
+    template <typename T>
+    bool applyTo(QVector<T> &buffer) const;
+
+private:
+    void compare(const QVariant &previous);
+
+    QVariant m_value;
+    QVector<Range> m_ranges;
+    int m_length;
+    int m_previousLength;
+};
+
+Q_DECLARE_TYPEINFO(QOpcUaArrayDelta, Q_MOVABLE_TYPE);
+
+template <typename T>
+bool QOpcUaArrayDelta::applyTo(QVector<T> &buffer) const
+{
+    if (!isValid())
+        return false;
+
+    // A buffer which doesn't hold the previous value is replaced completely
+    QVector<Range> changed = m_ranges;
+    if (buffer.size() != m_previousLength) {
+        changed.clear();
+        if (m_length > 0)
+            changed.append(Range(0, m_length - 1));
+    }
+
+    if (m_value.userType() == qMetaTypeId<QVector<T>>()) {
+        const QVector<T> &values = *static_cast<const QVector<T> *>(m_value.constData());
+        buffer.resize(values.size());
+        for (const Range &range : qAsConst(changed))
+            std::copy(values.constBegin() + range.first, values.constBegin() + range.second + 1, buffer.begin() + range.first);
+        return true;
+    }
+
+    if (m_value.type() == QVariant::List) {
+        const QVariantList &values = *static_cast<const QVariantList *>(m_value.constData());
+        for (const Range &range : qAsConst(changed)) {
+            for (int i = range.first; i <= range.second; ++i) {
+                if (!values.at(i).canConvert<T>())
+                    return false;
+            }
+        }
+        buffer.resize(values.size());
+        for (const Range &range : qAsConst(changed)) {
+            for (int i = range.first; i <= range.second; ++i)
+                buffer[i] = values.at(i).value<T>();
+        }
+        return true;
+    }
+
+    return false;
+}
+
+QT_END_NAMESPACE
+
+Q_DECLARE_METATYPE(QOpcUaArrayDelta)
+
+#endif // QOPCUAARRAYDELTA_H
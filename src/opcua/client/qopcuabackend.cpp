@@ -35,11 +35,17 @@
 ****************************************************************************/
 
 #include <private/qopcuabackend_p.h>
+#include <private/qopcuaclientsidefilter_p.h>
+#include <private/qopcuahistorybuffer_p.h>
+
+#include <QtCore/qtimer.h>
 
 QT_BEGIN_NAMESPACE
 
 QOpcUaBackend::QOpcUaBackend()
     : QObject()
+    , m_typedArraysEnabled(0)
+    , m_lazyValueDecodingEnabled(0)
 {}
 
 QOpcUaBackend::~QOpcUaBackend()
@@ -89,4 +95,159 @@ double QOpcUaBackend::revisePublishingInterval(double requestedValue, double min
     return std::max(requestedValue, minimumValue);
 }
 
+bool QOpcUaBackend::typedArraysEnabled() const
+{
+    return m_typedArraysEnabled.load();
+}
+
+void QOpcUaBackend::setTypedArraysEnabled(bool enabled)
+{
+    m_typedArraysEnabled.store(enabled ? 1 : 0);
+}
+
+bool QOpcUaBackend::lazyValueDecodingEnabled() const
+{
+    return m_lazyValueDecodingEnabled.load();
+}
+
+void QOpcUaBackend::setLazyValueDecodingEnabled(bool enabled)
+{
+    m_lazyValueDecodingEnabled.store(enabled ? 1 : 0);
+}
+
+// Returns the element type for QVariants containing a typed numeric array, QOpcUa::Undefined for all other types.
+// The element types have the same size and representation as the corresponding OPC UA built-in types.
+QOpcUa::Types QOpcUaBackend::typedArrayElementType(int userType)
+{
+    if (userType < QMetaType::User)
+        return QOpcUa::Undefined;
+    if (userType == qMetaTypeId<QVector<double>>())
+        return QOpcUa::Double;
+    if (userType == qMetaTypeId<QVector<float>>())
+        return QOpcUa::Float;
+    if (userType == qMetaTypeId<QVector<qint32>>())
+        return QOpcUa::Int32;
+    if (userType == qMetaTypeId<QVector<quint32>>())
+        return QOpcUa::UInt32;
+    if (userType == qMetaTypeId<QVector<qint16>>())
+        return QOpcUa::Int16;
+    if (userType == qMetaTypeId<QVector<quint16>>())
+        return QOpcUa::UInt16;
+    if (userType == qMetaTypeId<QVector<qint64>>())
+        return QOpcUa::Int64;
+    if (userType == qMetaTypeId<QVector<quint64>>())
+        return QOpcUa::UInt64;
+    if (userType == qMetaTypeId<QVector<qint8>>())
+        return QOpcUa::SByte;
+    if (userType == qMetaTypeId<QVector<quint8>>())
+        return QOpcUa::Byte;
+    return QOpcUa::Undefined;
+}
+
+// A null buffer removes the history buffer of the attribute.
+void QOpcUaBackend::setHistoryBuffer(quint64 handle, QOpcUa::NodeAttribute attr, const QSharedPointer<QOpcUaHistoryBuffer> &buffer)
+{
+    const QPair<quint64, uint> key(handle, static_cast<uint>(attr));
+    m_historyBuffers.modify([&](QHash<QPair<quint64, uint>, QSharedPointer<QOpcUaHistoryBuffer>> &buffers) {
+        if (buffer)
+            buffers.insert(key, buffer);
+        else
+            buffers.remove(key);
+    });
+}
+
+void QOpcUaBackend::removeHistoryBuffers(quint64 handle)
+{
+    m_historyBuffers.modify([handle](QHash<QPair<quint64, uint>, QSharedPointer<QOpcUaHistoryBuffer>> &buffers) {
+        for (auto it = buffers.begin(); it != buffers.end();) {
+            if (it.key().first == handle)
+                it = buffers.erase(it);
+            else
+                ++it;
+        }
+    });
+}
+
+// Must be called from the thread which delivers the data changes, it is the only producer for the buffers.
+void QOpcUaBackend::recordHistory(quint64 handle, const QOpcUaReadResult &value)
+{
+    const QSharedPointer<QOpcUaHistoryBuffer> buffer = m_historyBuffers.value(QPair<quint64, uint>(handle, static_cast<uint>(value.attributeId)));
+    if (buffer)
+        buffer->push(value);
+}
+
+// A null filter removes the client side filter of the attribute.
+void QOpcUaBackend::setClientSideFilter(quint64 handle, QOpcUa::NodeAttribute attr, const QSharedPointer<QOpcUaClientSideFilter> &filter)
+{
+    const QPair<quint64, uint> key(handle, static_cast<uint>(attr));
+    m_clientSideFilters.modify([&](QHash<QPair<quint64, uint>, QSharedPointer<QOpcUaClientSideFilter>> &filters) {
+        if (filter)
+            filters.insert(key, filter);
+        else
+            filters.remove(key);
+    });
+}
+
+void QOpcUaBackend::removeClientSideFilters(quint64 handle)
+{
+    m_clientSideFilters.modify([handle](QHash<QPair<quint64, uint>, QSharedPointer<QOpcUaClientSideFilter>> &filters) {
+        for (auto it = filters.begin(); it != filters.end();) {
+            if (it.key().first == handle)
+                it = filters.erase(it);
+            else
+                ++it;
+        }
+    });
+}
+
+// Must be called from the thread which delivers the data changes, the filters keep the last delivered value.
+bool QOpcUaBackend::passesClientSideFilter(quint64 handle, const QOpcUaReadResult &value)
+{
+    const QSharedPointer<QOpcUaClientSideFilter> filter =
+            m_clientSideFilters.value(QPair<quint64, uint>(handle, static_cast<uint>(value.attributeId)));
+    if (!filter)
+        return true;
+
+    switch (filter->accept(value, m_statistics)) {
+    case QOpcUaClientSideFilter::Decision::Deliver:
+        return true;
+    case QOpcUaClientSideFilter::Decision::Defer:
+        // The SDK may deliver the data changes in its own thread, the timer runs in the thread of the backend
+        QMetaObject::invokeMethod(this, [this, handle, filter]() {
+            startDeferredValueTimer(handle, filter, filter->remainingInterval());
+        }, Qt::QueuedConnection);
+        return false;
+    case QOpcUaClientSideFilter::Decision::Suppress:
+        return false;
+    }
+    return false;
+}
+
+void QOpcUaBackend::startDeferredValueTimer(quint64 handle, const QSharedPointer<QOpcUaClientSideFilter> &filter, int interval)
+{
+    QTimer::singleShot(interval, Qt::PreciseTimer, this, [this, handle, filter]() {
+        deliverDeferredValue(handle, filter);
+    });
+}
+
+// The last value of a burst is delivered when the minimum interval has expired,
+// an attribute which settles after a burst doesn't keep a stale value
+void QOpcUaBackend::deliverDeferredValue(quint64 handle, const QSharedPointer<QOpcUaClientSideFilter> &filter)
+{
+    QOpcUaReadResult value;
+    int remainingInterval = -1;
+    if (!filter->takeDeferredValue(&value, &remainingInterval, m_statistics)) {
+        if (remainingInterval >= 0)
+            startDeferredValueTimer(handle, filter, remainingInterval);
+        return;
+    }
+
+    // The filter has been removed or replaced while the value was deferred
+    if (m_clientSideFilters.value(QPair<quint64, uint>(handle, static_cast<uint>(value.attributeId))) != filter)
+        return;
+
+    recordHistory(handle, value);
+    emit attributeUpdated(handle, value);
+}
+
 QT_END_NAMESPACE
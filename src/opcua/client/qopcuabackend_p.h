@@ -50,14 +50,22 @@
 
 #include <QtOpcUa/qopcuaclient.h>
 #include <private/qopcuanodeimpl_p.h>
+#include <private/qopcuasnapshothash_p.h>
+#include <private/qopcuastatisticscollector_p.h>
 
+#include <QtCore/qatomic.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qmutex.h>
 #include <QtCore/qobject.h>
+#include <QtCore/qsharedpointer.h>
 
 #include <functional>
 
 QT_BEGIN_NAMESPACE
 
 class QOpcUaMonitoringParameters;
+class QOpcUaClientSideFilter;
+class QOpcUaHistoryBuffer;
 
 class Q_OPCUA_EXPORT QOpcUaBackend : public QObject
 {
@@ -72,25 +80,88 @@ public:
         return sizeof(std::underlying_type<QOpcUa::NodeAttribute>::type) * CHAR_BIT;
     }
 
+    // Initial number of operations per service request for batched operations.
+    // Backends halve their limit if the server responds with BadTooManyOperations.
+    static Q_DECL_CONSTEXPR int defaultMaxOperationsPerRequest()
+    {
+        return 1000;
+    }
+
+    // Initial number of service requests a backend keeps in flight at the same time.
+    static Q_DECL_CONSTEXPR int defaultMaxPendingRequests()
+    {
+        return 32;
+    }
+
     QOpcUa::Types attributeIdToTypeId(QOpcUa::NodeAttribute attr);
 
     double revisePublishingInterval(double requestedValue, double minimumValue);
 
+    // Numeric arrays are delivered as QVector<T> instead of QVariantList if enabled.
+    // The flag is read by the converters, which may run in threads owned by the SDK.
+    bool typedArraysEnabled() const;
+    static QOpcUa::Types typedArrayElementType(int userType);
+
+    // Values are handed to the client undecoded as QOpcUaEncodedValue if enabled.
+    // Backends which can't keep the SDK representation ignore the flag.
+    bool lazyValueDecodingEnabled() const;
+    void setLazyValueDecodingEnabled(bool enabled);
+
+    // History buffers are registered from the client thread and written by the thread which delivers the
+    // data changes. The lookup of the buffer doesn't take a lock.
+    void setHistoryBuffer(quint64 handle, QOpcUa::NodeAttribute attr, const QSharedPointer<QOpcUaHistoryBuffer> &buffer);
+    void removeHistoryBuffers(quint64 handle);
+    void recordHistory(quint64 handle, const QOpcUaReadResult &value);
+
+    // Client side filters are registered like the history buffers. Backends call passesClientSideFilter()
+    // from the thread which delivers the data changes, suppressed values are neither recorded nor queued.
+    // Values deferred by the minimum interval are emitted with attributeUpdated() by the backend thread.
+    void setClientSideFilter(quint64 handle, QOpcUa::NodeAttribute attr, const QSharedPointer<QOpcUaClientSideFilter> &filter);
+    void removeClientSideFilters(quint64 handle);
+    bool passesClientSideFilter(quint64 handle, const QOpcUaReadResult &value);
+
+    // Updated by the backend and SDK threads, read by the client thread
+    QOpcUaStatisticsCollector &statistics() { return m_statistics; }
+    const QOpcUaStatisticsCollector &statistics() const { return m_statistics; }
+
+public Q_SLOTS:
+    void setTypedArraysEnabled(bool enabled);
+
 Q_SIGNALS:
     void stateAndOrErrorChanged(QOpcUaClient::ClientState state,
                                 QOpcUaClient::ClientError error);
-    void attributesRead(uintptr_t handle, QVector<QOpcUaReadResult> attributes, QOpcUa::UaStatusCode serviceResult);
-    void attributeWritten(uintptr_t hande, QOpcUa::NodeAttribute attribute, QVariant value, QOpcUa::UaStatusCode statusCode);
-    void methodCallFinished(uintptr_t handle, QString methodNodeId, QVariant result, QOpcUa::UaStatusCode statusCode);
-
-    void attributeUpdated(uintptr_t handle, QOpcUaReadResult res);
-    void monitoringEnableDisable(uintptr_t handle, QOpcUa::NodeAttribute attr, bool subscribe, QOpcUaMonitoringParameters status);
-    void monitoringStatusChanged(uintptr_t handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameters items,
+    void attributesRead(quint64 handle, QVector<QOpcUaReadResult> attributes, QOpcUa::UaStatusCode serviceResult);
+    void attributeWritten(quint64 hande, QOpcUa::NodeAttribute attribute, QVariant value, QOpcUa::UaStatusCode statusCode);
+    void methodCallFinished(quint64 handle, QString methodNodeId, QVariant result, QOpcUa::UaStatusCode statusCode);
+
+    void attributeUpdated(quint64 handle, QOpcUaReadResult res);
+    void attributesUpdated(QVector<QOpcUaAttributeUpdate> updates);
+    void monitoringEnableDisable(quint64 handle, QOpcUa::NodeAttribute attr, bool subscribe, QOpcUaMonitoringParameters status);
+    void monitoringStatusChanged(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameters items,
                            QOpcUaMonitoringParameters param);
-    void browseFinished(uintptr_t handle, QVector<QOpcUaReferenceDescription> children, QOpcUa::UaStatusCode statusCode);
+    void browseFinished(quint64 handle, QVector<QOpcUaReferenceDescription> children, QOpcUa::UaStatusCode statusCode);
+    void nodeRegistered(quint64 handle, QString registeredNodeId, QOpcUa::UaStatusCode statusCode);
+    void nodeUnregistered(quint64 handle, QOpcUa::UaStatusCode statusCode);
+    void browseRecursiveResultsAvailable(QString rootNodeId, QVector<QOpcUaReferenceDescription> references);
+    void browseRecursiveFinished(QString rootNodeId, QOpcUa::UaStatusCode statusCode);
+
+    void readNodeAttributesFinished(QVector<QOpcUaReadItemResult> results, QOpcUa::UaStatusCode serviceResult);
+    void writeNodeAttributesFinished(QVector<QOpcUaWriteItem> nodesToWrite, QVector<QOpcUaWriteItemResult> results,
+                                     QOpcUa::UaStatusCode serviceResult);
 
 private:
     Q_DISABLE_COPY(QOpcUaBackend)
+    QAtomicInt m_typedArraysEnabled;
+    QAtomicInt m_lazyValueDecodingEnabled;
+
+    QOpcUaSnapshotHash<QPair<quint64, uint>, QSharedPointer<QOpcUaHistoryBuffer>> m_historyBuffers;
+
+    void startDeferredValueTimer(quint64 handle, const QSharedPointer<QOpcUaClientSideFilter> &filter, int interval);
+    void deliverDeferredValue(quint64 handle, const QSharedPointer<QOpcUaClientSideFilter> &filter);
+
+    QOpcUaSnapshotHash<QPair<quint64, uint>, QSharedPointer<QOpcUaClientSideFilter>> m_clientSideFilters;
+
+    QOpcUaStatisticsCollector m_statistics;
 };
 
 static inline void qt_forEachAttribute(QOpcUa::NodeAttributes attributes, const std::function<void(QOpcUa::NodeAttribute attribute)> &f)
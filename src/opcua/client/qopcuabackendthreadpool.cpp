@@ -0,0 +1,160 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuabackendthreadpool_p.h"
+
+#include <QtCore/qthread.h>
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaBackendThreadPool
+    \internal
+
+    The backend objects of all clients share a fixed number of event loop threads instead of
+    running one thread per client. A backend is assigned to the thread which serves the least
+    backends, new threads are started on demand until the maximum thread count is reached.
+
+    Sharing a thread is only possible for backends which don't block it in their steady state.
+    The backends on one thread take turns, a backend waiting in a synchronous SDK call delays
+    the requests and notifications of all others. Backends with blocking SDK calls request a
+    dedicated thread.
+
+    The maximum thread count defaults to QThread::idealThreadCount() and can be changed with
+    the \c QT_OPCUA_BACKEND_THREADS environment variable. A value of 0 gives every backend a
+    dedicated thread.
+*/
+
+Q_GLOBAL_STATIC(QOpcUaBackendThreadPool, backendThreadPool)
+
+QOpcUaBackendThreadPool::QOpcUaBackendThreadPool()
+    : m_maxThreadCount(QThread::idealThreadCount())
+{
+    bool ok = false;
+    const int maxThreadCount = qEnvironmentVariableIntValue("QT_OPCUA_BACKEND_THREADS", &ok);
+    if (ok && maxThreadCount >= 0)
+        m_maxThreadCount = maxThreadCount;
+    m_maxThreadCount = qMax(0, m_maxThreadCount);
+}
+
+QOpcUaBackendThreadPool::~QOpcUaBackendThreadPool()
+{
+    // Backends which are still assigned are deleted when their thread finishes
+    for (const ThreadEntry &entry : qAsConst(m_threads)) {
+        entry.thread->quit();
+        entry.thread->wait();
+        delete entry.thread;
+    }
+}
+
+/*!
+    Returns the thread pool which is shared by all clients of the process.
+*/
+QOpcUaBackendThreadPool *QOpcUaBackendThreadPool::instance()
+{
+    return backendThreadPool();
+}
+
+/*!
+    Returns a running thread of \a type for a new backend object.
+    The caller moves the backend to the returned thread and hands the thread back to
+    \l releaseThread() after the backend has been scheduled for deletion with deleteLater().
+*/
+QThread *QOpcUaBackendThreadPool::acquireThread(ThreadType type)
+{
+    QMutexLocker locker(&m_mutex);
+
+    const bool shared = type == ThreadType::Shared && m_maxThreadCount > 0;
+    if (shared) {
+        auto leastUsed = std::min_element(m_threads.begin(), m_threads.end(),
+                                          [](const ThreadEntry &a, const ThreadEntry &b) { return a.backends < b.backends; });
+        if (leastUsed != m_threads.end() && (leastUsed->backends == 0 || m_threads.size() >= m_maxThreadCount)) {
+            ++leastUsed->backends;
+            return leastUsed->thread;
+        }
+    }
+
+    QThread *thread = new QThread();
+    thread->setObjectName(QStringLiteral("QOpcUaBackend"));
+
+    if (shared)
+        m_threads.append({thread, 1});
+    else
+        QObject::connect(thread, &QThread::finished, thread, &QObject::deleteLater);
+
+    thread->start();
+    return thread;
+}
+
+/*!
+    Releases a \a thread which has been returned by \l acquireThread().
+    Shared threads keep running for the next backend, dedicated threads are stopped.
+*/
+void QOpcUaBackendThreadPool::releaseThread(QThread *thread)
+{
+    QMutexLocker locker(&m_mutex);
+
+    auto it = std::find_if(m_threads.begin(), m_threads.end(),
+                           [thread](const ThreadEntry &entry) { return entry.thread == thread; });
+    if (it != m_threads.end()) {
+        --it->backends;
+        return;
+    }
+
+    // Pending deleteLater() calls for objects of the thread are processed when it has finished
+    thread->quit();
+}
+
+/*!
+    Returns the maximum number of shared threads, 0 if every backend gets a dedicated thread.
+*/
+int QOpcUaBackendThreadPool::maxThreadCount() const
+{
+    return m_maxThreadCount;
+}
+
+/*!
+    Returns the number of shared threads which have been started.
+*/
+int QOpcUaBackendThreadPool::threadCount() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_threads.size();
+}
+
+QT_END_NAMESPACE
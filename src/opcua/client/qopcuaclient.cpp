@@ -36,6 +36,7 @@
 
 #include "qopcuaclient.h"
 #include <private/qopcuaclient_p.h>
+#include <private/qopcuanode_p.h>
 
 #include <QtCore/qloggingcategory.h>
 
@@ -144,6 +145,69 @@ Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA)
     of an entry in \a namespaces corresponds to the namespace index used in the node id.
 */
 
+/*!
+    \fn void QOpcUaClient::readNodeAttributesFinished(QVector<QOpcUaReadItemResult> results, QOpcUa::UaStatusCode serviceResult)
+
+    This signal is emitted after a \l readNodeAttributes() operation has finished.
+
+    \a results contains one entry for each attribute of each read item, in the order
+    of the items passed to \l readNodeAttributes(). Attributes of a single item are
+    ordered by their \l QOpcUa::NodeAttribute value.
+    \a serviceResult is the first bad service result of the underlying read requests
+    or \c Good if all requests have succeeded.
+*/
+
+/*!
+    \fn void QOpcUaClient::writeNodeAttributesFinished(QVector<QOpcUaWriteItemResult> results, QOpcUa::UaStatusCode serviceResult)
+
+    This signal is emitted after a \l writeNodeAttributes() operation has finished.
+
+    \a results contains one entry with the status code of the write operation for each
+    write item, in the order of the items passed to \l writeNodeAttributes().
+    \a serviceResult is the first bad service result of the underlying write requests
+    or \c Good if all requests have succeeded.
+*/
+
+/*!
+    \fn void QOpcUaClient::dataChangeBatch(QVector<QOpcUaReadItemResult> changes)
+
+    This signal is emitted once for each group of data change notifications received from the server.
+    \a changes contains one entry for each notification, with the node id, attribute, status code,
+    timestamps and new value of a monitored attribute of a \l QOpcUaNode created by this client.
+
+    All notifications of a publish response are delivered in a single batch. The attribute caches of
+    the affected nodes are updated before this signal is emitted. Connecting to this signal instead of
+    \l QOpcUaNode::attributeUpdated() of each node avoids one signal emission per value when a large
+    number of nodes is monitored.
+*/
+
+/*!
+    \fn void QOpcUaClient::browseRecursiveResultsAvailable(QString rootNodeId, QVector<QOpcUaReferenceDescription> references)
+
+    This signal is emitted for each chunk of results of a \l browseRecursive() operation started at \a rootNodeId.
+    \a references contains the nodes found in one browse response. The node which has been browsed to find
+    a node is available via \l QOpcUaReferenceDescription::parentNodeId().
+*/
+
+/*!
+    \fn void QOpcUaClient::browseRecursiveFinished(QString rootNodeId, QOpcUa::UaStatusCode statusCode)
+
+    This signal is emitted after a \l browseRecursive() operation started at \a rootNodeId has finished.
+    No further \l browseRecursiveResultsAvailable() signals are emitted for this operation.
+    \a statusCode is the first bad status code returned for one of the browsed nodes or \c Good
+    if all nodes have been browsed successfully.
+*/
+
+/*!
+    \fn void QOpcUaClient::addressSpaceCacheReady(bool reused)
+
+    This signal is emitted after connecting when the address space cache has been checked
+    against the server. \a reused is \c true if the cache file contained entries for the
+    current address space of the server, \c false if the cache starts empty.
+
+    \sa setAddressSpaceCacheDirectory()
+*/
+
 /*!
     \internal QOpcUaClientImpl is an opaque type (as seen from the public API).
     This prevents users of the public API to use this constructor (eventhough
@@ -234,6 +298,24 @@ QOpcUaNode *QOpcUaClient::node(const QString &nodeId)
     return d->m_impl->node(nodeId);
 }
 
+/*!
+    \overload
+
+    Returns a \l QOpcUaNode object associated with the OPC UA node identified
+    by \a nodeId. The caller becomes owner of the node object.
+
+    The node id is passed to the backend in parsed form, no string has to be parsed.
+    If the client is not connected or \a nodeId is null, \c nullptr is returned.
+*/
+QOpcUaNode *QOpcUaClient::node(const QOpcUaNodeId &nodeId)
+{
+    if (state() != QOpcUaClient::Connected || nodeId.isNull())
+       return nullptr;
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->node(nodeId);
+}
+
 /*!
     Requests an update of the namespace array from the server.
     Returns \c true if the operation has been successfully dispatched.
@@ -264,6 +346,557 @@ QStringList QOpcUaClient::namespaceArray() const
     return d->namespaceArray();
 }
 
+/*!
+    Starts a read of the attributes of multiple nodes described by \a nodesToRead.
+    Returns \c true if the read request has been successfully dispatched.
+
+    In contrast to \l QOpcUaNode::readAttributes(), which issues one read request per node,
+    all items are sent to the server in a single read request. If the number of attributes
+    exceeds the limit accepted by the server, the request is split into several chunks.
+    No \l QOpcUaNode objects are required and the attribute caches of existing
+    \l QOpcUaNode objects are not updated.
+
+    The results are returned in the \l readNodeAttributesFinished() signal.
+
+    \code
+    QVector<QOpcUaReadItem> request;
+    request.push_back(QOpcUaReadItem("ns=1;s=Tag.1"));
+    request.push_back(QOpcUaReadItem("ns=1;s=Tag.2", QOpcUa::NodeAttribute::Value | QOpcUa::NodeAttribute::DisplayName));
+    client->readNodeAttributes(request);
+    \endcode
+
+    \sa readNodeAttributesFinished() QOpcUaReadItem
+*/
+bool QOpcUaClient::readNodeAttributes(const QVector<QOpcUaReadItem> &nodesToRead)
+{
+    if (state() != QOpcUaClient::Connected)
+        return false;
+
+    if (nodesToRead.isEmpty()) {
+        qCWarning(QT_OPCUA) << "No nodes to read";
+        return false;
+    }
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->readNodeAttributes(nodesToRead);
+}
+
+/*!
+    Starts a write of the attributes of multiple nodes described by \a nodesToWrite.
+    Returns \c true if the write request has been successfully dispatched.
+
+    All items are sent to the server in a single write request. If the number of items
+    exceeds the limit accepted by the server, the request is split into several chunks.
+    Completion is reported once by the \l writeNodeAttributesFinished() signal.
+
+    The attribute caches of existing \l QOpcUaNode objects for the written nodes are updated
+    and these objects emit \l QOpcUaNode::attributeWritten() for the written attributes.
+
+    \code
+    QVector<QOpcUaWriteItem> request;
+    request.push_back(QOpcUaWriteItem("ns=1;s=Setpoint.1", QOpcUa::NodeAttribute::Value, 23.5, QOpcUa::Types::Double));
+    request.push_back(QOpcUaWriteItem("ns=1;s=Setpoint.2", QOpcUa::NodeAttribute::Value, 42, QOpcUa::Types::Int32));
+    client->writeNodeAttributes(request);
+    \endcode
+
+    \sa writeNodeAttributesFinished() QOpcUaWriteItem
+*/
+bool QOpcUaClient::writeNodeAttributes(const QVector<QOpcUaWriteItem> &nodesToWrite)
+{
+    if (state() != QOpcUaClient::Connected)
+        return false;
+
+    if (nodesToWrite.isEmpty()) {
+        qCWarning(QT_OPCUA) << "No values to be written";
+        return false;
+    }
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->writeNodeAttributes(nodesToWrite);
+}
+
+static QVector<QOpcUaNodeHandle> qt_nodeHandles(const QOpcUaClient *client, const QVector<QOpcUaNode *> &nodes)
+{
+    QVector<QOpcUaNodeHandle> handles;
+    handles.reserve(nodes.size());
+
+    for (QOpcUaNode *node : nodes) {
+        if (!node)
+            continue;
+
+        QOpcUaNodePrivate *d = static_cast<QOpcUaNodePrivate *>(QObjectPrivate::get(node));
+        if (d->m_client.data() != client || !d->m_impl) {
+            qCWarning(QT_OPCUA) << "Ignoring node" << node->nodeId() << "which does not belong to this client";
+            continue;
+        }
+
+        QOpcUaNodeHandle handle;
+        handle.handle = d->m_impl->handle();
+        handle.nodeId = d->m_impl->nodeId();
+        handles.push_back(handle);
+    }
+
+    return handles;
+}
+
+/*!
+    Enables monitoring of the attributes \a attr for all nodes in \a nodes using the parameters in \a settings.
+    Returns \c true if the request has been successfully dispatched.
+
+    All monitored items are created in a single CreateMonitoredItems request per subscription.
+    If the number of items exceeds the limit accepted by the server, the request is split into several chunks.
+    This is much faster than calling \l QOpcUaNode::enableMonitoring() for a large number of nodes.
+
+    The results are reported per node and attribute in the \l QOpcUaNode::enableMonitoringFinished() signal of each node.
+    All nodes in \a nodes must have been created by this client.
+
+    \code
+    QVector<QOpcUaNode *> nodes;
+    for (const QString &id : tagIds)
+        nodes.push_back(client->node(id));
+    client->enableMonitoring(nodes, QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+    \endcode
+
+    \sa disableMonitoring() QOpcUaNode::enableMonitoring()
+*/
+bool QOpcUaClient::enableMonitoring(const QVector<QOpcUaNode *> &nodes, QOpcUa::NodeAttributes attr,
+                                    const QOpcUaMonitoringParameters &settings)
+{
+    if (state() != QOpcUaClient::Connected)
+        return false;
+
+    const QVector<QOpcUaNodeHandle> handles = qt_nodeHandles(this, nodes);
+    if (handles.isEmpty()) {
+        qCWarning(QT_OPCUA) << "No nodes to monitor";
+        return false;
+    }
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->enableMonitoring(handles, attr, settings);
+}
+
+/*!
+    Disables monitoring of the attributes \a attr for all nodes in \a nodes.
+    Returns \c true if the request has been successfully dispatched.
+
+    The monitored items are removed in a single DeleteMonitoredItems request per subscription.
+    The results are reported per node and attribute in the \l QOpcUaNode::disableMonitoringFinished() signal of each node.
+
+    \sa enableMonitoring() QOpcUaNode::disableMonitoring()
+*/
+bool QOpcUaClient::disableMonitoring(const QVector<QOpcUaNode *> &nodes, QOpcUa::NodeAttributes attr)
+{
+    if (state() != QOpcUaClient::Connected)
+        return false;
+
+    const QVector<QOpcUaNodeHandle> handles = qt_nodeHandles(this, nodes);
+    if (handles.isEmpty()) {
+        qCWarning(QT_OPCUA) << "No nodes to disable monitoring for";
+        return false;
+    }
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->disableMonitoring(handles, attr);
+}
+
+/*!
+    Registers all nodes in \a nodes with the server.
+    Returns \c true if the request has been successfully dispatched.
+
+    The nodes are registered in a single RegisterNodes request per session if the backend supports it.
+    The results are reported in the \l QOpcUaNode::registerNodeFinished() signal of each node.
+
+    \sa unregisterNodes() QOpcUaNode::registerNode()
+*/
+bool QOpcUaClient::registerNodes(const QVector<QOpcUaNode *> &nodes)
+{
+    if (state() != QOpcUaClient::Connected)
+        return false;
+
+    const QVector<QOpcUaNodeHandle> handles = qt_nodeHandles(this, nodes);
+    if (handles.isEmpty()) {
+        qCWarning(QT_OPCUA) << "No nodes to register";
+        return false;
+    }
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->registerNodes(handles);
+}
+
+/*!
+    Unregisters all nodes in \a nodes which have been registered by \l registerNodes() or
+    \l QOpcUaNode::registerNode(). Returns \c true if the request has been successfully dispatched.
+
+    The nodes use their original node id for all requests sent after this call.
+    The results are reported in the \l QOpcUaNode::unregisterNodeFinished() signal of each node.
+
+    \sa registerNodes() QOpcUaNode::unregisterNode()
+*/
+bool QOpcUaClient::unregisterNodes(const QVector<QOpcUaNode *> &nodes)
+{
+    if (state() != QOpcUaClient::Connected)
+        return false;
+
+    QVector<QOpcUaNode *> registered;
+    for (QOpcUaNode *node : nodes) {
+        if (node && node->isRegistered())
+            registered.push_back(node);
+    }
+
+    const QVector<QOpcUaNodeHandle> handles = qt_nodeHandles(this, registered);
+    if (handles.isEmpty()) {
+        qCWarning(QT_OPCUA) << "No registered nodes to unregister";
+        return false;
+    }
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->unregisterNodes(handles);
+}
+
+/*!
+    Starts browsing the address space below the node \a rootNodeId.
+    Returns \c true if the browse operation has been successfully dispatched.
+
+    All nodes reachable from \a rootNodeId by forward references of \a referenceType or its subtypes
+    are browsed, up to \a maxDepth levels below the root node. A \a maxDepth of \c -1 browses the whole
+    tree, \c 1 only returns the children of \a rootNodeId. Only nodes matching \a nodeClassMask are returned
+    and browsed further, \l QOpcUa::NodeClass::Undefined matches all node classes.
+    Each node is only browsed once, even if it is reachable by several paths.
+
+    In contrast to calling \l QOpcUaNode::browseChildren() for each node, many nodes are browsed in a single
+    request and several requests are kept in flight, if supported by the backend. The results are delivered
+    in chunks by the \l browseRecursiveResultsAvailable() signal as soon as they arrive, the end of the
+    operation is signaled by \l browseRecursiveFinished().
+
+    \code
+    QObject::connect(client, &QOpcUaClient::browseRecursiveResultsAvailable,
+                     [](const QString &, const QVector<QOpcUaReferenceDescription> &references) {
+        for (const QOpcUaReferenceDescription &reference : references)
+            addToTree(reference.parentNodeId(), reference);
+    });
+    client->browseRecursive(QStringLiteral("ns=0;i=85")); // The Objects folder
+    \endcode
+
+    \sa browseRecursiveResultsAvailable() browseRecursiveFinished()
+*/
+bool QOpcUaClient::browseRecursive(const QString &rootNodeId, QOpcUa::ReferenceTypeId referenceType,
+                                   QOpcUa::NodeClasses nodeClassMask, int maxDepth)
+{
+    if (state() != QOpcUaClient::Connected)
+        return false;
+
+    if (rootNodeId.isEmpty() || maxDepth == 0) {
+        qCWarning(QT_OPCUA) << "Nothing to browse";
+        return false;
+    }
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->browseRecursive(rootNodeId, referenceType, nodeClassMask, maxDepth);
+}
+
+/*!
+    Enables or disables the typed array representation for numeric arrays.
+
+    By default, array values are returned as a QVariantList with one QVariant per element.
+    If \a enabled is \c true, arrays of the numeric built-in types are returned as a single QVariant
+    containing a QVector of the matching C++ type, for example \c QVector<double> for Double and
+    \c QVector<qint32> for Int32. The array data is copied in one block without creating a QVariant per element.
+    This applies to read results, data change notifications and method call results.
+    Arrays with only one element are also returned as QVector if typed arrays are enabled.
+
+    Writing typed arrays is always supported, a QVector<double> can be passed to \l QOpcUaNode::writeAttribute()
+    independent of this setting.
+
+    Supported element types are qint8, quint8, qint16, quint16, qint32, quint32, qint64, quint64, float and double.
+    Arrays of all other types are always returned as QVariantList.
+
+    \code
+    client->setTypedArraysEnabled(true);
+    QObject::connect(node, &QOpcUaNode::attributeUpdated, [](QOpcUa::NodeAttribute attr, QVariant value) {
+        const QVector<double> samples = value.value<QVector<double>>();
+        ...
+    });
+    \endcode
+
+    \sa typedArraysEnabled()
+*/
+void QOpcUaClient::setTypedArraysEnabled(bool enabled)
+{
+    Q_D(QOpcUaClient);
+    if (d->m_typedArraysEnabled == enabled)
+        return;
+
+    d->m_typedArraysEnabled = enabled;
+    d->m_impl->setTypedArraysEnabled(enabled);
+}
+
+/*!
+    Returns \c true if numeric arrays are returned as typed QVector values.
+
+    \sa setTypedArraysEnabled()
+*/
+bool QOpcUaClient::typedArraysEnabled() const
+{
+    Q_D(const QOpcUaClient);
+    return d->m_typedArraysEnabled;
+}
+
+/*!
+    Enables or disables lazy decoding of values.
+
+    By default, the backend converts every value it receives to QVariant before it is delivered.
+    If \a enabled is \c true, the Value attribute of read results and data change notifications
+    is kept in the representation of the backend SDK and converted on the first call of
+    \l QOpcUaNode::attribute() or \l QOpcUaReadItemResult::value(). The result of the conversion
+    is cached, values which are replaced by a newer notification before they are accessed are never converted.
+    The conversion then takes place in the thread which accesses the value instead of the backend thread.
+
+    \l QOpcUaNode::attributeUpdated() still carries the decoded value, the value is only converted
+    if the signal is connected.
+
+    Lazy decoding is currently supported by the open62541 backend, the other backends always
+    decode values eagerly.
+
+    \sa lazyValueDecodingEnabled()
+*/
+void QOpcUaClient::setLazyValueDecodingEnabled(bool enabled)
+{
+    Q_D(QOpcUaClient);
+    if (d->m_lazyValueDecodingEnabled == enabled)
+        return;
+
+    d->m_lazyValueDecodingEnabled = enabled;
+    d->m_impl->setLazyValueDecodingEnabled(enabled);
+}
+
+/*!
+    Returns \c true if values are decoded on first access.
+
+    \sa setLazyValueDecodingEnabled()
+*/
+bool QOpcUaClient::lazyValueDecodingEnabled() const
+{
+    Q_D(const QOpcUaClient);
+    return d->m_lazyValueDecodingEnabled;
+}
+
+/*!
+    Sets the maximum number of service requests which are sent to the server without waiting
+    for a response to \a count.
+
+    Read, write, browse and method call requests of all nodes of this client share the pipeline.
+    If more requests are made, they are queued and sent as soon as a response has been received.
+    A slow request like browsing a large folder does not delay other requests as long as the
+    limit is not reached. On connections with a high latency, the throughput grows with the number
+    of requests in flight.
+
+    The default value is 32. Values smaller than 1 are treated as 1, which sends one request at a time.
+    Backends which do not support pipelining ignore this setting.
+
+    \sa maxPendingRequests()
+*/
+void QOpcUaClient::setMaxPendingRequests(int count)
+{
+    Q_D(QOpcUaClient);
+    count = qMax(1, count);
+    if (d->m_maxPendingRequests == count)
+        return;
+
+    d->m_maxPendingRequests = count;
+    d->m_impl->setMaxPendingRequests(count);
+}
+
+/*!
+    Returns the maximum number of service requests which are sent without waiting for a response.
+
+    \sa setMaxPendingRequests()
+*/
+int QOpcUaClient::maxPendingRequests() const
+{
+    Q_D(const QOpcUaClient);
+    return d->m_maxPendingRequests;
+}
+
+/*!
+    Sets the interval in milliseconds in which data changes are dispatched to the nodes to \a msec.
+
+    By default, the interval is 0 and each group of data changes is dispatched as soon as it has been
+    received. If \a msec is larger than 0, the client keeps only the newest value for each monitored
+    attribute and dispatches the changed attributes once per interval. Each node then emits
+    \l QOpcUaNode::attributeUpdated() at most once per attribute and interval, and \l dataChangeBatch()
+    is emitted once per interval with all changed attributes.
+
+    This bounds the work in the thread of the client to the number of changed attributes per interval,
+    independent of the rate at which the server publishes. For user interfaces, an interval of 16 ms
+    matches the frame rate of most displays. History buffers still receive all values.
+
+    Setting the interval to 0 dispatches the pending data changes immediately.
+
+    \sa dispatchInterval(), QOpcUaClientStatistics::conflatedValues()
+*/
+void QOpcUaClient::setDispatchInterval(int msec)
+{
+    Q_D(QOpcUaClient);
+    msec = qMax(0, msec);
+    if (d->m_dispatchInterval == msec)
+        return;
+
+    d->m_dispatchInterval = msec;
+    d->m_impl->setDispatchInterval(msec);
+}
+
+/*!
+    Returns the interval in milliseconds in which data changes are dispatched to the nodes,
+    0 if they are dispatched immediately.
+
+    \sa setDispatchInterval()
+*/
+int QOpcUaClient::dispatchInterval() const
+{
+    Q_D(const QOpcUaClient);
+    return d->m_dispatchInterval;
+}
+
+/*!
+    Sets the window in milliseconds in which writes of single attributes are coalesced to \a msec.
+
+    By default, the window is 0 and each call of \l QOpcUaNode::writeAttribute() or
+    \l QOpcUaNode::writeAttributeRange() sends its own write request. If \a msec is larger than 0,
+    the first write starts a window of \a msec milliseconds. Writes to the same attribute and index range
+    of a node inside the window replace the pending value, and all pending writes of the window are sent
+    together at its end, using one write request per session if the backend supports it.
+
+    For each replaced write, the node emits \l QOpcUaNode::attributeWritten() with the status code
+    \c GoodEntryReplaced when the window ends. The newest value is reported with the result from the
+    server. This avoids a queue of outdated write requests when values like setpoints are written at a
+    high rate, for example from a slider.
+
+    Writes from \l QOpcUaNode::writeAttributes() and \l writeNodeAttributes() are not coalesced.
+    Setting the window to 0 sends the pending writes immediately. \l disconnectFromEndpoint() sends the
+    pending writes before the connection is closed. If the connection is lost or the client is destroyed,
+    the pending writes are reported with the status code \c BadDisconnect.
+
+    \sa writeCoalescingInterval(), QOpcUaClientStatistics::coalescedWrites()
+*/
+void QOpcUaClient::setWriteCoalescingInterval(int msec)
+{
+    Q_D(QOpcUaClient);
+    msec = qMax(0, msec);
+    if (d->m_writeCoalescingInterval == msec)
+        return;
+
+    d->m_writeCoalescingInterval = msec;
+    d->m_impl->setWriteCoalescingInterval(msec);
+}
+
+/*!
+    Returns the window in milliseconds in which writes of single attributes are coalesced,
+    0 if each write is sent immediately.
+
+    \sa setWriteCoalescingInterval()
+*/
+int QOpcUaClient::writeCoalescingInterval() const
+{
+    Q_D(const QOpcUaClient);
+    return d->m_writeCoalescingInterval;
+}
+
+/*!
+    Returns a snapshot of the request and notification statistics of this client.
+
+    The snapshot contains the number of requests and the latency histogram per service,
+    the requests in flight, the number of data change notifications per subscription,
+    the number of results waiting to be processed in the thread of the client and the
+    time spent in the value converters.
+
+    The snapshots are independent of each other. The notification rates are calculated by
+    \l QOpcUaClientStatistics::notificationRates() between two snapshots of the caller.
+
+    \sa QOpcUaClientStatistics
+*/
+QOpcUaClientStatistics QOpcUaClient::statistics() const
+{
+    Q_D(const QOpcUaClient);
+    return d->statistics();
+}
+
+/*!
+    Enables the persistent address space cache and sets the directory for the cache files to \a directory.
+    An empty string disables the cache. The setting takes effect on the next connection.
+
+    With the cache enabled, the static attributes \c NodeClass, \c BrowseName, \c DisplayName
+    and \c DataType read by \l QOpcUaNode::readAttributes() and the results of
+    \l QOpcUaNode::browseChildren() are stored in a memory mapped file for each server.
+    When these attributes or the same browse request are requested again, the results are
+    delivered from the cache without contacting the server. Requests which contain other
+    attributes or an index range are always sent to the server.
+
+    After connecting, the application URI, the namespace array and, if set, the value of the
+    node given by \l setAddressSpaceCacheVersionNodeId() are read from the server. If one of them
+    has changed since the cache file has been written, the cached entries are discarded.
+    The cache is not used until \l addressSpaceCacheReady() has been emitted.
+
+    New entries are written to the file when the connection is closed or when
+    \l saveAddressSpaceCache() is called.
+
+    \sa addressSpaceCacheDirectory()
+*/
+void QOpcUaClient::setAddressSpaceCacheDirectory(const QString &directory)
+{
+    Q_D(QOpcUaClient);
+    d->m_addressSpaceCacheDirectory = directory;
+}
+
+/*!
+    Returns the directory of the address space cache files or an empty string if the cache is disabled.
+
+    \sa setAddressSpaceCacheDirectory()
+*/
+QString QOpcUaClient::addressSpaceCacheDirectory() const
+{
+    Q_D(const QOpcUaClient);
+    return d->m_addressSpaceCacheDirectory;
+}
+
+/*!
+    Sets the node id of a variable which changes whenever the address space of the server
+    is modified to \a nodeId. A changed value invalidates the address space cache.
+
+    Servers which modify their address space at runtime without changing the namespace
+    array should expose such a model version node. The setting takes effect on the next connection.
+
+    \sa setAddressSpaceCacheDirectory()
+*/
+void QOpcUaClient::setAddressSpaceCacheVersionNodeId(const QString &nodeId)
+{
+    Q_D(QOpcUaClient);
+    d->m_addressSpaceCacheVersionNodeId = nodeId;
+}
+
+/*!
+    Returns the node id of the model version node used to validate the address space cache.
+
+    \sa setAddressSpaceCacheVersionNodeId()
+*/
+QString QOpcUaClient::addressSpaceCacheVersionNodeId() const
+{
+    Q_D(const QOpcUaClient);
+    return d->m_addressSpaceCacheVersionNodeId;
+}
+
+/*!
+    Writes new entries of the address space cache to disk.
+
+    Returns \c false if the cache is not in use or the file could not be written.
+
+    \sa setAddressSpaceCacheDirectory()
+*/
+bool QOpcUaClient::saveAddressSpaceCache()
+{
+    Q_D(QOpcUaClient);
+    return d->m_addressSpaceCache && d->m_addressSpaceCache->save();
+}
+
 /*!
     Returns the name of the backend used by this instance of QOpcUaClient,
     e.g. "open62541".
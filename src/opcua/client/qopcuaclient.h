@@ -37,8 +37,11 @@
 #ifndef QOPCUACLIENT_H
 #define QOPCUACLIENT_H
 
+#include <QtOpcUa/qopcuaclientstatistics.h>
 #include <QtOpcUa/qopcuaglobal.h>
 #include <QtOpcUa/qopcuanode.h>
+#include <QtOpcUa/qopcuareaditem.h>
+#include <QtOpcUa/qopcuawriteitem.h>
 
 #include <QtCore/qobject.h>
 #include <QtCore/qurl.h>
@@ -79,10 +82,47 @@ public:
     Q_INVOKABLE void connectToEndpoint(const QUrl &url);
     Q_INVOKABLE void disconnectFromEndpoint();
     QOpcUaNode *node(const QString &nodeId);
+    QOpcUaNode *node(const QOpcUaNodeId &nodeId);
 
     bool updateNamespaceArray();
     QStringList namespaceArray() const;
 
+    bool readNodeAttributes(const QVector<QOpcUaReadItem> &nodesToRead);
+    bool writeNodeAttributes(const QVector<QOpcUaWriteItem> &nodesToWrite);
+
+    bool enableMonitoring(const QVector<QOpcUaNode *> &nodes, QOpcUa::NodeAttributes attr,
+                          const QOpcUaMonitoringParameters &settings);
+    bool disableMonitoring(const QVector<QOpcUaNode *> &nodes, QOpcUa::NodeAttributes attr);
+    bool registerNodes(const QVector<QOpcUaNode *> &nodes);
+    bool unregisterNodes(const QVector<QOpcUaNode *> &nodes);
+
+    bool browseRecursive(const QString &rootNodeId,
+                         QOpcUa::ReferenceTypeId referenceType = QOpcUa::ReferenceTypeId::HierarchicalReferences,
+                         QOpcUa::NodeClasses nodeClassMask = QOpcUa::NodeClass::Undefined, int maxDepth = -1);
+
+    void setTypedArraysEnabled(bool enabled);
+    bool typedArraysEnabled() const;
+
+    void setLazyValueDecodingEnabled(bool enabled);
+    bool lazyValueDecodingEnabled() const;
+
+    void setMaxPendingRequests(int count);
+    int maxPendingRequests() const;
+
+    void setDispatchInterval(int msec);
+    int dispatchInterval() const;
+
+    void setWriteCoalescingInterval(int msec);
+    int writeCoalescingInterval() const;
+
+    QOpcUaClientStatistics statistics() const;
+
+    void setAddressSpaceCacheDirectory(const QString &directory);
+    QString addressSpaceCacheDirectory() const;
+    void setAddressSpaceCacheVersionNodeId(const QString &nodeId);
+    QString addressSpaceCacheVersionNodeId() const;
+    bool saveAddressSpaceCache();
+
     QUrl url() const;
 
     ClientState state() const;
@@ -96,6 +136,12 @@ Q_SIGNALS:
     void stateChanged(QOpcUaClient::ClientState state);
     void errorChanged(QOpcUaClient::ClientError error);
     void namespaceArrayUpdated(QStringList namespaces);
+    void readNodeAttributesFinished(QVector<QOpcUaReadItemResult> results, QOpcUa::UaStatusCode serviceResult);
+    void writeNodeAttributesFinished(QVector<QOpcUaWriteItemResult> results, QOpcUa::UaStatusCode serviceResult);
+    void dataChangeBatch(QVector<QOpcUaReadItemResult> changes);
+    void browseRecursiveResultsAvailable(QString rootNodeId, QVector<QOpcUaReferenceDescription> references);
+    void browseRecursiveFinished(QString rootNodeId, QOpcUa::UaStatusCode statusCode);
+    void addressSpaceCacheReady(bool reused);
 
 private:
     Q_DISABLE_COPY(QOpcUaClient)
@@ -50,10 +50,12 @@
 
 #include <QtOpcUa/qopcuaclient.h>
 #include <QtOpcUa/qopcuaglobal.h>
+#include <private/qopcuaaddressspacecache_p.h>
 #include <private/qopcuaclientimpl_p.h>
 
 #include <QtCore/qobject.h>
 #include <QtCore/qscopedpointer.h>
+#include <QtCore/qsharedpointer.h>
 #include <QtCore/qurl.h>
 #include <private/qobject_p.h>
 
@@ -72,6 +74,16 @@ public:
     QOpcUaClient::ClientState m_state;
     QOpcUaClient::ClientError m_error;
     QUrl m_url;
+    bool m_typedArraysEnabled;
+    bool m_lazyValueDecodingEnabled;
+    int m_maxPendingRequests;
+    int m_dispatchInterval;
+    int m_writeCoalescingInterval;
+    QString m_addressSpaceCacheDirectory;
+    QString m_addressSpaceCacheVersionNodeId;
+
+    // Only set after the cache has been checked against the connected server
+    QScopedPointer<QOpcUaAddressSpaceCache> m_addressSpaceCache;
 
     bool checkAndSetUrl(const QUrl &url);
     void setStateAndError(QOpcUaClient::ClientState state,
@@ -81,10 +93,19 @@ public:
     QStringList namespaceArray() const;
     void namespaceArrayUpdated(QOpcUa::NodeAttributes attr);
 
+    void checkAddressSpaceCache();
+    void addressSpaceCacheCheckFinished();
+    void closeAddressSpaceCache();
+
+    QOpcUaClientStatistics statistics() const;
+    bool isDataChangeBatchConnected() const;
+
 private:
     Q_DECLARE_PUBLIC(QOpcUaClient)
     QStringList m_namespaceArray;
     QScopedPointer<QOpcUaNode> m_namespaceArrayNode;
+    QVector<QSharedPointer<QOpcUaNode>> m_cacheCheckNodes;
+    int m_pendingCacheChecks;
 };
 
 QT_END_NAMESPACE
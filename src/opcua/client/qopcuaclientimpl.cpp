@@ -35,87 +35,477 @@
 ****************************************************************************/
 
 #include <private/qopcuabackend_p.h>
+#include <private/qopcuaclient_p.h>
 #include <private/qopcuaclientimpl_p.h>
+#include <private/qopcuaclientstatistics_p.h>
+#include <private/qopcuareaditem_p.h>
+#include <private/qopcuatracer_p.h>
 #include <QtOpcUa/qopcuamonitoringparameters.h>
 
+#include <QtCore/qloggingcategory.h>
+
 QT_BEGIN_NAMESPACE
 
+Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA)
+
 QOpcUaClientImpl::QOpcUaClientImpl(QObject *parent)
     : QObject(parent)
-{}
+    , m_lazyValueDecodingEnabled(false)
+    , m_dispatchInterval(0)
+    , m_conflatedValues(0)
+    , m_writeCoalescingInterval(0)
+    , m_coalescedWrites(0)
+{
+    m_dispatchTimer.setTimerType(Qt::PreciseTimer);
+    connect(&m_dispatchTimer, &QTimer::timeout, this, &QOpcUaClientImpl::flushConflatedUpdates);
+
+    m_writeCoalescingTimer.setTimerType(Qt::PreciseTimer);
+    m_writeCoalescingTimer.setSingleShot(true);
+    connect(&m_writeCoalescingTimer, &QTimer::timeout, this, &QOpcUaClientImpl::flushCoalescedWrites);
+
+    // Evaluates QT_OPCUA_TRACE before the first backend is connected
+    QOpcUaTracer::instance();
+}
 
 QOpcUaClientImpl::~QOpcUaClientImpl()
-{}
+{
+    // The backends are gone, the nodes still expect a result for their pending writes
+    discardCoalescedWrites(QOpcUa::UaStatusCode::BadDisconnect);
+}
+
+// Backends which can't use the parsed node id directly fall back to the string representation
+QOpcUaNode *QOpcUaClientImpl::node(const QOpcUaNodeId &nodeId)
+{
+    return node(nodeId.toString());
+}
+
+bool QOpcUaClientImpl::setMaxPendingRequests(int count)
+{
+    // Backends which send one service request at a time ignore the limit
+    Q_UNUSED(count);
+    return true;
+}
+
+// Backends without a batch request register each node separately
+bool QOpcUaClientImpl::registerNodes(const QVector<QOpcUaNodeHandle> &nodes)
+{
+    bool success = true;
+    for (const QOpcUaNodeHandle &node : nodes) {
+        QOpcUaNodeImpl *impl = m_handles.value(node.handle);
+        success &= impl && impl->registerNode();
+    }
+    return success;
+}
+
+bool QOpcUaClientImpl::unregisterNodes(const QVector<QOpcUaNodeHandle> &nodes)
+{
+    bool success = true;
+    for (const QOpcUaNodeHandle &node : nodes) {
+        QOpcUaNodeImpl *impl = m_handles.value(node.handle);
+        success &= impl && impl->unregisterNode();
+    }
+    return success;
+}
+
+QOpcUaNodeImpl *QOpcUaClientImpl::nodeForHandle(quint64 handle) const
+{
+    return m_handles.value(handle);
+}
+
+void QOpcUaClientImpl::registerNode(QOpcUaNodeImpl *obj)
+{
+    obj->setHandle(m_handles.insert(obj));
+    m_handlesByNodeId.insert(obj->nodeId(), obj->handle());
+}
+
+void QOpcUaClientImpl::unregisterNode(QOpcUaNodeImpl *obj)
+{
+    m_handlesByNodeId.remove(obj->nodeId(), obj->handle());
+    m_handles.remove(obj->handle());
+    obj->setHandle(0);
+}
+
+// Connects a backend signal to the client thread. The direct connection is invoked in the
+// backend thread when the signal is emitted. A single queued connection per signal calls the
+// slot and does the bookkeeping, every emission posts only one event to the client thread.
+template <typename Signal, typename... Args>
+void QOpcUaClientImpl::connectBackendSignal(QOpcUaBackend *backend, Signal signal, void (QOpcUaClientImpl::*slot)(Args...),
+                                            const char *name, const QSharedPointer<TraceHops> &hops)
+{
+    // Queued events from one backend thread arrive in the order they have been sent, both sides
+    // count the events to derive the same flow id. Signals are only linked if tracing was enabled
+    // when the backend was connected, there is no queued arrival event otherwise.
+    const bool traced = QOpcUaTracer::isEnabled();
+    connect(backend, signal, this, [this, hops, name, traced]() {
+        m_pendingEvents.ref();
+        const quint64 id = hops->base + hops->sent.fetchAndAddRelaxed(1);
+        if (traced)
+            QOpcUaTracer::flowStart(name, id);
+    }, Qt::DirectConnection);
+    connect(backend, signal, this, [this, slot, hops, name, traced](Args... args) {
+        if (traced)
+            QOpcUaTracer::flowEnd(name, hops->base + hops->received++);
+        (this->*slot)(args...);
+        m_pendingEvents.deref();
+    });
+}
+
+void QOpcUaClientImpl::connectBackendWithClient(QOpcUaBackend *backend, BackendState state)
+{
+    m_backends.append(backend);
+    backend->setLazyValueDecodingEnabled(m_lazyValueDecodingEnabled);
+
+    QSharedPointer<TraceHops> hops(new TraceHops);
+    hops->base = QOpcUaTracer::nextId() << 32;
+    hops->received = 0;
+
+    connectBackendSignal(backend, &QOpcUaBackend::attributesRead, &QOpcUaClientImpl::handleAttributesRead, "attributesRead", hops);
+    if (state == BackendState::Forward)
+        connectBackendSignal(backend, &QOpcUaBackend::stateAndOrErrorChanged, &QOpcUaClientImpl::stateAndOrErrorChanged, "stateAndOrErrorChanged", hops);
+    connectBackendSignal(backend, &QOpcUaBackend::attributeWritten, &QOpcUaClientImpl::handleAttributeWritten, "attributeWritten", hops);
+    connectBackendSignal(backend, &QOpcUaBackend::attributeUpdated, &QOpcUaClientImpl::handleAttributeUpdated, "attributeUpdated", hops);
+    connectBackendSignal(backend, &QOpcUaBackend::attributesUpdated, &QOpcUaClientImpl::handleAttributesUpdated, "attributesUpdated", hops);
+    connectBackendSignal(backend, &QOpcUaBackend::monitoringEnableDisable, &QOpcUaClientImpl::handleMonitoringEnableDisable, "monitoringEnableDisable", hops);
+    connectBackendSignal(backend, &QOpcUaBackend::monitoringStatusChanged, &QOpcUaClientImpl::handleMonitoringStatusChanged, "monitoringStatusChanged", hops);
+    connectBackendSignal(backend, &QOpcUaBackend::methodCallFinished, &QOpcUaClientImpl::handleMethodCallFinished, "methodCallFinished", hops);
+    connectBackendSignal(backend, &QOpcUaBackend::browseFinished, &QOpcUaClientImpl::handleBrowseFinished, "browseFinished", hops);
+    connectBackendSignal(backend, &QOpcUaBackend::nodeRegistered, &QOpcUaClientImpl::handleNodeRegistered, "nodeRegistered", hops);
+    connectBackendSignal(backend, &QOpcUaBackend::nodeUnregistered, &QOpcUaClientImpl::handleNodeUnregistered, "nodeUnregistered", hops);
+    connectBackendSignal(backend, &QOpcUaBackend::readNodeAttributesFinished, &QOpcUaClientImpl::readNodeAttributesFinished, "readNodeAttributesFinished", hops);
+    connectBackendSignal(backend, &QOpcUaBackend::writeNodeAttributesFinished, &QOpcUaClientImpl::handleWriteNodeAttributesFinished, "writeNodeAttributesFinished", hops);
+    connectBackendSignal(backend, &QOpcUaBackend::browseRecursiveResultsAvailable, &QOpcUaClientImpl::browseRecursiveResultsAvailable, "browseRecursiveResultsAvailable", hops);
+    connectBackendSignal(backend, &QOpcUaBackend::browseRecursiveFinished, &QOpcUaClientImpl::browseRecursiveFinished, "browseRecursiveFinished", hops);
+}
+
+void QOpcUaClientImpl::addStatistics(QOpcUaClientStatisticsPrivate *stats) const
+{
+    for (int i = 0; i < m_backends.size(); ++i)
+        m_backends.at(i)->statistics().addTo(stats, i);
+    stats->pendingEvents += m_pendingEvents.load();
+    stats->conflatedValues += m_conflatedValues;
+    stats->coalescedWrites += m_coalescedWrites;
+}
+
+void QOpcUaClientImpl::setHistoryBuffer(quint64 handle, QOpcUa::NodeAttribute attr, const QSharedPointer<QOpcUaHistoryBuffer> &buffer)
+{
+    for (QOpcUaBackend *backend : qAsConst(m_backends))
+        backend->setHistoryBuffer(handle, attr, buffer);
+}
+
+void QOpcUaClientImpl::removeHistoryBuffers(quint64 handle)
+{
+    for (QOpcUaBackend *backend : qAsConst(m_backends))
+        backend->removeHistoryBuffers(handle);
+}
+
+void QOpcUaClientImpl::setClientSideFilter(quint64 handle, QOpcUa::NodeAttribute attr, const QSharedPointer<QOpcUaClientSideFilter> &filter)
+{
+    for (QOpcUaBackend *backend : qAsConst(m_backends))
+        backend->setClientSideFilter(handle, attr, filter);
+}
+
+void QOpcUaClientImpl::removeClientSideFilters(quint64 handle)
+{
+    for (QOpcUaBackend *backend : qAsConst(m_backends))
+        backend->removeClientSideFilters(handle);
+}
 
-void QOpcUaClientImpl::registerNode(QPointer<QOpcUaNodeImpl> obj)
+// The flag is atomic in the backend, it is set directly instead of invoking a slot in the backend thread
+void QOpcUaClientImpl::setLazyValueDecodingEnabled(bool enabled)
 {
-    m_handles[reinterpret_cast<uintptr_t>(obj.data())] = obj;
+    m_lazyValueDecodingEnabled = enabled;
+    for (QOpcUaBackend *backend : qAsConst(m_backends))
+        backend->setLazyValueDecodingEnabled(enabled);
 }
 
-void QOpcUaClientImpl::unregisterNode(QPointer<QOpcUaNodeImpl> obj)
+void QOpcUaClientImpl::handleAttributesRead(quint64 handle, QVector<QOpcUaReadResult> attr, QOpcUa::UaStatusCode serviceResult)
 {
-    m_handles.remove(reinterpret_cast<uintptr_t>(obj.data()));
+    QOpcUaTraceScope trace("attributesRead", "dispatch");
+    QOpcUaNodeImpl *node = m_handles.value(handle);
+    if (node)
+        emit node->attributesRead(attr, serviceResult);
 }
 
-void QOpcUaClientImpl::connectBackendWithClient(QOpcUaBackend *backend)
+void QOpcUaClientImpl::handleAttributeWritten(quint64 handle, QOpcUa::NodeAttribute attr, const QVariant &value, QOpcUa::UaStatusCode statusCode)
 {
-    connect(backend, &QOpcUaBackend::attributesRead, this, &QOpcUaClientImpl::handleAttributesRead);
-    connect(backend, &QOpcUaBackend::stateAndOrErrorChanged, this, &QOpcUaClientImpl::stateAndOrErrorChanged);
-    connect(backend, &QOpcUaBackend::attributeWritten, this, &QOpcUaClientImpl::handleAttributeWritten);
-    connect(backend, &QOpcUaBackend::attributeUpdated, this, &QOpcUaClientImpl::handleAttributeUpdated);
-    connect(backend, &QOpcUaBackend::monitoringEnableDisable, this, &QOpcUaClientImpl::handleMonitoringEnableDisable);
-    connect(backend, &QOpcUaBackend::monitoringStatusChanged, this, &QOpcUaClientImpl::handleMonitoringStatusChanged);
-    connect(backend, &QOpcUaBackend::methodCallFinished, this, &QOpcUaClientImpl::handleMethodCallFinished);
-    connect(backend, &QOpcUaBackend::browseFinished, this, &QOpcUaClientImpl::handleBrowseFinished);
+    QOpcUaTraceScope trace("attributeWritten", "dispatch");
+    QOpcUaNodeImpl *node = m_handles.value(handle);
+    if (node)
+        emit node->attributeWritten(attr, value, statusCode);
 }
 
-void QOpcUaClientImpl::handleAttributesRead(uintptr_t handle, QVector<QOpcUaReadResult> attr, QOpcUa::UaStatusCode serviceResult)
+static QOpcUaReadItemResult qt_toDataChange(QOpcUaNodeImpl *node, const QOpcUaReadResult &value)
 {
-    auto it = m_handles.constFind(handle);
-    if (it != m_handles.constEnd() && !it->isNull())
-        emit (*it)->attributesRead(attr, serviceResult);
+    QOpcUaReadItemResult change;
+    change.setNodeId(node->nodeId());
+    change.setAttribute(value.attributeId);
+    change.setStatusCode(value.statusCode);
+    change.setRawSourceTimestamp(value.sourceTimestamp);
+    change.setRawServerTimestamp(value.serverTimestamp);
+    if (value.encodedValue)
+        QOpcUaReadItemResultPrivate::setEncodedValue(change, value.encodedValue);
+    else
+        change.setValue(value.value);
+    return change;
 }
 
-void QOpcUaClientImpl::handleAttributeWritten(uintptr_t handle, QOpcUa::NodeAttribute attr, const QVariant &value, QOpcUa::UaStatusCode statusCode)
+void QOpcUaClientImpl::handleAttributeUpdated(quint64 handle, const QOpcUaReadResult &value)
 {
-    auto it = m_handles.constFind(handle);
-    if (it != m_handles.constEnd() && !it->isNull())
-        emit (*it)->attributeWritten(attr, value, statusCode);
+    QOpcUaTraceScope trace("attributeUpdated", "dispatch");
+    QOpcUaAttributeUpdate update;
+    update.handle = handle;
+    update.value = value;
+
+    if (m_dispatchInterval > 0)
+        conflateAttributeUpdate(update);
+    else
+        dispatchAttributeUpdates(QVector<QOpcUaAttributeUpdate>(1, update));
+}
+
+void QOpcUaClientImpl::handleAttributesUpdated(const QVector<QOpcUaAttributeUpdate> &updates)
+{
+    QOpcUaTraceScope trace("attributesUpdated", "dispatch");
+
+    if (m_dispatchInterval > 0) {
+        for (const QOpcUaAttributeUpdate &update : updates)
+            conflateAttributeUpdate(update);
+    } else {
+        dispatchAttributeUpdates(updates);
+    }
+}
+
+// If the dispatch interval is 0, updates are dispatched when they arrive from the backend.
+// Otherwise, only the newest value per handle and attribute is dispatched once per interval.
+void QOpcUaClientImpl::setDispatchInterval(int msec)
+{
+    m_dispatchInterval = qMax(0, msec);
+    if (m_dispatchInterval > 0) {
+        m_dispatchTimer.setInterval(m_dispatchInterval);
+    } else {
+        m_dispatchTimer.stop();
+        flushConflatedUpdates();
+    }
+}
+
+void QOpcUaClientImpl::conflateAttributeUpdate(const QOpcUaAttributeUpdate &update)
+{
+    const QPair<quint64, uint> key(update.handle, static_cast<uint>(update.value.attributeId));
+    auto it = m_conflatedIndex.constFind(key);
+    if (it != m_conflatedIndex.constEnd()) {
+        m_conflatedUpdates[it.value()].value = update.value;
+        ++m_conflatedValues;
+    } else {
+        m_conflatedIndex.insert(key, m_conflatedUpdates.size());
+        m_conflatedUpdates.push_back(update);
+    }
+
+    if (!m_dispatchTimer.isActive())
+        m_dispatchTimer.start();
+}
+
+// The timer keeps running while updates arrive, the first tick without updates stops it
+void QOpcUaClientImpl::flushConflatedUpdates()
+{
+    if (m_conflatedUpdates.isEmpty()) {
+        m_dispatchTimer.stop();
+        return;
+    }
+
+    QOpcUaTraceScope trace("flushConflatedUpdates", "dispatch");
+    QVector<QOpcUaAttributeUpdate> updates;
+    updates.swap(m_conflatedUpdates);
+    m_conflatedIndex.clear();
+    dispatchAttributeUpdates(updates);
+}
+
+void QOpcUaClientImpl::dispatchAttributeUpdates(const QVector<QOpcUaAttributeUpdate> &updates)
+{
+    // The attribute cache of every node is connected to QOpcUaNodeImpl::attributeUpdated(),
+    // the batch is only built if QOpcUaClient::dataChangeBatch() has receivers.
+    const bool batch = m_client
+            && static_cast<QOpcUaClientPrivate *>(QObjectPrivate::get(m_client))->isDataChangeBatchConnected();
+
+    QVector<QOpcUaReadItemResult> changes;
+    if (batch)
+        changes.reserve(updates.size());
+
+    for (const QOpcUaAttributeUpdate &update : updates) {
+        QOpcUaNodeImpl *node = m_handles.value(update.handle);
+        if (!node)
+            continue;
+        emit node->attributeUpdated(update.value.attributeId, update.value);
+        if (batch)
+            changes.push_back(qt_toDataChange(node, update.value));
+    }
+
+    if (!changes.isEmpty())
+        emit dataChangeBatch(changes);
+}
+
+// The first write starts the window, the pending writes are sent when it ends.
+// Setting the interval to 0 sends the pending writes immediately.
+void QOpcUaClientImpl::setWriteCoalescingInterval(int msec)
+{
+    m_writeCoalescingInterval = qMax(0, msec);
+    if (m_writeCoalescingInterval > 0) {
+        m_writeCoalescingTimer.setInterval(m_writeCoalescingInterval);
+    } else {
+        m_writeCoalescingTimer.stop();
+        flushCoalescedWrites();
+    }
+}
+
+bool QOpcUaClientImpl::coalesceWrite(QOpcUaNodeImpl *node, QOpcUa::NodeAttribute attr, const QVariant &value,
+                                     QOpcUa::Types type, const QString &indexRange)
+{
+    if (m_writeCoalescingInterval <= 0)
+        return node->writeAttribute(attr, value, type, indexRange);
+
+    QOpcUaCoalescedWrite write;
+    write.handle = node->handle();
+    write.item = QOpcUaWriteItem(node->nodeId(), attr, value, type, indexRange);
+
+    const CoalescingKey key(qMakePair(write.handle, static_cast<uint>(attr)), indexRange);
+    auto it = m_pendingWriteIndex.constFind(key);
+    if (it != m_pendingWriteIndex.constEnd()) {
+        m_supersededWrites.push_back(m_pendingWrites.at(it.value()));
+        m_pendingWrites[it.value()] = write;
+        ++m_coalescedWrites;
+    } else {
+        m_pendingWriteIndex.insert(key, m_pendingWrites.size());
+        m_pendingWrites.push_back(write);
+    }
+
+    if (!m_writeCoalescingTimer.isActive())
+        m_writeCoalescingTimer.start();
+    return true;
+}
+
+void QOpcUaClientImpl::flushCoalescedWrites()
+{
+    if (m_pendingWrites.isEmpty())
+        return;
+
+    QOpcUaTraceScope trace("flushCoalescedWrites", "dispatch");
+    QVector<QOpcUaCoalescedWrite> writes;
+    writes.swap(m_pendingWrites);
+    m_pendingWriteIndex.clear();
+    QVector<QOpcUaCoalescedWrite> superseded;
+    superseded.swap(m_supersededWrites);
+
+    for (const QOpcUaCoalescedWrite &write : qAsConst(superseded)) {
+        QOpcUaNodeImpl *node = m_handles.value(write.handle);
+        if (node)
+            emit node->attributeWritten(write.item.attribute(), write.item.value(), QOpcUa::UaStatusCode::GoodEntryReplaced);
+    }
+
+    if (!writeCoalesced(writes))
+        qCWarning(QT_OPCUA) << "Failed to send" << writes.size() << "coalesced writes";
+}
+
+void QOpcUaClientImpl::discardCoalescedWrites(QOpcUa::UaStatusCode statusCode)
+{
+    m_writeCoalescingTimer.stop();
+    if (m_pendingWrites.isEmpty())
+        return;
+
+    QVector<QOpcUaCoalescedWrite> writes;
+    writes.swap(m_pendingWrites);
+    m_pendingWriteIndex.clear();
+    QVector<QOpcUaCoalescedWrite> superseded;
+    superseded.swap(m_supersededWrites);
+
+    for (const QOpcUaCoalescedWrite &write : qAsConst(superseded)) {
+        QOpcUaNodeImpl *node = m_handles.value(write.handle);
+        if (node)
+            emit node->attributeWritten(write.item.attribute(), write.item.value(), QOpcUa::UaStatusCode::GoodEntryReplaced);
+    }
+    for (const QOpcUaCoalescedWrite &write : qAsConst(writes)) {
+        QOpcUaNodeImpl *node = m_handles.value(write.handle);
+        if (node)
+            emit node->attributeWritten(write.item.attribute(), write.item.value(), statusCode);
+    }
 }
 
-void QOpcUaClientImpl::handleAttributeUpdated(uintptr_t handle, const QOpcUaReadResult &value)
+// Backends without a batch write send one request per node
+bool QOpcUaClientImpl::writeCoalesced(const QVector<QOpcUaCoalescedWrite> &writes)
 {
-    auto it = m_handles.constFind(handle);
-    if (it != m_handles.constEnd() && !it->isNull())
-        emit (*it)->attributeUpdated(value.attributeId, value);
+    bool success = true;
+    for (const QOpcUaCoalescedWrite &write : writes) {
+        QOpcUaNodeImpl *node = m_handles.value(write.handle);
+        if (node)
+            success &= node->writeAttribute(write.item.attribute(), write.item.value(), write.item.type(), write.item.indexRange());
+    }
+    return success;
 }
 
-void QOpcUaClientImpl::handleMonitoringEnableDisable(uintptr_t handle, QOpcUa::NodeAttribute attr, bool subscribe, QOpcUaMonitoringParameters status)
+void QOpcUaClientImpl::handleMonitoringEnableDisable(quint64 handle, QOpcUa::NodeAttribute attr, bool subscribe, QOpcUaMonitoringParameters status)
 {
-    auto it = m_handles.constFind(handle);
-    if (it != m_handles.constEnd() && !it->isNull())
-        emit (*it)->monitoringEnableDisable(attr, subscribe, status);
+    QOpcUaTraceScope trace("monitoringEnableDisable", "dispatch");
+    QOpcUaNodeImpl *node = m_handles.value(handle);
+    if (node)
+        emit node->monitoringEnableDisable(attr, subscribe, status);
 }
 
-void QOpcUaClientImpl::handleMonitoringStatusChanged(uintptr_t handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameters items, QOpcUaMonitoringParameters param)
+void QOpcUaClientImpl::handleMonitoringStatusChanged(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameters items, QOpcUaMonitoringParameters param)
 {
-    auto it = m_handles.constFind(handle);
-    if (it != m_handles.constEnd() && !it->isNull())
-        emit (*it)->monitoringStatusChanged(attr, items, param);
+    QOpcUaTraceScope trace("monitoringStatusChanged", "dispatch");
+    QOpcUaNodeImpl *node = m_handles.value(handle);
+    if (node)
+        emit node->monitoringStatusChanged(attr, items, param);
 }
 
-void QOpcUaClientImpl::handleMethodCallFinished(uintptr_t handle, QString methodNodeId, QVariant result, QOpcUa::UaStatusCode statusCode)
+void QOpcUaClientImpl::handleMethodCallFinished(quint64 handle, QString methodNodeId, QVariant result, QOpcUa::UaStatusCode statusCode)
 {
-    auto it = m_handles.constFind(handle);
-    if (it != m_handles.constEnd() && !it->isNull())
-        emit (*it)->methodCallFinished(methodNodeId, result, statusCode);
+    QOpcUaTraceScope trace("methodCallFinished", "dispatch");
+    QOpcUaNodeImpl *node = m_handles.value(handle);
+    if (node)
+        emit node->methodCallFinished(methodNodeId, result, statusCode);
 }
 
-void QOpcUaClientImpl::handleBrowseFinished(uintptr_t handle, const QVector<QOpcUaReferenceDescription> &children, QOpcUa::UaStatusCode statusCode)
+void QOpcUaClientImpl::handleBrowseFinished(quint64 handle, const QVector<QOpcUaReferenceDescription> &children, QOpcUa::UaStatusCode statusCode)
 {
-    auto it = m_handles.constFind(handle);
-    if (it != m_handles.constEnd() && !it->isNull())
-        emit (*it)->browseFinished(children, statusCode);
+    QOpcUaTraceScope trace("browseFinished", "dispatch");
+    QOpcUaNodeImpl *node = m_handles.value(handle);
+    if (node)
+        emit node->browseFinished(children, statusCode);
+}
+
+void QOpcUaClientImpl::handleNodeRegistered(quint64 handle, const QString &registeredNodeId, QOpcUa::UaStatusCode statusCode)
+{
+    QOpcUaTraceScope trace("nodeRegistered", "dispatch");
+    QOpcUaNodeImpl *node = m_handles.value(handle);
+    if (node)
+        emit node->registerNodeFinished(registeredNodeId, statusCode);
+}
+
+void QOpcUaClientImpl::handleNodeUnregistered(quint64 handle, QOpcUa::UaStatusCode statusCode)
+{
+    QOpcUaTraceScope trace("nodeUnregistered", "dispatch");
+    QOpcUaNodeImpl *node = m_handles.value(handle);
+    if (node)
+        emit node->unregisterNodeFinished(statusCode);
+}
+
+void QOpcUaClientImpl::handleWriteNodeAttributesFinished(const QVector<QOpcUaWriteItem> &nodesToWrite, const QVector<QOpcUaWriteItemResult> &results,
+                                                         QOpcUa::UaStatusCode serviceResult)
+{
+    QOpcUaTraceScope trace("writeNodeAttributesFinished", "dispatch");
+    // Update the attribute caches of all node objects for the written node ids
+    for (int i = 0; i < results.size() && i < nodesToWrite.size(); ++i) {
+        const QOpcUaWriteItemResult &result = results.at(i);
+        // Partial writes of array values can't be applied to the cached value
+        if (!result.indexRange().isEmpty())
+            continue;
+        // A receiver may delete node objects, the handles are copied and looked up one by one
+        const QList<quint64> handles = m_handlesByNodeId.values(result.nodeId());
+        for (quint64 handle : handles) {
+            if (QOpcUaNodeImpl *node = m_handles.value(handle))
+                emit node->attributeWritten(result.attribute(), nodesToWrite.at(i).value(), result.statusCode());
+        }
+    }
+
+    emit writeNodeAttributesFinished(results, serviceResult);
 }
 
 QT_END_NAMESPACE
@@ -50,11 +50,17 @@
 
 #include <QtOpcUa/qopcuaclient.h>
 #include <QtOpcUa/qopcuaglobal.h>
+#include <private/qopcuahandletable_p.h>
 #include <private/qopcuanodeimpl_p.h>
 
+#include <QtCore/qatomic.h>
+#include <QtCore/qhash.h>
 #include <QtCore/qobject.h>
 #include <QtCore/qpointer.h>
 #include <QtCore/qset.h>
+#include <QtCore/qsharedpointer.h>
+#include <QtCore/qtimer.h>
+#include <QtCore/qvector.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -62,6 +68,9 @@ class QOpcUaNode;
 class QOpcUaClient;
 class QOpcUaBackend;
 class QOpcUaMonitoringParameters;
+class QOpcUaClientSideFilter;
+class QOpcUaHistoryBuffer;
+class QOpcUaClientStatisticsPrivate;
 
 class Q_OPCUA_EXPORT QOpcUaClientImpl : public QObject
 {
@@ -74,33 +83,124 @@ public:
     virtual void connectToEndpoint(const QUrl &url) = 0;
     virtual void disconnectFromEndpoint() = 0;
     virtual QOpcUaNode *node(const QString &nodeId) = 0;
+    virtual QOpcUaNode *node(const QOpcUaNodeId &nodeId);
     virtual QString backend() const = 0;
+    virtual bool readNodeAttributes(const QVector<QOpcUaReadItem> &nodesToRead) = 0;
+    virtual bool writeNodeAttributes(const QVector<QOpcUaWriteItem> &nodesToWrite) = 0;
+    virtual bool enableMonitoring(const QVector<QOpcUaNodeHandle> &nodes, QOpcUa::NodeAttributes attr,
+                                  const QOpcUaMonitoringParameters &settings) = 0;
+    virtual bool disableMonitoring(const QVector<QOpcUaNodeHandle> &nodes, QOpcUa::NodeAttributes attr) = 0;
+    virtual bool setTypedArraysEnabled(bool enabled) = 0;
+    virtual bool setMaxPendingRequests(int count);
+    virtual bool registerNodes(const QVector<QOpcUaNodeHandle> &nodes);
+    virtual bool unregisterNodes(const QVector<QOpcUaNodeHandle> &nodes);
+    virtual bool browseRecursive(const QString &rootNodeId, QOpcUa::ReferenceTypeId referenceType,
+                                 QOpcUa::NodeClasses nodeClassMask, int maxDepth) = 0;
 
-    void registerNode(QPointer<QOpcUaNodeImpl> obj);
-    void unregisterNode(QPointer<QOpcUaNodeImpl> obj);
+    void registerNode(QOpcUaNodeImpl *obj);
+    void unregisterNode(QOpcUaNodeImpl *obj);
 
-    void connectBackendWithClient(QOpcUaBackend *backend);
+    // Clients with several sessions aggregate the state of the backends themselves
+    enum class BackendState { Forward, Ignore };
+    void connectBackendWithClient(QOpcUaBackend *backend, BackendState state = BackendState::Forward);
+
+    void setHistoryBuffer(quint64 handle, QOpcUa::NodeAttribute attr, const QSharedPointer<QOpcUaHistoryBuffer> &buffer);
+    void removeHistoryBuffers(quint64 handle);
+
+    void setClientSideFilter(quint64 handle, QOpcUa::NodeAttribute attr, const QSharedPointer<QOpcUaClientSideFilter> &filter);
+    void removeClientSideFilters(quint64 handle);
+
+    void addStatistics(QOpcUaClientStatisticsPrivate *stats) const;
+
+    void setLazyValueDecodingEnabled(bool enabled);
+
+    void setDispatchInterval(int msec);
+
+    void setWriteCoalescingInterval(int msec);
+    bool coalesceWrite(QOpcUaNodeImpl *node, QOpcUa::NodeAttribute attr, const QVariant &value, QOpcUa::Types type,
+                       const QString &indexRange);
 
     QOpcUaClient *m_client;
 
+protected:
+    // Sends the writes of a coalescing window, backends which can write several nodes
+    // in one request reimplement this
+    virtual bool writeCoalesced(const QVector<QOpcUaCoalescedWrite> &writes);
+    QOpcUaNodeImpl *nodeForHandle(quint64 handle) const;
+
+    // Every coalesced write is completed with attributeWritten(), either by the backend or with statusCode
+    void flushCoalescedWrites();
+    void discardCoalescedWrites(QOpcUa::UaStatusCode statusCode);
+
+private:
+    void dispatchAttributeUpdates(const QVector<QOpcUaAttributeUpdate> &updates);
+    void conflateAttributeUpdate(const QOpcUaAttributeUpdate &update);
+
+    struct TraceHops {
+        quint64 base; // Flow ids of one backend start at base
+        QAtomicInteger<quint64> sent;
+        quint64 received;
+    };
+
+    template <typename Signal, typename... Args>
+    void connectBackendSignal(QOpcUaBackend *backend, Signal signal, void (QOpcUaClientImpl::*slot)(Args...),
+                              const char *name, const QSharedPointer<TraceHops> &hops);
+
 private Q_SLOTS:
-    void handleAttributesRead(uintptr_t handle, QVector<QOpcUaReadResult> attr, QOpcUa::UaStatusCode serviceResult);
-    void handleAttributeWritten(uintptr_t handle, QOpcUa::NodeAttribute attr, const QVariant &value, QOpcUa::UaStatusCode statusCode);
-    void handleAttributeUpdated(uintptr_t handle, const QOpcUaReadResult &value);
-    void handleMonitoringEnableDisable(uintptr_t handle, QOpcUa::NodeAttribute attr, bool subscribe, QOpcUaMonitoringParameters status);
-    void handleMonitoringStatusChanged(uintptr_t handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameters items,
+    void handleAttributesRead(quint64 handle, QVector<QOpcUaReadResult> attr, QOpcUa::UaStatusCode serviceResult);
+    void handleAttributeWritten(quint64 handle, QOpcUa::NodeAttribute attr, const QVariant &value, QOpcUa::UaStatusCode statusCode);
+    void handleAttributeUpdated(quint64 handle, const QOpcUaReadResult &value);
+    void handleAttributesUpdated(const QVector<QOpcUaAttributeUpdate> &updates);
+    void handleMonitoringEnableDisable(quint64 handle, QOpcUa::NodeAttribute attr, bool subscribe, QOpcUaMonitoringParameters status);
+    void handleMonitoringStatusChanged(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameters items,
                                  QOpcUaMonitoringParameters param);
-    void handleMethodCallFinished(uintptr_t handle, QString methodNodeId, QVariant result, QOpcUa::UaStatusCode statusCode);
-    void handleBrowseFinished(uintptr_t handle, const QVector<QOpcUaReferenceDescription> &children, QOpcUa::UaStatusCode statusCode);
+    void handleMethodCallFinished(quint64 handle, QString methodNodeId, QVariant result, QOpcUa::UaStatusCode statusCode);
+    void handleBrowseFinished(quint64 handle, const QVector<QOpcUaReferenceDescription> &children, QOpcUa::UaStatusCode statusCode);
+    void handleNodeRegistered(quint64 handle, const QString &registeredNodeId, QOpcUa::UaStatusCode statusCode);
+    void handleNodeUnregistered(quint64 handle, QOpcUa::UaStatusCode statusCode);
+
+protected Q_SLOTS:
+    void handleWriteNodeAttributesFinished(const QVector<QOpcUaWriteItem> &nodesToWrite, const QVector<QOpcUaWriteItemResult> &results,
+                                           QOpcUa::UaStatusCode serviceResult);
 
 signals:
     void connected();
     void disconnected();
     void stateAndOrErrorChanged(QOpcUaClient::ClientState state,
                                 QOpcUaClient::ClientError error);
+    void readNodeAttributesFinished(QVector<QOpcUaReadItemResult> results, QOpcUa::UaStatusCode serviceResult);
+    void writeNodeAttributesFinished(QVector<QOpcUaWriteItemResult> results, QOpcUa::UaStatusCode serviceResult);
+    void dataChangeBatch(QVector<QOpcUaReadItemResult> changes);
+    void browseRecursiveResultsAvailable(QString rootNodeId, QVector<QOpcUaReferenceDescription> references);
+    void browseRecursiveFinished(QString rootNodeId, QOpcUa::UaStatusCode statusCode);
 private:
     Q_DISABLE_COPY(QOpcUaClientImpl)
-    QHash<uintptr_t, QPointer<QOpcUaNodeImpl>> m_handles;
+    // Node objects are unregistered in their destructor, the generation check of the handle
+    // drops results which arrive from the backend thread after that.
+    QOpcUaHandleTable<QOpcUaNodeImpl *> m_handles;
+    // Node id -> handles of the node objects, the results of batch writes update their attribute caches
+    QMultiHash<QString, quint64> m_handlesByNodeId;
+    // Backends with several sessions connect one backend object per session
+    QVector<QOpcUaBackend *> m_backends;
+    // Results emitted by the backends which wait in the event queue of the client thread
+    QAtomicInt m_pendingEvents;
+    bool m_lazyValueDecodingEnabled;
+
+    // Conflating dispatcher, keeps the newest value per handle and attribute until the next tick
+    int m_dispatchInterval;
+    QTimer m_dispatchTimer;
+    QVector<QOpcUaAttributeUpdate> m_conflatedUpdates;
+    QHash<QPair<quint64, uint>, int> m_conflatedIndex; // Handle, attribute -> index in m_conflatedUpdates
+    quint64 m_conflatedValues;
+
+    // Write coalescing, keeps the newest value per handle, attribute and index range until the window ends
+    typedef QPair<QPair<quint64, uint>, QString> CoalescingKey;
+    int m_writeCoalescingInterval;
+    QTimer m_writeCoalescingTimer;
+    QVector<QOpcUaCoalescedWrite> m_pendingWrites;
+    QHash<CoalescingKey, int> m_pendingWriteIndex; // Key -> index in m_pendingWrites
+    QVector<QOpcUaCoalescedWrite> m_supersededWrites;
+    quint64 m_coalescedWrites;
 };
 
 inline uint qHash(const QPointer<QOpcUaNodeImpl>& n)
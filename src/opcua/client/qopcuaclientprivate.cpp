@@ -34,9 +34,16 @@
 **
 ****************************************************************************/
 
+#include <private/qopcuabackend_p.h>
 #include <private/qopcuaclient_p.h>
+#include <private/qopcuaclientstatistics_p.h>
+#include <private/qopcuastatisticscollector_p.h>
 
+#include <QtCore/qcryptographichash.h>
+#include <QtCore/qdir.h>
+#include <QtCore/qelapsedtimer.h>
 #include <QtCore/qloggingcategory.h>
+#include <QtCore/qmetaobject.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -47,16 +54,53 @@ QOpcUaClientPrivate::QOpcUaClientPrivate(QOpcUaClientImpl *impl)
     , m_impl(impl)
     , m_state(QOpcUaClient::Disconnected)
     , m_error(QOpcUaClient::NoError)
+    , m_typedArraysEnabled(false)
+    , m_lazyValueDecodingEnabled(false)
+    , m_maxPendingRequests(QOpcUaBackend::defaultMaxPendingRequests())
+    , m_dispatchInterval(0)
+    , m_writeCoalescingInterval(0)
+    , m_pendingCacheChecks(0)
 {
     // callback from client implementation
     QObject::connect(m_impl.data(), &QOpcUaClientImpl::stateAndOrErrorChanged,
                     [this](QOpcUaClient::ClientState state, QOpcUaClient::ClientError error) {
         setStateAndError(state, error);
     });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::readNodeAttributesFinished,
+                    [this](QVector<QOpcUaReadItemResult> results, QOpcUa::UaStatusCode serviceResult) {
+        Q_Q(QOpcUaClient);
+        emit q->readNodeAttributesFinished(results, serviceResult);
+    });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::writeNodeAttributesFinished,
+                    [this](QVector<QOpcUaWriteItemResult> results, QOpcUa::UaStatusCode serviceResult) {
+        Q_Q(QOpcUaClient);
+        emit q->writeNodeAttributesFinished(results, serviceResult);
+    });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::dataChangeBatch,
+                    [this](QVector<QOpcUaReadItemResult> changes) {
+        Q_Q(QOpcUaClient);
+        emit q->dataChangeBatch(changes);
+    });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::browseRecursiveResultsAvailable,
+                    [this](QString rootNodeId, QVector<QOpcUaReferenceDescription> references) {
+        Q_Q(QOpcUaClient);
+        emit q->browseRecursiveResultsAvailable(rootNodeId, references);
+    });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::browseRecursiveFinished,
+                    [this](QString rootNodeId, QOpcUa::UaStatusCode statusCode) {
+        Q_Q(QOpcUaClient);
+        emit q->browseRecursiveFinished(rootNodeId, statusCode);
+    });
 }
 
 QOpcUaClientPrivate::~QOpcUaClientPrivate()
 {
+    closeAddressSpaceCache();
 }
 
 void QOpcUaClientPrivate::connectToEndpoint(const QUrl &url)
@@ -78,6 +122,8 @@ void QOpcUaClientPrivate::disconnectFromEndpoint()
     }
 
     setStateAndError(QOpcUaClient::Closing);
+    // The writes are queued to the backends before the disconnect and complete with the result of the server
+    m_impl->flushCoalescedWrites();
     m_impl->disconnectFromEndpoint();
 }
 
@@ -115,6 +161,11 @@ void QOpcUaClientPrivate::setStateAndError(QOpcUaClient::ClientState state,
     if (stateChanged) {
         emit q->stateChanged(m_state);
 
+        if (m_state == QOpcUaClient::Connected)
+            checkAddressSpaceCache();
+        else if (m_state == QOpcUaClient::Disconnected)
+            closeAddressSpaceCache();
+
         if (m_state == QOpcUaClient::Connected)
             emit q->connected();
         else if (m_state == QOpcUaClient::Disconnected)
@@ -125,6 +176,8 @@ void QOpcUaClientPrivate::setStateAndError(QOpcUaClient::ClientState state,
     // array if there is no active session. This could invalidate the cached namespaces table.
     if (state == QOpcUaClient::Disconnected) {
         m_namespaceArray.clear();
+        // Writes of a lost connection can't be sent anymore
+        m_impl->discardCoalescedWrites(QOpcUa::UaStatusCode::BadDisconnect);
     }
 }
 
@@ -167,4 +220,118 @@ void QOpcUaClientPrivate::namespaceArrayUpdated(QOpcUa::NodeAttributes attr)
     emit q->namespaceArrayUpdated(m_namespaceArray);
 }
 
+void QOpcUaClientPrivate::checkAddressSpaceCache()
+{
+    m_cacheCheckNodes.clear();
+    m_pendingCacheChecks = 0;
+
+    if (m_addressSpaceCacheDirectory.isEmpty())
+        return;
+
+    // Server_ServerArray starts with the application URI of the server
+    QStringList nodeIds({QStringLiteral("ns=0;i=2254"), QStringLiteral("ns=0;i=2255")});
+    if (!m_addressSpaceCacheVersionNodeId.isEmpty())
+        nodeIds.append(m_addressSpaceCacheVersionNodeId);
+
+    for (const QString &nodeId : qAsConst(nodeIds)) {
+        QSharedPointer<QOpcUaNode> node(m_impl->node(nodeId));
+        if (!node) {
+            qCWarning(QT_OPCUA) << "Unable to check the address space cache, invalid node id" << nodeId;
+            m_cacheCheckNodes.clear();
+            return;
+        }
+        QObject::connect(node.data(), &QOpcUaNode::attributeRead, [this](QOpcUa::NodeAttributes) {
+            if (--m_pendingCacheChecks == 0)
+                addressSpaceCacheCheckFinished();
+        });
+        m_cacheCheckNodes.push_back(node);
+    }
+
+    m_pendingCacheChecks = m_cacheCheckNodes.size();
+    for (const QSharedPointer<QOpcUaNode> &node : qAsConst(m_cacheCheckNodes)) {
+        if (!node->readAttributes(QOpcUa::NodeAttribute::Value)) {
+            qCWarning(QT_OPCUA) << "Unable to check the address space cache, the cache is not used";
+            m_pendingCacheChecks = 0;
+            return;
+        }
+    }
+}
+
+void QOpcUaClientPrivate::addressSpaceCacheCheckFinished()
+{
+    for (const QSharedPointer<QOpcUaNode> &node : qAsConst(m_cacheCheckNodes)) {
+        if (node->attributeError(QOpcUa::NodeAttribute::Value) != QOpcUa::UaStatusCode::Good) {
+            qCWarning(QT_OPCUA) << "Unable to read" << node->nodeId() << "to check the address space cache, the cache is not used";
+            return;
+        }
+    }
+
+    const QVariant serverArray = m_cacheCheckNodes.at(0)->attribute(QOpcUa::NodeAttribute::Value);
+    const QString applicationUri = serverArray.type() == QVariant::List ? serverArray.toList().value(0).toString()
+                                                                        : serverArray.toString();
+    if (applicationUri.isEmpty()) {
+        qCWarning(QT_OPCUA) << "The server did not report an application URI, the address space cache is not used";
+        return;
+    }
+
+    QStringList namespaces;
+    for (const QVariant &ns : m_cacheCheckNodes.at(1)->attribute(QOpcUa::NodeAttribute::Value).toList())
+        namespaces.append(ns.toString());
+
+    const QString modelVersion = m_cacheCheckNodes.size() > 2 ?
+                m_cacheCheckNodes.at(2)->attribute(QOpcUa::NodeAttribute::Value).toString() : QString();
+
+    const QDir directory(m_addressSpaceCacheDirectory);
+    if (!directory.mkpath(QStringLiteral("."))) {
+        qCWarning(QT_OPCUA) << "Unable to create the address space cache directory" << m_addressSpaceCacheDirectory;
+        return;
+    }
+
+    // One file per server, the key stored in the file detects changes of the address space
+    const QString fileName = directory.filePath(QString::fromLatin1(
+            QCryptographicHash::hash(applicationUri.toUtf8(), QCryptographicHash::Sha1).toHex()) + QStringLiteral(".cache"));
+
+    m_addressSpaceCache.reset(new QOpcUaAddressSpaceCache);
+    const bool reused = m_addressSpaceCache->open(fileName, QOpcUaAddressSpaceCache::cacheKey(applicationUri, namespaces, modelVersion));
+
+    Q_Q(QOpcUaClient);
+    emit q->addressSpaceCacheReady(reused);
+}
+
+void QOpcUaClientPrivate::closeAddressSpaceCache()
+{
+    m_cacheCheckNodes.clear();
+    m_pendingCacheChecks = 0;
+
+    if (m_addressSpaceCache) {
+        m_addressSpaceCache->save();
+        m_addressSpaceCache.reset();
+    }
+}
+
+QOpcUaClientStatistics QOpcUaClientPrivate::statistics() const
+{
+    QOpcUaClientStatistics result;
+    QOpcUaClientStatisticsPrivate *stats = result.d_ptr.data();
+
+    m_impl->addStatistics(stats);
+    stats->conversionCount = QOpcUaStatisticsCollector::conversionCount();
+    stats->conversionTime = QOpcUaStatisticsCollector::conversionTime();
+
+    // The rates are calculated between two snapshots by the caller
+    QElapsedTimer timer;
+    timer.start();
+    stats->timestamp = timer.msecsSinceReference();
+
+    return result;
+}
+
+// The client implementation only builds the data change batch if it has receivers
+bool QOpcUaClientPrivate::isDataChangeBatchConnected() const
+{
+    Q_Q(const QOpcUaClient);
+    static const QMetaMethod dataChangeBatchSignal = QMetaMethod::fromSignal(&QOpcUaClient::dataChangeBatch);
+    return q->isSignalConnected(dataChangeBatchSignal);
+}
+
 QT_END_NAMESPACE
@@ -0,0 +1,277 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuaclientsidefilter_p.h"
+#include "qopcuastatisticscollector_p.h"
+
+#include <QtCore/qvariant.h>
+
+#include <cmath>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaClientSideFilter
+    \internal
+
+    Decides on the thread of the backend if a data change is delivered to the node.
+    A value which arrives less than the minimum interval after the last delivered value is deferred,
+    only the newest deferred value is delivered when the interval has expired. A value is suppressed
+    if no element of a numeric value differs from the last delivered value by more than the deadband.
+    Status changes and the first value are always delivered.
+
+    The percent deadband refers to the engineering units range. If no valid range has been set,
+    it refers to the magnitude of the last delivered value.
+*/
+
+QOpcUaClientSideFilter::QOpcUaClientSideFilter(const QOpcUaMonitoringParameters::DataChangeFilter &filter,
+                                               int minimumInterval, const QOpcUa::QRange &euRange)
+    : m_filter(filter)
+    , m_minimumInterval(qMax(0, minimumInterval))
+    , m_euRange(euRange)
+    , m_hasLastValue(false)
+    , m_lastStatus(QOpcUa::UaStatusCode::Good)
+    , m_lastNumeric(false)
+    , m_hasDeferredValue(false)
+    , m_suppressed(0)
+{
+}
+
+QOpcUaMonitoringParameters::DataChangeFilter QOpcUaClientSideFilter::filter() const
+{
+    return m_filter;
+}
+
+int QOpcUaClientSideFilter::minimumInterval() const
+{
+    return m_minimumInterval;
+}
+
+/*!
+    Decides if \a value is delivered now, suppressed or deferred until the minimum interval has expired.
+    Suppressed values are counted in \a statistics.
+*/
+QOpcUaClientSideFilter::Decision QOpcUaClientSideFilter::accept(const QOpcUaReadResult &value, QOpcUaStatisticsCollector &statistics)
+{
+    QMutexLocker locker(&m_mutex);
+
+    if (m_hasLastValue && value.statusCode == m_lastStatus) {
+        if (m_minimumInterval && m_lastDelivery.isValid() && m_lastDelivery.elapsed() < m_minimumInterval) {
+            // Only the newest value of a burst is kept, the deadband is checked when it is taken
+            const bool scheduled = m_hasDeferredValue;
+            if (scheduled)
+                suppress(statistics);
+            m_deferredValue = value;
+            m_hasDeferredValue = true;
+            return scheduled ? Decision::Suppress : Decision::Defer;
+        }
+    }
+
+    // The deferred value is older than the current one
+    discardDeferredValue(statistics);
+
+    if (!passesDeadband(value)) {
+        suppress(statistics);
+        return Decision::Suppress;
+    }
+    return Decision::Deliver;
+}
+
+/*!
+    Returns the time in milliseconds until a deferred value can be taken.
+*/
+int QOpcUaClientSideFilter::remainingInterval() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_lastDelivery.isValid() ? static_cast<int>(qMax<qint64>(0, m_minimumInterval - m_lastDelivery.elapsed())) : 0;
+}
+
+/*!
+    Returns \c true and sets \a value if a deferred value must be delivered now.
+    \a remainingInterval is set to the time until the deferred value can be taken if the interval
+    has not expired yet, and to -1 if there is nothing left to deliver.
+*/
+bool QOpcUaClientSideFilter::takeDeferredValue(QOpcUaReadResult *value, int *remainingInterval,
+                                               QOpcUaStatisticsCollector &statistics)
+{
+    QMutexLocker locker(&m_mutex);
+
+    *remainingInterval = -1;
+    if (!m_hasDeferredValue)
+        return false;
+
+    const qint64 remaining = m_minimumInterval - m_lastDelivery.elapsed();
+    if (remaining > 0) {
+        *remainingInterval = static_cast<int>(remaining);
+        return false;
+    }
+
+    const QOpcUaReadResult deferred = m_deferredValue;
+    m_deferredValue = QOpcUaReadResult();
+    m_hasDeferredValue = false;
+
+    if (!passesDeadband(deferred)) {
+        suppress(statistics);
+        return false;
+    }
+
+    *value = deferred;
+    return true;
+}
+
+// Updates the last delivered value if the value passes, the caller holds the mutex
+bool QOpcUaClientSideFilter::passesDeadband(const QOpcUaReadResult &value)
+{
+    const bool useDeadband = m_filter.deadbandType != QOpcUaMonitoringParameters::DataChangeFilter::DeadbandType::None;
+
+    QVector<double> values;
+    // Deadbands only apply to numeric values, encoded values are decoded for the comparison
+    const bool numeric = useDeadband && toDoubles(value.decodedValue(), &values);
+
+    if (m_hasLastValue && value.statusCode == m_lastStatus && numeric && m_lastNumeric
+            && values.size() == m_lastValues.size() && !exceedsDeadband(values)) {
+        return false;
+    }
+
+    m_hasLastValue = true;
+    m_lastStatus = value.statusCode;
+    m_lastNumeric = numeric;
+    m_lastValues = values;
+    m_lastDelivery.start();
+    return true;
+}
+
+void QOpcUaClientSideFilter::discardDeferredValue(QOpcUaStatisticsCollector &statistics)
+{
+    if (!m_hasDeferredValue)
+        return;
+
+    m_deferredValue = QOpcUaReadResult();
+    m_hasDeferredValue = false;
+    suppress(statistics);
+}
+
+void QOpcUaClientSideFilter::suppress(QOpcUaStatisticsCollector &statistics)
+{
+    m_suppressed.fetchAndAddRelaxed(1);
+    statistics.valueSuppressed();
+}
+
+quint64 QOpcUaClientSideFilter::suppressedCount() const
+{
+    return m_suppressed.load();
+}
+
+// Arrays exceed the deadband if any element exceeds it
+bool QOpcUaClientSideFilter::exceedsDeadband(const QVector<double> &values) const
+{
+    const bool percent = m_filter.deadbandType == QOpcUaMonitoringParameters::DataChangeFilter::DeadbandType::Percent;
+    const double range = m_euRange.high - m_euRange.low;
+
+    for (int i = 0; i < values.size(); ++i) {
+        double limit = m_filter.deadbandValue;
+        if (percent)
+            limit = m_filter.deadbandValue / 100.0 * (range > 0 ? range : std::abs(m_lastValues.at(i)));
+        if (std::abs(values.at(i) - m_lastValues.at(i)) > limit)
+            return true;
+    }
+    return false;
+}
+
+template <typename T>
+static bool qt_typedArrayToDoubles(const QVariant &value, QVector<double> *result)
+{
+    if (value.userType() != qMetaTypeId<QVector<T>>())
+        return false;
+
+    const QVector<T> array = value.value<QVector<T>>();
+    result->reserve(array.size());
+    for (const T &element : array)
+        result->push_back(static_cast<double>(element));
+    return true;
+}
+
+static bool qt_isNumericScalar(const QVariant &value)
+{
+    switch (static_cast<QMetaType::Type>(value.userType())) {
+    case QMetaType::Char:
+    case QMetaType::SChar:
+    case QMetaType::UChar:
+    case QMetaType::Short:
+    case QMetaType::UShort:
+    case QMetaType::Int:
+    case QMetaType::UInt:
+    case QMetaType::Long:
+    case QMetaType::ULong:
+    case QMetaType::LongLong:
+    case QMetaType::ULongLong:
+    case QMetaType::Float:
+    case QMetaType::Double:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Converts numeric scalars, QVariantLists of numeric scalars and typed arrays
+bool QOpcUaClientSideFilter::toDoubles(const QVariant &value, QVector<double> *result)
+{
+    if (qt_isNumericScalar(value)) {
+        result->push_back(value.toDouble());
+        return true;
+    }
+
+    if (value.type() == QVariant::List) {
+        const QVariantList list = value.toList();
+        result->reserve(list.size());
+        for (const QVariant &element : list) {
+            if (!qt_isNumericScalar(element)) {
+                result->clear();
+                return false;
+            }
+            result->push_back(element.toDouble());
+        }
+        return true;
+    }
+
+    return qt_typedArrayToDoubles<double>(value, result) || qt_typedArrayToDoubles<float>(value, result)
+            || qt_typedArrayToDoubles<qint64>(value, result) || qt_typedArrayToDoubles<quint64>(value, result)
+            || qt_typedArrayToDoubles<qint32>(value, result) || qt_typedArrayToDoubles<quint32>(value, result)
+            || qt_typedArrayToDoubles<qint16>(value, result) || qt_typedArrayToDoubles<quint16>(value, result)
+            || qt_typedArrayToDoubles<qint8>(value, result) || qt_typedArrayToDoubles<quint8>(value, result);
+}
+
+QT_END_NAMESPACE
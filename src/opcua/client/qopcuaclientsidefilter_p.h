@@ -0,0 +1,119 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUACLIENTSIDEFILTER_P_H
+#define QOPCUACLIENTSIDEFILTER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtOpcUa/qopcuamonitoringparameters.h>
+#include <QtOpcUa/qopcuatype.h>
+#include <private/qopcuanodeimpl_p.h>
+
+#include <QtCore/qatomic.h>
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaStatisticsCollector;
+
+// Deadband and rate limit for the data changes of one monitored attribute, applied by the thread
+// which delivers the data changes before they are queued to the client thread.
+// The newest value which arrives during the minimum interval is deferred and taken by the backend
+// thread when the interval has expired. The mutex protects the state of the last delivered and the
+// deferred value, it is only contended if the SDK delivers the data changes in its own thread.
+// The counter of suppressed values is read by the client thread.
+class Q_OPCUA_EXPORT QOpcUaClientSideFilter
+{
+public:
+    enum class Decision {
+        Deliver,
+        Suppress,
+        Defer // The value is the first deferred value of the interval, the backend schedules its delivery
+    };
+
+    QOpcUaClientSideFilter(const QOpcUaMonitoringParameters::DataChangeFilter &filter, int minimumInterval,
+                           const QOpcUa::QRange &euRange);
+
+    QOpcUaMonitoringParameters::DataChangeFilter filter() const;
+    int minimumInterval() const;
+
+    Decision accept(const QOpcUaReadResult &value, QOpcUaStatisticsCollector &statistics);
+    int remainingInterval() const;
+    bool takeDeferredValue(QOpcUaReadResult *value, int *remainingInterval, QOpcUaStatisticsCollector &statistics);
+    quint64 suppressedCount() const;
+
+private:
+    Q_DISABLE_COPY(QOpcUaClientSideFilter)
+
+    bool passesDeadband(const QOpcUaReadResult &value);
+    void discardDeferredValue(QOpcUaStatisticsCollector &statistics);
+    void suppress(QOpcUaStatisticsCollector &statistics);
+    bool exceedsDeadband(const QVector<double> &values) const;
+    static bool toDoubles(const QVariant &value, QVector<double> *result);
+
+    QOpcUaMonitoringParameters::DataChangeFilter m_filter;
+    int m_minimumInterval; // ms
+    QOpcUa::QRange m_euRange;
+
+    // Last delivered value, only used by the delivering thread
+    bool m_hasLastValue;
+    QOpcUa::UaStatusCode m_lastStatus;
+    bool m_lastNumeric;
+    QVector<double> m_lastValues;
+    QElapsedTimer m_lastDelivery;
+
+    bool m_hasDeferredValue;
+    QOpcUaReadResult m_deferredValue;
+    mutable QMutex m_mutex;
+
+    QAtomicInteger<quint64> m_suppressed;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUACLIENTSIDEFILTER_P_H
@@ -0,0 +1,269 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuaclientstatistics.h"
+#include "qopcuaclientstatistics_p.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaClientStatistics
+    \inmodule QtOpcUa
+    \brief A snapshot of the request and notification statistics of a client
+
+    This class is returned by \l QOpcUaClient::statistics(). The counters are collected
+    by the backend with atomic operations and are always enabled.
+
+    Latencies are measured from the moment the backend starts to process a request
+    until the response has been received. They are sorted into a histogram with the
+    buckets returned by \l latencyBucketLimits().
+
+    Publish responses are handled by the SDKs. They are counted if the SDK reports
+    them, but no latency is recorded. The freeopcua backend only reports the notifications.
+*/
+
+/*!
+    \enum QOpcUaClientStatistics::Service
+
+    The services for which statistics are collected.
+
+    \value Read Read service, used by read requests of nodes and \l QOpcUaClient::readNodeAttributes().
+    \value Write Write service, used by write requests of nodes and \l QOpcUaClient::writeNodeAttributes().
+    \value Browse Browse and BrowseNext services.
+    \value Call Call service.
+    \value CreateMonitoredItems CreateMonitoredItems service.
+    \value Publish Publish responses which contained notifications.
+*/
+
+static const int latencyLimits[] = {100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000,
+                                     100000, 250000, 500000, 1000000};
+Q_STATIC_ASSERT(sizeof(latencyLimits) / sizeof(latencyLimits[0]) + 1 == QOpcUaClientStatisticsPrivate::LatencyBucketCount);
+
+/*!
+    Creates an empty QOpcUaClientStatistics object.
+*/
+QOpcUaClientStatistics::QOpcUaClientStatistics()
+    : d_ptr(new QOpcUaClientStatisticsPrivate())
+{}
+
+/*!
+    Creates a copy of the QOpcUaClientStatistics object \a other.
+*/
+QOpcUaClientStatistics::QOpcUaClientStatistics(const QOpcUaClientStatistics &other)
+    : d_ptr(other.d_ptr)
+{}
+
+/*!
+    Assigns the value of \a other to this object.
+*/
+QOpcUaClientStatistics &QOpcUaClientStatistics::operator=(const QOpcUaClientStatistics &other)
+{
+    d_ptr = other.d_ptr;
+    return *this;
+}
+
+/*!
+    Destructor for QOpcUaClientStatistics.
+*/
+QOpcUaClientStatistics::~QOpcUaClientStatistics()
+{}
+
+/*!
+    Returns the number of finished requests for \a service.
+*/
+quint64 QOpcUaClientStatistics::requestCount(Service service) const
+{
+    return d_ptr->services[int(service)].requests;
+}
+
+/*!
+    Returns the number of requests for \a service which have been started but not yet finished.
+*/
+int QOpcUaClientStatistics::inFlightRequests(Service service) const
+{
+    return d_ptr->services[int(service)].inFlight;
+}
+
+/*!
+    Returns the number of requests for all services which have been started but not yet finished.
+*/
+int QOpcUaClientStatistics::inFlightRequests() const
+{
+    int inFlight = 0;
+    for (const auto &service : d_ptr->services)
+        inFlight += service.inFlight;
+    return inFlight;
+}
+
+/*!
+    Returns the upper limits of the latency histogram buckets in microseconds.
+    The histogram contains one additional bucket for latencies above the last limit.
+*/
+QVector<int> QOpcUaClientStatistics::latencyBucketLimits()
+{
+    QVector<int> limits;
+    limits.reserve(QOpcUaClientStatisticsPrivate::LatencyBucketCount - 1);
+    for (int limit : latencyLimits)
+        limits.push_back(limit);
+    return limits;
+}
+
+/*!
+    Returns the number of requests for \a service per latency bucket.
+
+    \sa latencyBucketLimits()
+*/
+QVector<quint64> QOpcUaClientStatistics::latencyHistogram(Service service) const
+{
+    const QOpcUaClientStatisticsPrivate::ServiceStatistics &stats = d_ptr->services[int(service)];
+    QVector<quint64> histogram;
+    histogram.reserve(QOpcUaClientStatisticsPrivate::LatencyBucketCount);
+    for (quint64 count : stats.latencyBuckets)
+        histogram.push_back(count);
+    return histogram;
+}
+
+/*!
+    Returns the average latency of the requests for \a service in milliseconds
+    or 0 if no latency has been measured.
+*/
+double QOpcUaClientStatistics::averageLatency(Service service) const
+{
+    const QOpcUaClientStatisticsPrivate::ServiceStatistics &stats = d_ptr->services[int(service)];
+    quint64 measured = 0;
+    for (quint64 count : stats.latencyBuckets)
+        measured += count;
+    return measured ? stats.totalLatency / 1e6 / measured : 0;
+}
+
+/*!
+    \typedef QOpcUaClientStatistics::SubscriptionKey
+
+    Identifies a subscription by the index of the session it belongs to and its subscription id.
+    Subscription ids are only unique per session. Clients with a single session use the index 0.
+*/
+
+/*!
+    Returns the number of data change notifications received per session and subscription id.
+*/
+QHash<QOpcUaClientStatistics::SubscriptionKey, quint64> QOpcUaClientStatistics::notificationCounts() const
+{
+    return d_ptr->notificationCounts;
+}
+
+/*!
+    Returns the number of data change notifications per second, session and subscription id
+    between \a previous and this snapshot. \a previous must have been taken earlier from the same client.
+
+    The snapshots don't depend on each other, every observer keeps its own previous snapshot.
+*/
+QHash<QOpcUaClientStatistics::SubscriptionKey, double> QOpcUaClientStatistics::notificationRates(const QOpcUaClientStatistics &previous) const
+{
+    QHash<SubscriptionKey, double> rates;
+    const double elapsedSeconds = (d_ptr->timestamp - previous.d_ptr->timestamp) / 1000.0;
+    for (auto it = d_ptr->notificationCounts.constBegin(); it != d_ptr->notificationCounts.constEnd(); ++it) {
+        // The counter starts again if a subscription id has been reused
+        const quint64 before = previous.d_ptr->notificationCounts.value(it.key());
+        const quint64 delta = it.value() >= before ? it.value() - before : it.value();
+        rates.insert(it.key(), elapsedSeconds > 0 ? delta / elapsedSeconds : 0.0);
+    }
+    return rates;
+}
+
+/*!
+    Returns the number of results and notifications which have been sent by the backend
+    thread and wait to be processed in the thread of the client.
+*/
+int QOpcUaClientStatistics::pendingEvents() const
+{
+    return d_ptr->pendingEvents;
+}
+
+/*!
+    Returns the number of data changes which have been replaced by a newer value of the same
+    attribute before they were dispatched.
+
+    \sa QOpcUaClient::setDispatchInterval()
+*/
+quint64 QOpcUaClientStatistics::conflatedValues() const
+{
+    return d_ptr->conflatedValues;
+}
+
+/*!
+    Returns the number of writes which have been replaced by a newer write to the same attribute
+    before they were sent.
+
+    \sa QOpcUaClient::setWriteCoalescingInterval()
+*/
+quint64 QOpcUaClientStatistics::coalescedWrites() const
+{
+    return d_ptr->coalescedWrites;
+}
+
+/*!
+    Returns the number of values which have been converted between the SDK types and Qt types.
+    The value converters are shared by all clients, the counter includes the conversions of
+    all clients in the process.
+*/
+quint64 QOpcUaClientStatistics::conversionCount() const
+{
+    return d_ptr->conversionCount;
+}
+
+/*!
+    Returns the time in nanoseconds which has been spent in the value converters by all clients
+    in the process.
+
+    \sa conversionCount()
+*/
+qint64 QOpcUaClientStatistics::conversionTime() const
+{
+    return d_ptr->conversionTime;
+}
+
+/*!
+    Returns the number of data changes which have been discarded by the client side filters
+    of all nodes of the client.
+
+    \sa QOpcUaNode::setClientSideFilter()
+*/
+quint64 QOpcUaClientStatistics::suppressedValues() const
+{
+    return d_ptr->suppressedValues;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,104 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUACLIENTSTATISTICS_H
+#define QOPCUACLIENTSTATISTICS_H
+
+#include <QtOpcUa/qopcuaglobal.h>
+
+#include <QtCore/qhash.h>
+#include <QtCore/qmetatype.h>
+#include <QtCore/qpair.h>
+#include <QtCore/qshareddata.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaClientStatisticsPrivate;
+
+class Q_OPCUA_EXPORT QOpcUaClientStatistics
+{
+public:
+    enum class Service {
+        Read,
+        Write,
+        Browse,
+        Call,
+        CreateMonitoredItems,
+        Publish
+    };
+
+    typedef QPair<int, quint32> SubscriptionKey; // Session index and subscription id
+
+    QOpcUaClientStatistics();
+    QOpcUaClientStatistics(const QOpcUaClientStatistics &other);
+    QOpcUaClientStatistics &operator=(const QOpcUaClientStatistics &other);
+
+    ~QOpcUaClientStatistics();
+
+    quint64 requestCount(Service service) const;
+    int inFlightRequests(Service service) const;
+    int inFlightRequests() const;
+
+    static QVector<int> latencyBucketLimits();
+    QVector<quint64> latencyHistogram(Service service) const;
+    double averageLatency(Service service) const;
+
+    QHash<SubscriptionKey, quint64> notificationCounts() const;
+    QHash<SubscriptionKey, double> notificationRates(const QOpcUaClientStatistics &previous) const;
+
+    int pendingEvents() const;
+    quint64 conflatedValues() const;
+    quint64 coalescedWrites() const;
+
+    quint64 conversionCount() const;
+    qint64 conversionTime() const;
+
+    quint64 suppressedValues() const;
+
+private:
+    QSharedDataPointer<QOpcUaClientStatisticsPrivate> d_ptr;
+
+    friend class QOpcUaClientPrivate;
+};
+
+Q_DECLARE_TYPEINFO(QOpcUaClientStatistics, Q_MOVABLE_TYPE);
+
+QT_END_NAMESPACE
+
+Q_DECLARE_METATYPE(QOpcUaClientStatistics)
+
+#endif // QOPCUACLIENTSTATISTICS_H
@@ -0,0 +1,86 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUACLIENTSTATISTICS_P_H
+#define QOPCUACLIENTSTATISTICS_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtOpcUa/qopcuaclientstatistics.h>
+
+#include <QtCore/qhash.h>
+#include <QtCore/qshareddata.h>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaClientStatisticsPrivate : public QSharedData
+{
+public:
+    enum {
+        ServiceCount = int(QOpcUaClientStatistics::Service::Publish) + 1,
+        LatencyBucketCount = 14 // 13 limits and one bucket for larger values
+    };
+
+    struct ServiceStatistics {
+        quint64 requests = 0;
+        int inFlight = 0;
+        quint64 totalLatency = 0; // ns, only for requests with a measured latency
+        quint64 latencyBuckets[LatencyBucketCount] = {};
+    };
+
+    ServiceStatistics services[ServiceCount];
+    QHash<QOpcUaClientStatistics::SubscriptionKey, quint64> notificationCounts;
+    qint64 timestamp = 0; // Monotonic time in milliseconds when the snapshot has been taken
+    int pendingEvents = 0;
+    quint64 conflatedValues = 0;
+    quint64 coalescedWrites = 0;
+    quint64 conversionCount = 0;
+    qint64 conversionTime = 0;
+    quint64 suppressedValues = 0;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUACLIENTSTATISTICS_P_H
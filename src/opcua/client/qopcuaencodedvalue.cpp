@@ -0,0 +1,86 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuaencodedvalue_p.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaEncodedValue
+    \internal
+
+    Holds a value which has been received by a backend in the representation of its SDK.
+    The value is decoded by the first call of \l value() in the thread which accesses it
+    and the result is cached. Values which are never accessed are never decoded.
+
+    Copies of read results and data change notifications share the same object,
+    \l value() may be called from several threads.
+*/
+
+QOpcUaEncodedValue::QOpcUaEncodedValue()
+    : m_decoded(0)
+{
+}
+
+QOpcUaEncodedValue::~QOpcUaEncodedValue()
+{
+}
+
+/*!
+    Returns the decoded value, decoding it on the first call.
+*/
+QVariant QOpcUaEncodedValue::value()
+{
+    if (m_decoded.loadAcquire())
+        return m_value;
+
+    QMutexLocker locker(&m_mutex);
+    if (!m_decoded.load()) {
+        m_value = decode();
+        m_decoded.storeRelease(1);
+    }
+    return m_value;
+}
+
+/*!
+    Returns \c true if \l value() has already decoded the value.
+*/
+bool QOpcUaEncodedValue::isDecoded() const
+{
+    return m_decoded.loadAcquire();
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,226 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUAHANDLETABLE_P_H
+#define QOPCUAHANDLETABLE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtOpcUa/qopcuatype.h>
+
+#include <QtCore/qpair.h>
+#include <QtCore/qvarlengtharray.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+// A node handle stores the slot index in the lower and the slot generation in the upper 32 bits.
+// The generation of a slot is incremented when the slot is freed, so results for a deleted node
+// are dropped instead of being delivered to a node which reuses the slot.
+// Generations start at 1, so 0 is never a valid handle.
+inline quint32 qt_handleIndex(quint64 handle)
+{
+    return static_cast<quint32>(handle);
+}
+
+inline quint32 qt_handleGeneration(quint64 handle)
+{
+    return static_cast<quint32>(handle >> 32);
+}
+
+inline quint64 qt_makeHandle(quint32 index, quint32 generation)
+{
+    return (static_cast<quint64>(generation) << 32) | index;
+}
+
+template <typename T>
+class QOpcUaHandleTable
+{
+public:
+    quint64 insert(T value)
+    {
+        quint32 index;
+        if (m_freeSlots.isEmpty()) {
+            index = static_cast<quint32>(m_slots.size());
+            m_slots.push_back(Slot());
+        } else {
+            index = m_freeSlots.takeLast();
+        }
+
+        Slot &slot = m_slots[index];
+        slot.value = value;
+        return qt_makeHandle(index, slot.generation);
+    }
+
+    bool remove(quint64 handle)
+    {
+        if (!contains(handle))
+            return false;
+
+        const quint32 index = qt_handleIndex(handle);
+        Slot &slot = m_slots[index];
+        slot.value = T();
+        if (++slot.generation == 0)
+            slot.generation = 1;
+        m_freeSlots.push_back(index);
+        return true;
+    }
+
+    bool contains(quint64 handle) const
+    {
+        const quint32 index = qt_handleIndex(handle);
+        return index < static_cast<quint32>(m_slots.size()) && m_slots.at(index).generation == qt_handleGeneration(handle);
+    }
+
+    T value(quint64 handle) const
+    {
+        return contains(handle) ? m_slots.at(qt_handleIndex(handle)).value : T();
+    }
+
+    int count() const
+    {
+        return m_slots.size() - m_freeSlots.size();
+    }
+
+    template <typename Func>
+    void forEach(Func f) const
+    {
+        for (int i = 0; i < m_slots.size(); ++i) {
+            if (m_slots.at(i).value)
+                f(m_slots.at(i).value);
+        }
+    }
+
+private:
+    struct Slot {
+        T value = T();
+        quint32 generation = 1;
+    };
+
+    QVector<Slot> m_slots;
+    QVector<quint32> m_freeSlots;
+};
+
+// Maps (handle, attribute) to a value. Entries are indexed by the slot index of the handle,
+// an entry left behind by a previous generation of the slot is treated as empty.
+template <typename T>
+class QOpcUaAttributeMap
+{
+public:
+    T value(quint64 handle, QOpcUa::NodeAttribute attr) const
+    {
+        const Entry *entry = findEntry(handle);
+        if (!entry)
+            return T();
+
+        for (const auto &it : entry->attributes) {
+            if (it.first == attr)
+                return it.second;
+        }
+        return T();
+    }
+
+    void insert(quint64 handle, QOpcUa::NodeAttribute attr, T value)
+    {
+        const quint32 index = qt_handleIndex(handle);
+        if (index >= static_cast<quint32>(m_entries.size()))
+            m_entries.resize(index + 1);
+
+        Entry &entry = m_entries[index];
+        if (entry.generation != qt_handleGeneration(handle)) {
+            entry.generation = qt_handleGeneration(handle);
+            entry.attributes.clear();
+        }
+
+        for (auto &it : entry.attributes) {
+            if (it.first == attr) {
+                it.second = value;
+                return;
+            }
+        }
+        entry.attributes.append(qMakePair(attr, value));
+    }
+
+    bool remove(quint64 handle, QOpcUa::NodeAttribute attr)
+    {
+        if (!findEntry(handle))
+            return false;
+
+        Entry &entry = m_entries[qt_handleIndex(handle)];
+        for (int i = 0; i < entry.attributes.size(); ++i) {
+            if (entry.attributes.at(i).first == attr) {
+                entry.attributes.remove(i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void clear()
+    {
+        m_entries.clear();
+    }
+
+private:
+    struct Entry {
+        quint32 generation = 0;
+        QVarLengthArray<QPair<QOpcUa::NodeAttribute, T>, 2> attributes;
+    };
+
+    const Entry *findEntry(quint64 handle) const
+    {
+        const quint32 index = qt_handleIndex(handle);
+        if (index >= static_cast<quint32>(m_entries.size()))
+            return nullptr;
+        const Entry &entry = m_entries.at(index);
+        return entry.generation == qt_handleGeneration(handle) ? &entry : nullptr;
+    }
+
+    QVector<Entry> m_entries;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUAHANDLETABLE_P_H
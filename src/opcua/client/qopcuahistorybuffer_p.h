@@ -0,0 +1,127 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#ifndef QOPCUAHISTORYBUFFER_P_H
+#define QOPCUAHISTORYBUFFER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <private/qopcuanodeimpl_p.h>
+
+#include <QtCore/qatomic.h>
+
+#include <vector>
+
+QT_BEGIN_NAMESPACE
+
+// Fixed capacity single producer, single consumer ring buffer for the data changes of one monitored attribute.
+// The producer is the thread which delivers the data changes of the backend, the consumer is the thread of the
+// QOpcUaNode. Each index is only written by one side, the release/acquire pairs publish the slot contents.
+// If the buffer is full, new values are discarded until the consumer has taken the buffered values.
+class QOpcUaHistoryBuffer
+{
+public:
+    explicit QOpcUaHistoryBuffer(int capacity)
+        : m_slots(static_cast<size_t>(qMax(1, capacity)) + 1)
+        , m_head(0)
+        , m_tail(0)
+    {}
+
+    int capacity() const
+    {
+        return static_cast<int>(m_slots.size()) - 1;
+    }
+
+    // Producer
+    bool push(const QOpcUaReadResult &value)
+    {
+        const int head = m_head.load();
+        const int next = increment(head);
+        if (next == m_tail.loadAcquire())
+            return false;
+
+        m_slots[static_cast<size_t>(head)] = value;
+        m_head.storeRelease(next);
+        return true;
+    }
+
+    // Consumer, calls f for all buffered values from oldest to newest and removes them
+    template <typename F>
+    int consume(F f)
+    {
+        int tail = m_tail.load();
+        const int head = m_head.loadAcquire();
+        int count = 0;
+
+        while (tail != head) {
+            QOpcUaReadResult &slot = m_slots[static_cast<size_t>(tail)];
+            f(slot);
+            slot.setValue(QVariant()); // Don't keep large values alive until the slot is reused
+            tail = increment(tail);
+            ++count;
+        }
+
+        m_tail.storeRelease(tail);
+        return count;
+    }
+
+private:
+    Q_DISABLE_COPY(QOpcUaHistoryBuffer)
+
+    int increment(int index) const
+    {
+        return index + 1 == static_cast<int>(m_slots.size()) ? 0 : index + 1;
+    }
+
+    // One slot stays empty to distinguish a full from an empty buffer
+    std::vector<QOpcUaReadResult> m_slots;
+    // Written by the producer and the consumer respectively, padded to keep them on separate cache lines
+    QAtomicInt m_head;
+    char m_padding[64 - sizeof(QAtomicInt)] Q_DECL_UNUSED_MEMBER;
+    QAtomicInt m_tail;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUAHISTORYBUFFER_P_H
@@ -166,7 +166,8 @@ QT_BEGIN_NAMESPACE
 /*!
     \enum QOpcUaMonitoringParameters::SubscriptionType
 
-    \value Shared Share subscription with other monitored items with the same interval
+    \value Shared Share subscription with other monitored items with the same interval.
+           Identical monitored items of different nodes may share one monitored item on the server.
     \value Exclusive Request a new subscription for this attribute
 */
 
@@ -40,6 +40,7 @@
 #include <private/qopcuaclientimpl_p.h>
 #include <private/qopcuanode_p.h>
 #include <private/qopcuanodeimpl_p.h>
+#include <private/qopcuareaditem_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -149,6 +150,8 @@ QT_BEGIN_NAMESPACE
     Before this signal is emitted, the attribute cache is updated in case of a successful write.
     For \l writeAttributes() a signal is emitted for each attribute in the write call.
     \a statusCode contains the success information for the write operation on \a attribute.
+    Writes which have been replaced by a newer write are reported with \c GoodEntryReplaced
+    and leave the attribute cache unchanged, see \l QOpcUaClient::setWriteCoalescingInterval().
 */
 
 /*!
@@ -158,6 +161,15 @@ QT_BEGIN_NAMESPACE
     new value for the node attribute \a attr.
 */
 
+/*!
+    \fn void QOpcUaNode::arrayDeltaUpdated(QOpcUa::NodeAttribute attr, QOpcUaArrayDelta delta)
+
+    This signal is emitted after \l attributeUpdated() if the array delta is enabled for \a attr
+    and the array value has changed. \a delta contains the index ranges of the changed elements.
+
+    \sa setArrayDeltaEnabled()
+*/
+
 /*!
     \fn void QOpcUaNode::enableMonitoringFinished(QOpcUa::NodeAttribute attr, QOpcUa::UaStatusCode statusCode)
 
@@ -203,6 +215,20 @@ QT_BEGIN_NAMESPACE
     \sa QOpcUaReferenceDescription
 */
 
+/*!
+    \fn void QOpcUaNode::registerNodeFinished(QOpcUa::UaStatusCode statusCode)
+
+    This signal is emitted after a \l registerNode() or \l QOpcUaClient::registerNodes() operation
+    has finished. \a statusCode contains the result of the operation.
+*/
+
+/*!
+    \fn void QOpcUaNode::unregisterNodeFinished(QOpcUa::UaStatusCode statusCode)
+
+    This signal is emitted after an \l unregisterNode() or \l QOpcUaClient::unregisterNodes() operation
+    has finished. \a statusCode contains the result of the operation.
+*/
+
 /*!
     \fn QOpcUa::NodeAttributes QOpcUaNode::mandatoryBaseAttributes()
 
@@ -254,6 +280,11 @@ bool QOpcUaNode::readAttributeRange(QOpcUa::NodeAttribute attribute, const QStri
     Returns \c true if the asynchronous call has been successfully dispatched.
 
     Attribute values only contain valid information after the \l attributeRead signal has been emitted.
+
+    If the address space cache of the client is enabled and \a attributes only contains static attributes
+    which are cached for this node, the values are delivered from the cache.
+
+    \sa QOpcUaClient::setAddressSpaceCacheDirectory()
 */
 bool QOpcUaNode::readAttributes(QOpcUa::NodeAttributes attributes)
 {
@@ -261,6 +292,9 @@ bool QOpcUaNode::readAttributes(QOpcUa::NodeAttributes attributes)
     if (d->m_client.isNull() || d->m_client->state() != QOpcUaClient::Connected)
         return false;
 
+    if (d->readAttributesFromCache(attributes))
+        return true;
+
     return d->m_impl->readAttributes(attributes, QString());
 }
 
@@ -277,7 +311,7 @@ QVariant QOpcUaNode::attribute(QOpcUa::NodeAttribute attribute) const
     if (it == d->m_nodeAttributes.constEnd())
         return QVariant();
 
-    return it->value;
+    return it->decodedValue();
 }
 
 /*!
@@ -310,7 +344,7 @@ QDateTime QOpcUaNode::sourceTimestamp(QOpcUa::NodeAttribute attribute) const
     if (it == d->m_nodeAttributes.constEnd())
         return QDateTime();
 
-    return it->sourceTimestamp;
+    return QOpcUa::dateTimeFromTicks(it->sourceTimestamp);
 }
 
 /*!
@@ -325,7 +359,7 @@ QDateTime QOpcUaNode::serverTimestamp(QOpcUa::NodeAttribute attribute) const
     if (it == d->m_nodeAttributes.constEnd())
         return QDateTime();
 
-    return it->serverTimestamp;
+    return QOpcUa::dateTimeFromTicks(it->serverTimestamp);
 }
 
 /*!
@@ -338,6 +372,12 @@ QDateTime QOpcUaNode::serverTimestamp(QOpcUa::NodeAttribute attribute) const
     There are multiple error cases in which a bad status code is generated: A subscription with the subscription id specified in \a settings does not exist,
     the node does not exist on the server, the node does not have the requested attribute or the maximum number of monitored items for
     the server is reached.
+
+    If several nodes of the same client monitor the same attribute of the same node id with identical
+    sampling interval, queue size, index range and filter in a shared subscription, the open62541 backend
+    creates only one monitored item on the server and delivers its data changes to all nodes.
+    The monitored item is deleted when the last of these nodes disables monitoring.
+    Modifying the parameters of a shared monitored item affects all nodes which use it.
  */
 bool QOpcUaNode::enableMonitoring(QOpcUa::NodeAttributes attr, const QOpcUaMonitoringParameters &settings)
 {
@@ -460,6 +500,9 @@ bool QOpcUaNode::writeAttribute(QOpcUa::NodeAttribute attribute, const QVariant
     if (d->m_client.isNull() || d->m_client->state() != QOpcUaClient::Connected)
         return false;
 
+    if (d->m_client->writeCoalescingInterval() > 0)
+        return d->clientPrivate()->m_impl->coalesceWrite(d->m_impl.data(), attribute, value, type, QString());
+
     return d->m_impl->writeAttribute(attribute, value, type, QString());
 }
 
@@ -475,6 +518,9 @@ bool QOpcUaNode::writeAttributeRange(QOpcUa::NodeAttribute attribute, const QVar
     if (d->m_client.isNull() || d->m_client->state() != QOpcUaClient::Connected)
         return false;
 
+    if (d->m_client->writeCoalescingInterval() > 0)
+        return d->clientPrivate()->m_impl->coalesceWrite(d->m_impl.data(), attribute, value, type, indexRange);
+
     return d->m_impl->writeAttribute(attribute, value, type, indexRange);
 }
 
@@ -513,6 +559,177 @@ bool QOpcUaNode::disableMonitoring(QOpcUa::NodeAttributes attr)
   return d->m_impl->disableMonitoring(attr);
 }
 
+/*!
+    Enables a history buffer for the monitored attribute \a attr which holds up to \a capacity data changes.
+    A \a capacity of 0 disables the buffer. Changing the capacity discards the buffered values.
+
+    The data changes are written to the buffer by the thread of the backend before the \l attributeUpdated
+    signal is queued, consumers like trend displays or loggers can take all values at once by calling
+    \l history() periodically instead of handling one signal per value. This is useful if the server delivers
+    several values per publish interval, e.g. with a queue size larger than 1.
+
+    If the buffer is full, new values are discarded until \l history() is called.
+    The latest value is still available from \l attribute().
+
+    \sa history(), historyCapacity()
+*/
+void QOpcUaNode::setHistoryCapacity(QOpcUa::NodeAttribute attr, int capacity)
+{
+    Q_D(QOpcUaNode);
+
+    QSharedPointer<QOpcUaHistoryBuffer> buffer;
+    if (capacity > 0) {
+        buffer.reset(new QOpcUaHistoryBuffer(capacity));
+        d->m_historyBuffers.insert(attr, buffer);
+    } else {
+        d->m_historyBuffers.remove(attr);
+    }
+
+    if (QOpcUaClientPrivate *client = d->clientPrivate())
+        client->m_impl->setHistoryBuffer(d->m_impl->handle(), attr, buffer);
+}
+
+/*!
+    Returns the capacity of the history buffer for \a attr or 0 if there is no history buffer.
+
+    \sa setHistoryCapacity()
+*/
+int QOpcUaNode::historyCapacity(QOpcUa::NodeAttribute attr) const
+{
+    Q_D(const QOpcUaNode);
+    const QSharedPointer<QOpcUaHistoryBuffer> buffer = d->m_historyBuffers.value(attr);
+    return buffer ? buffer->capacity() : 0;
+}
+
+/*!
+    Returns the data changes of \a attr which have been received since the last call, oldest first.
+    The values are removed from the history buffer.
+
+    Returns an empty vector if no history buffer has been enabled for \a attr using \l setHistoryCapacity().
+*/
+QVector<QOpcUaReadItemResult> QOpcUaNode::history(QOpcUa::NodeAttribute attr)
+{
+    Q_D(QOpcUaNode);
+
+    QVector<QOpcUaReadItemResult> result;
+    const QSharedPointer<QOpcUaHistoryBuffer> buffer = d->m_historyBuffers.value(attr);
+    if (!buffer)
+        return result;
+
+    const QString id = d->m_impl->nodeId();
+    buffer->consume([&](const QOpcUaReadResult &value) {
+        QOpcUaReadItemResult item;
+        item.setNodeId(id);
+        item.setAttribute(value.attributeId);
+        item.setStatusCode(value.statusCode);
+        item.setRawSourceTimestamp(value.sourceTimestamp);
+        item.setRawServerTimestamp(value.serverTimestamp);
+        if (value.encodedValue)
+            QOpcUaReadItemResultPrivate::setEncodedValue(item, value.encodedValue);
+        else
+            item.setValue(value.value);
+        result.push_back(item);
+    });
+
+    return result;
+}
+
+/*!
+    Filters the data changes of the monitored attribute \a attr on the client side.
+
+    Server side filters set with \l QOpcUaMonitoringParameters::setFilter() are not supported by all servers.
+    The client side filter is applied by the thread of the backend before a data change is queued
+    to the thread of the node. Suppressed values don't cause a signal, they are not written to the
+    history buffer and \l attribute() keeps the last delivered value.
+
+    If the deadband type of \a filter is \c Absolute, a numeric value is suppressed if it differs from the
+    last delivered value by less than or equal to the deadband value. If it is \c Percent, the deadband is
+    a percentage of \a euRange, which is usually read from the EURange property of the node.
+    If \a euRange is empty, the percentage refers to the magnitude of the last delivered value.
+    Arrays are delivered if at least one element exceeds the deadband. The trigger of \a filter is ignored.
+
+    If \a minimumInterval is larger than 0, values which arrive less than \a minimumInterval milliseconds
+    after the last delivered value are deferred. Only the newest deferred value is kept, it is delivered
+    when the interval has expired if it passes the deadband. The values it replaces are counted as suppressed.
+
+    Changes of the status code and values which are not numeric are not affected by the deadband.
+    Setting a new filter discards the state of the previous filter.
+
+    \sa removeClientSideFilter(), suppressedValueCount(), QOpcUaClientStatistics::suppressedValues()
+*/
+void QOpcUaNode::setClientSideFilter(QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters::DataChangeFilter &filter,
+                                     int minimumInterval, const QOpcUa::QRange &euRange)
+{
+    Q_D(QOpcUaNode);
+
+    QSharedPointer<QOpcUaClientSideFilter> clientSideFilter(new QOpcUaClientSideFilter(filter, minimumInterval, euRange));
+    d->m_clientSideFilters.insert(attr, clientSideFilter);
+
+    if (QOpcUaClientPrivate *client = d->clientPrivate())
+        client->m_impl->setClientSideFilter(d->m_impl->handle(), attr, clientSideFilter);
+}
+
+/*!
+    Removes the client side filter of \a attr.
+
+    \sa setClientSideFilter()
+*/
+void QOpcUaNode::removeClientSideFilter(QOpcUa::NodeAttribute attr)
+{
+    Q_D(QOpcUaNode);
+
+    if (!d->m_clientSideFilters.remove(attr))
+        return;
+
+    if (QOpcUaClientPrivate *client = d->clientPrivate())
+        client->m_impl->setClientSideFilter(d->m_impl->handle(), attr, QSharedPointer<QOpcUaClientSideFilter>());
+}
+
+/*!
+    Returns the number of data changes of \a attr which have been suppressed by the client side filter
+    since it has been set.
+
+    \sa setClientSideFilter()
+*/
+quint64 QOpcUaNode::suppressedValueCount(QOpcUa::NodeAttribute attr) const
+{
+    Q_D(const QOpcUaNode);
+    const QSharedPointer<QOpcUaClientSideFilter> filter = d->m_clientSideFilters.value(attr);
+    return filter ? filter->suppressedCount() : 0;
+}
+
+/*!
+    Enables or disables the array delta for the attribute \a attr depending on \a enabled.
+
+    If the array delta is enabled, each data change of an array value in \a attr is compared
+    with the cached value of the attribute. The index ranges of the changed elements are emitted
+    in \l arrayDeltaUpdated(), which is only emitted if at least one element or the length
+    of the array has changed. The changed elements can be applied to a buffer holding the previous
+    value with \l QOpcUaArrayDelta::applyTo(), so consumers of large arrays don't have to compare
+    or copy the whole array for each data change.
+
+    The comparison is only done if \l arrayDeltaUpdated() is connected.
+    \l attributeUpdated() is still emitted with the complete value.
+
+    \sa arrayDeltaEnabled(), QOpcUaArrayDelta
+*/
+void QOpcUaNode::setArrayDeltaEnabled(QOpcUa::NodeAttribute attr, bool enabled)
+{
+    Q_D(QOpcUaNode);
+    d->m_arrayDeltaAttributes.setFlag(attr, enabled);
+}
+
+/*!
+    Returns \c true if the array delta is enabled for the attribute \a attr.
+
+    \sa setArrayDeltaEnabled()
+*/
+bool QOpcUaNode::arrayDeltaEnabled(QOpcUa::NodeAttribute attr) const
+{
+    Q_D(const QOpcUaNode);
+    return d->m_arrayDeltaAttributes.testFlag(attr);
+}
+
 /*!
     Executes a forward browse call starting from the node this method is called on.
     The browse operation collects information about child nodes connected to the node
@@ -523,6 +740,10 @@ bool QOpcUaNode::disableMonitoring(QOpcUa::NodeAttributes attr)
     To request only children connected to the node by a certain type of reference, \a referenceType must be set to that reference type.
     For example, this can be  used to get all properties of a node by passing \l {QOpcUa::ReferenceTypeId} {HasProperty} in \a referenceType.
     The results can be filtered to contain only nodes with certain node classes by setting them in \a nodeClassMask.
+
+    If the address space cache of the client is enabled, the result may be delivered from the cache.
+
+    \sa QOpcUaClient::setAddressSpaceCacheDirectory()
 */
 bool QOpcUaNode::browseChildren(QOpcUa::ReferenceTypeId referenceType, QOpcUa::NodeClasses nodeClassMask)
 {
@@ -530,11 +751,20 @@ bool QOpcUaNode::browseChildren(QOpcUa::ReferenceTypeId referenceType, QOpcUa::N
     if (d->m_client.isNull() || d->m_client->state() != QOpcUaClient::Connected)
         return false;
 
-    return d->m_impl->browseChildren(referenceType, nodeClassMask);
+    if (d->browseChildrenFromCache(referenceType, nodeClassMask))
+        return true;
+
+    if (!d->m_impl->browseChildren(referenceType, nodeClassMask))
+        return false;
+
+    d->browseRequestSent(referenceType, nodeClassMask);
+    return true;
 }
 
 /*!
     Returns the ID of the OPC UA node.
+
+    For a registered node, the original node id is returned instead of the id assigned by the server.
 */
 QString QOpcUaNode::nodeId() const
 {
@@ -545,6 +775,64 @@ QString QOpcUaNode::nodeId() const
     return d->m_impl->nodeId();
 }
 
+/*!
+    Registers the node with the server using the RegisterNodes service.
+    Returns \c true if the asynchronous call has been successfully dispatched.
+
+    Servers may return an optimized node id for registered nodes, for example a numeric alias
+    for a node with a long string identifier. After \l registerNodeFinished() has been emitted
+    with a good status code, all reads, writes, browse requests, method calls and new monitored
+    items of this node use the id returned by the server. This includes the batch requests of
+    \l QOpcUaClient and coalesced writes which contain the node id. \l nodeId() and all results
+    still contain the original node id. The registration is valid until \l unregisterNode() is called,
+    the node is destroyed or the client is disconnected.
+
+    Returns \c false if the backend does not support registering nodes.
+
+    \sa unregisterNode() isRegistered() QOpcUaClient::registerNodes()
+*/
+bool QOpcUaNode::registerNode()
+{
+    Q_D(QOpcUaNode);
+    if (d->m_client.isNull() || d->m_client->state() != QOpcUaClient::Connected)
+        return false;
+
+    return d->m_impl->registerNode();
+}
+
+/*!
+    Unregisters a node which has been registered by \l registerNode().
+    Returns \c true if the asynchronous call has been successfully dispatched.
+
+    All requests sent after this call use the original node id.
+    \l unregisterNodeFinished() is emitted after the operation has finished.
+
+    \sa registerNode() QOpcUaClient::unregisterNodes()
+*/
+bool QOpcUaNode::unregisterNode()
+{
+    Q_D(QOpcUaNode);
+    if (d->m_client.isNull() || d->m_client->state() != QOpcUaClient::Connected || !isRegistered())
+        return false;
+
+    return d->m_impl->unregisterNode();
+}
+
+/*!
+    Returns \c true if the node has been registered with the server and uses the node id
+    returned by the server for its requests.
+
+    \sa registerNode()
+*/
+bool QOpcUaNode::isRegistered() const
+{
+    Q_D(const QOpcUaNode);
+    if (d->m_client.isNull() || d->m_client->state() != QOpcUaClient::Connected)
+        return false;
+
+    return !d->m_impl->registeredNodeId().isEmpty();
+}
+
 /*!
     Calls the OPC UA method \a methodNodeId with the parameters given via \a args. The result is
     returned in the \l methodCallFinished signal.
@@ -560,6 +848,24 @@ bool QOpcUaNode::callMethod(const QString &methodNodeId, const QVector<QOpcUa::T
     return d->m_impl->callMethod(methodNodeId, args);
 }
 
+/*!
+    \overload
+
+    Calls the OPC UA method \a methodNodeId with the parameters given via \a args.
+    The node id is passed to the backend without parsing a string.
+*/
+bool QOpcUaNode::callMethod(const QOpcUaNodeId &methodNodeId, const QVector<QOpcUa::TypedVariant> &args)
+{
+    Q_D(QOpcUaNode);
+    if (d->m_client.isNull() || d->m_client->state() != QOpcUaClient::Connected)
+        return false;
+
+    if (methodNodeId.isNull())
+        return false;
+
+    return d->m_impl->callMethod(methodNodeId, args);
+}
+
 QDebug operator<<(QDebug dbg, const QOpcUaNode &node)
 {
     dbg << "QOpcUaNode {"
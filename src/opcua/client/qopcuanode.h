@@ -37,8 +37,11 @@
 #ifndef QOPCUANODE_H
 #define QOPCUANODE_H
 
+#include <QtOpcUa/qopcuaarraydelta.h>
 #include <QtOpcUa/qopcuaglobal.h>
 #include <QtOpcUa/qopcuamonitoringparameters.h>
+#include <QtOpcUa/qopcuanodeid.h>
+#include <QtOpcUa/qopcuareaditem.h>
 #include <QtOpcUa/qopcuareferencedescription.h>
 #include <QtOpcUa/qopcuatype.h>
 
@@ -84,17 +87,35 @@ public:
     QOpcUaMonitoringParameters monitoringStatus(QOpcUa::NodeAttribute attr);
     bool modifyDataChangeFilter(QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters::DataChangeFilter &filter);
 
+    void setHistoryCapacity(QOpcUa::NodeAttribute attr, int capacity);
+    int historyCapacity(QOpcUa::NodeAttribute attr) const;
+    QVector<QOpcUaReadItemResult> history(QOpcUa::NodeAttribute attr);
+
+    void setClientSideFilter(QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters::DataChangeFilter &filter,
+                             int minimumInterval = 0, const QOpcUa::QRange &euRange = QOpcUa::QRange());
+    void removeClientSideFilter(QOpcUa::NodeAttribute attr);
+    quint64 suppressedValueCount(QOpcUa::NodeAttribute attr) const;
+
+    void setArrayDeltaEnabled(QOpcUa::NodeAttribute attr, bool enabled);
+    bool arrayDeltaEnabled(QOpcUa::NodeAttribute attr) const;
+
     bool browseChildren(QOpcUa::ReferenceTypeId referenceType = QOpcUa::ReferenceTypeId::HierarchicalReferences,
                         QOpcUa::NodeClasses nodeClassMask = QOpcUa::NodeClass::Undefined);
 
     QString nodeId() const;
 
+    bool registerNode();
+    bool unregisterNode();
+    bool isRegistered() const;
+
     bool callMethod(const QString &methodNodeId, const QVector<QOpcUa::TypedVariant> &args = QVector<QOpcUa::TypedVariant>());
+    bool callMethod(const QOpcUaNodeId &methodNodeId, const QVector<QOpcUa::TypedVariant> &args = QVector<QOpcUa::TypedVariant>());
 
 Q_SIGNALS:
     void attributeRead(QOpcUa::NodeAttributes attributes);
     void attributeWritten(QOpcUa::NodeAttribute attribute, QOpcUa::UaStatusCode statusCode);
     void attributeUpdated(QOpcUa::NodeAttribute attr, QVariant value);
+    void arrayDeltaUpdated(QOpcUa::NodeAttribute attr, QOpcUaArrayDelta delta);
 
     void monitoringStatusChanged(QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameters items,
                            QOpcUa::UaStatusCode statusCode);
@@ -102,6 +123,8 @@ Q_SIGNALS:
     void disableMonitoringFinished(QOpcUa::NodeAttribute attr, QOpcUa::UaStatusCode statusCode);
     void methodCallFinished(QString methodNodeId, QVariant result, QOpcUa::UaStatusCode statusCode);
     void browseFinished(QVector<QOpcUaReferenceDescription> children, QOpcUa::UaStatusCode statusCode);
+    void registerNodeFinished(QOpcUa::UaStatusCode statusCode);
+    void unregisterNodeFinished(QOpcUa::UaStatusCode statusCode);
 
 private:
     Q_DISABLE_COPY(QOpcUaNode)
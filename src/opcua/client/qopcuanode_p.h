@@ -50,12 +50,18 @@
 
 #include <QtOpcUa/qopcuaclient.h>
 #include <QtOpcUa/qopcuanode.h>
+#include <private/qopcuaclient_p.h>
+#include <private/qopcuaclientsidefilter_p.h>
+#include <private/qopcuahistorybuffer_p.h>
 #include <private/qopcuanodeimpl_p.h>
 
 #include <private/qobject_p.h>
+#include <QtCore/qmetaobject.h>
 #include <QtCore/qpointer.h>
 #include <QtCore/qscopedpointer.h>
+#include <QtCore/qsharedpointer.h>
 #include <QtCore/qhash.h>
+#include <QtCore/qtimer.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -67,46 +73,59 @@ public:
     QOpcUaNodePrivate(QOpcUaNodeImpl *impl, QOpcUaClient *client)
         : m_impl(impl)
         , m_client(client)
+        , m_pendingBrowseRequests(0)
+        , m_overlappingBrowseRequests(false)
+        , m_browseReferenceType(QOpcUa::ReferenceTypeId::HierarchicalReferences)
     {
         m_attributesReadConnection = QObject::connect(impl, &QOpcUaNodeImpl::attributesRead,
                 [this](QVector<QOpcUaReadResult> attr, QOpcUa::UaStatusCode serviceResult)
         {
-            for (auto &entry : qAsConst(attr)) {
-                if (serviceResult == QOpcUa::UaStatusCode::Good)
-                    m_nodeAttributes[entry.attributeId] = entry;
-                else {
-                    QOpcUaReadResult temp = entry;
-                    temp.statusCode = serviceResult;
-                    temp.value = QVariant();
-                    m_nodeAttributes[entry.attributeId] = temp;
-                }
-            }
-
-            QOpcUa::NodeAttributes updatedAttributes;
-            for (auto &entry : qAsConst(attr))
-                updatedAttributes |= entry.attributeId;
+            QOpcUaAddressSpaceCache *cache = addressSpaceCache();
+            if (cache && serviceResult == QOpcUa::UaStatusCode::Good)
+                cache->storeAttributes(m_impl->nodeId(), attr);
 
-            Q_Q(QOpcUaNode);
-            emit q->attributeRead(updatedAttributes);
+            handleAttributesRead(attr, serviceResult);
         });
 
         m_attributeWrittenConnection = QObject::connect(impl, &QOpcUaNodeImpl::attributeWritten,
                 [this](QOpcUa::NodeAttribute attr, QVariant value, QOpcUa::UaStatusCode statusCode)
         {
+            Q_Q(QOpcUaNode);
+            // A write replaced by a newer coalesced write never reached the server,
+            // the cached status is updated by the result of the newer write
+            if (statusCode == QOpcUa::UaStatusCode::GoodEntryReplaced) {
+                emit q->attributeWritten(attr, statusCode);
+                return;
+            }
+
             m_nodeAttributes[attr].statusCode = statusCode;
             if (statusCode == QOpcUa::UaStatusCode::Good)
-                m_nodeAttributes[attr].value = value;
+                m_nodeAttributes[attr].setValue(value);
+
+            QOpcUaAddressSpaceCache *cache = addressSpaceCache();
+            if (cache && statusCode == QOpcUa::UaStatusCode::Good)
+                cache->storeAttributes(m_impl->nodeId(), QVector<QOpcUaReadResult>({m_nodeAttributes.value(attr)}));
 
-            Q_Q(QOpcUaNode);
             emit q->attributeWritten(attr, statusCode);
         });
 
         m_attributeUpdatedConnection = QObject::connect(impl, &QOpcUaNodeImpl::attributeUpdated,
                 [this](QOpcUa::NodeAttribute attr, QOpcUaReadResult value)
         {
-            this->m_nodeAttributes[attr] = value;
             Q_Q(QOpcUaNode);
-            emit q->attributeUpdated(attr, value.value);
+            // The delta is computed against the cached value before it is replaced
+            QOpcUaArrayDelta delta;
+            static const QMetaMethod arrayDeltaUpdatedSignal = QMetaMethod::fromSignal(&QOpcUaNode::arrayDeltaUpdated);
+            if (m_arrayDeltaAttributes.testFlag(attr) && q->isSignalConnected(arrayDeltaUpdatedSignal))
+                delta = QOpcUaArrayDelta(m_nodeAttributes.value(attr).decodedValue(), value.decodedValue());
+
+            this->m_nodeAttributes[attr] = value;
+            // An encoded value is only decoded here if the signal is received, otherwise by attribute()
+            static const QMetaMethod attributeUpdatedSignal = QMetaMethod::fromSignal(&QOpcUaNode::attributeUpdated);
+            if (!value.encodedValue || q->isSignalConnected(attributeUpdatedSignal))
+                emit q->attributeUpdated(attr, value.decodedValue());
+            if (delta.isValid() && !delta.isEmpty())
+                emit q->arrayDeltaUpdated(attr, delta);
         });
 
         m_monitoringEnableDisableConnection = QObject::connect(impl, &QOpcUaNodeImpl::monitoringEnableDisable,
@@ -166,9 +185,31 @@ public:
             emit q->methodCallFinished(methodNodeId, result, statusCode);
         });
 
+        m_registerNodeFinishedConnection = QObject::connect(impl, &QOpcUaNodeImpl::registerNodeFinished,
+                [this](QString registeredNodeId, QOpcUa::UaStatusCode statusCode)
+        {
+            Q_UNUSED(registeredNodeId);
+            Q_Q(QOpcUaNode);
+            emit q->registerNodeFinished(statusCode);
+        });
+
+        m_unregisterNodeFinishedConnection = QObject::connect(impl, &QOpcUaNodeImpl::unregisterNodeFinished,
+                [this](QOpcUa::UaStatusCode statusCode)
+        {
+            Q_Q(QOpcUaNode);
+            emit q->unregisterNodeFinished(statusCode);
+        });
+
         m_browseFinishedConnection = QObject::connect(impl, &QOpcUaNodeImpl::browseFinished,
                 [this](QVector<QOpcUaReferenceDescription> children, QOpcUa::UaStatusCode statusCode)
         {
+            // The browse parameters are only known for sure if there was no other browse request in flight
+            QOpcUaAddressSpaceCache *cache = addressSpaceCache();
+            if (cache && statusCode == QOpcUa::UaStatusCode::Good && !m_overlappingBrowseRequests)
+                cache->storeBrowseResult(m_impl->nodeId(), m_browseReferenceType, m_browseNodeClassMask, children);
+            if (m_pendingBrowseRequests > 0 && --m_pendingBrowseRequests == 0)
+                m_overlappingBrowseRequests = false;
+
             Q_Q(QOpcUaNode);
             emit q->browseFinished(children, statusCode);
         });
@@ -183,6 +224,8 @@ public:
         QObject::disconnect(m_monitoringStatusChangedConnection);
         QObject::disconnect(m_methodCallFinishedConnection);
         QObject::disconnect(m_browseFinishedConnection);
+        QObject::disconnect(m_registerNodeFinishedConnection);
+        QObject::disconnect(m_unregisterNodeFinishedConnection);
 
         // Disable remaining monitorings
         QOpcUa::NodeAttributes attr;
@@ -193,6 +236,82 @@ public:
         if (attr != 0 && m_impl) {
             m_impl->disableMonitoring(attr);
         }
+
+        if (!m_historyBuffers.isEmpty() && clientPrivate())
+            clientPrivate()->m_impl->removeHistoryBuffers(m_impl->handle());
+        if (!m_clientSideFilters.isEmpty() && clientPrivate())
+            clientPrivate()->m_impl->removeClientSideFilters(m_impl->handle());
+    }
+
+    void handleAttributesRead(const QVector<QOpcUaReadResult> &attr, QOpcUa::UaStatusCode serviceResult)
+    {
+        for (auto &entry : attr) {
+            if (serviceResult == QOpcUa::UaStatusCode::Good)
+                m_nodeAttributes[entry.attributeId] = entry;
+            else {
+                QOpcUaReadResult temp = entry;
+                temp.statusCode = serviceResult;
+                temp.setValue(QVariant());
+                m_nodeAttributes[entry.attributeId] = temp;
+            }
+        }
+
+        QOpcUa::NodeAttributes updatedAttributes;
+        for (auto &entry : attr)
+            updatedAttributes |= entry.attributeId;
+
+        Q_Q(QOpcUaNode);
+        emit q->attributeRead(updatedAttributes);
+    }
+
+    QOpcUaClientPrivate *clientPrivate() const
+    {
+        if (m_client.isNull())
+            return nullptr;
+        return static_cast<QOpcUaClientPrivate *>(QObjectPrivate::get(m_client.data()));
+    }
+
+    QOpcUaAddressSpaceCache *addressSpaceCache() const
+    {
+        QOpcUaClientPrivate *client = clientPrivate();
+        return client ? client->m_addressSpaceCache.data() : nullptr;
+    }
+
+    // Results from the address space cache are delivered asynchronously like results from the server
+    bool readAttributesFromCache(QOpcUa::NodeAttributes attributes)
+    {
+        QOpcUaAddressSpaceCache *cache = addressSpaceCache();
+        QVector<QOpcUaReadResult> results;
+        if (!cache || !cache->readAttributes(m_impl->nodeId(), attributes, results))
+            return false;
+
+        Q_Q(QOpcUaNode);
+        QTimer::singleShot(0, q, [this, results]() {
+            handleAttributesRead(results, QOpcUa::UaStatusCode::Good);
+        });
+        return true;
+    }
+
+    bool browseChildrenFromCache(QOpcUa::ReferenceTypeId referenceType, QOpcUa::NodeClasses nodeClassMask)
+    {
+        QOpcUaAddressSpaceCache *cache = addressSpaceCache();
+        QVector<QOpcUaReferenceDescription> references;
+        if (!cache || !cache->browseChildren(m_impl->nodeId(), referenceType, nodeClassMask, references))
+            return false;
+
+        Q_Q(QOpcUaNode);
+        QTimer::singleShot(0, q, [q, references]() {
+            emit q->browseFinished(references, QOpcUa::UaStatusCode::Good);
+        });
+        return true;
+    }
+
+    void browseRequestSent(QOpcUa::ReferenceTypeId referenceType, QOpcUa::NodeClasses nodeClassMask)
+    {
+        if (m_pendingBrowseRequests++ > 0)
+            m_overlappingBrowseRequests = true;
+        m_browseReferenceType = referenceType;
+        m_browseNodeClassMask = nodeClassMask;
     }
 
     QScopedPointer<QOpcUaNodeImpl> m_impl;
@@ -200,6 +319,15 @@ public:
 
     QHash<QOpcUa::NodeAttribute, QOpcUaReadResult> m_nodeAttributes;
     QHash<QOpcUa::NodeAttribute, QOpcUaMonitoringParameters> m_monitoringStatus;
+    QHash<QOpcUa::NodeAttribute, QSharedPointer<QOpcUaHistoryBuffer>> m_historyBuffers;
+    QHash<QOpcUa::NodeAttribute, QSharedPointer<QOpcUaClientSideFilter>> m_clientSideFilters;
+    QOpcUa::NodeAttributes m_arrayDeltaAttributes;
+
+    // Parameters of the last browse request, used to store the result in the address space cache
+    int m_pendingBrowseRequests;
+    bool m_overlappingBrowseRequests;
+    QOpcUa::ReferenceTypeId m_browseReferenceType;
+    QOpcUa::NodeClasses m_browseNodeClassMask;
 
     QMetaObject::Connection m_attributesReadConnection;
     QMetaObject::Connection m_attributeWrittenConnection;
@@ -208,6 +336,8 @@ public:
     QMetaObject::Connection m_monitoringStatusChangedConnection;
     QMetaObject::Connection m_methodCallFinishedConnection;
     QMetaObject::Connection m_browseFinishedConnection;
+    QMetaObject::Connection m_registerNodeFinishedConnection;
+    QMetaObject::Connection m_unregisterNodeFinishedConnection;
 };
 
 QT_END_NAMESPACE
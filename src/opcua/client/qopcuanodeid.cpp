@@ -0,0 +1,295 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuanodeid.h"
+
+#include <QtCore/qhash.h>
+#include <QtCore/qloggingcategory.h>
+
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA)
+
+/*!
+    \class QOpcUaNodeId
+    \inmodule QtOpcUa
+    \brief Holds an OPC UA node id in parsed form
+
+    A node id consists of a namespace index and an identifier which is either numeric,
+    a string, a GUID or a byte string.
+
+    Unlike the string representation used by most of the API (for example \c "ns=2;i=42"),
+    a QOpcUaNodeId does not have to be parsed or formatted when it is passed to the backend.
+    Numeric node ids, which are the most common case, are stored without any heap allocation
+    and are cheap to compare and to hash, so QOpcUaNodeId is suitable as key in a QHash.
+
+    \code
+    QOpcUaNode *node = client->node(QOpcUaNodeId(2, 42));
+    \endcode
+
+    \sa QOpcUaClient::node() QOpcUaNode::callMethod()
+*/
+
+/*!
+    \enum QOpcUaNodeId::IdentifierType
+
+    This enum specifies the type of the identifier of a node id.
+
+    \value Null The node id is null.
+    \value Numeric The identifier is a 32 bit unsigned integer.
+    \value String The identifier is a string.
+    \value Guid The identifier is a GUID.
+    \value ByteString The identifier is an opaque byte string.
+*/
+
+/*!
+    Creates a null node id.
+*/
+QOpcUaNodeId::QOpcUaNodeId()
+    : m_numeric(0)
+    , m_namespaceIndex(0)
+    , m_type(IdentifierType::Null)
+{}
+
+/*!
+    Creates a node id with the numeric identifier \a identifier in the namespace \a namespaceIndex.
+*/
+QOpcUaNodeId::QOpcUaNodeId(quint16 namespaceIndex, quint32 identifier)
+    : m_numeric(identifier)
+    , m_namespaceIndex(namespaceIndex)
+    , m_type(IdentifierType::Numeric)
+{}
+
+/*!
+    Creates a node id with the string identifier \a identifier in the namespace \a namespaceIndex.
+*/
+QOpcUaNodeId::QOpcUaNodeId(quint16 namespaceIndex, const QString &identifier)
+    : m_data(identifier.toUtf8())
+    , m_numeric(0)
+    , m_namespaceIndex(namespaceIndex)
+    , m_type(IdentifierType::String)
+{}
+
+/*!
+    Creates a node id with the GUID identifier \a identifier in the namespace \a namespaceIndex.
+*/
+QOpcUaNodeId::QOpcUaNodeId(quint16 namespaceIndex, const QUuid &identifier)
+    : m_data(identifier.toRfc4122())
+    , m_numeric(0)
+    , m_namespaceIndex(namespaceIndex)
+    , m_type(IdentifierType::Guid)
+{}
+
+/*!
+    Creates a node id with the opaque identifier \a identifier in the namespace \a namespaceIndex.
+*/
+QOpcUaNodeId::QOpcUaNodeId(quint16 namespaceIndex, const QByteArray &identifier)
+    : m_data(identifier)
+    , m_numeric(0)
+    , m_namespaceIndex(namespaceIndex)
+    , m_type(IdentifierType::ByteString)
+{}
+
+/*!
+    Parses the string representation \a nodeId (for example \c "ns=2;s=Demo.Static.Scalar.Double")
+    and returns the node id. A null node id is returned if \a nodeId is malformed.
+
+    \sa toString()
+*/
+QOpcUaNodeId QOpcUaNodeId::fromString(const QString &nodeId)
+{
+    const int semicolonIndex = nodeId.indexOf(QLatin1Char(';'));
+    if (semicolonIndex <= 3 || !nodeId.startsWith(QLatin1String("ns="))) {
+        qCWarning(QT_OPCUA) << "Not a valid namespace in node id string:" << nodeId;
+        return QOpcUaNodeId();
+    }
+
+    bool ok = false;
+    const uint namespaceIndex = nodeId.midRef(3, semicolonIndex - 3).toUInt(&ok);
+    if (!ok || namespaceIndex > std::numeric_limits<quint16>::max()) {
+        qCWarning(QT_OPCUA) << "Not a valid namespace index in node id string:" << nodeId;
+        return QOpcUaNodeId();
+    }
+
+    const QStringRef identifierString = nodeId.midRef(semicolonIndex + 1);
+    if (identifierString.length() <= 2 || identifierString.at(1) != QLatin1Char('=')) {
+        qCWarning(QT_OPCUA) << "There is no identifier in node id string:" << nodeId;
+        return QOpcUaNodeId();
+    }
+
+    const QStringRef identifier = identifierString.mid(2);
+
+    switch (identifierString.at(0).unicode()) {
+    case 'i': {
+        const quint32 numeric = identifier.toUInt(&ok);
+        if (ok)
+            return QOpcUaNodeId(namespaceIndex, numeric);
+        break;
+    }
+    case 's':
+        return QOpcUaNodeId(namespaceIndex, identifier.toString());
+    case 'g': {
+        const QUuid uuid(identifier.toString());
+        if (!uuid.isNull())
+            return QOpcUaNodeId(namespaceIndex, uuid);
+        break;
+    }
+    case 'b': {
+        const QByteArray data = QByteArray::fromBase64(identifier.toLatin1());
+        if (!data.isEmpty())
+            return QOpcUaNodeId(namespaceIndex, data);
+        break;
+    }
+    default:
+        break;
+    }
+
+    qCWarning(QT_OPCUA) << "Could not parse node id:" << nodeId;
+    return QOpcUaNodeId();
+}
+
+/*!
+    Returns the string representation of this node id, for example \c "ns=0;i=85".
+    An empty string is returned for a null node id.
+
+    \sa fromString()
+*/
+QString QOpcUaNodeId::toString() const
+{
+    QString result = QLatin1String("ns=") + QString::number(m_namespaceIndex);
+
+    switch (m_type) {
+    case IdentifierType::Numeric:
+        return result + QLatin1String(";i=") + QString::number(m_numeric);
+    case IdentifierType::String:
+        return result + QLatin1String(";s=") + QString::fromUtf8(m_data);
+    case IdentifierType::Guid:
+        return result + QLatin1String(";g=") + guidIdentifier().toString().mid(1, 36); // Remove enclosing {...}
+    case IdentifierType::ByteString:
+        return result + QLatin1String(";b=") + QString::fromLatin1(m_data.toBase64());
+    default:
+        return QString();
+    }
+}
+
+/*!
+    Returns \c true if this node id is null.
+*/
+bool QOpcUaNodeId::isNull() const
+{
+    return m_type == IdentifierType::Null;
+}
+
+/*!
+    Returns the namespace index of this node id.
+*/
+quint16 QOpcUaNodeId::namespaceIndex() const
+{
+    return m_namespaceIndex;
+}
+
+/*!
+    Returns the type of the identifier of this node id.
+*/
+QOpcUaNodeId::IdentifierType QOpcUaNodeId::identifierType() const
+{
+    return m_type;
+}
+
+/*!
+    Returns the numeric identifier or \c 0 if the identifier is not numeric.
+*/
+quint32 QOpcUaNodeId::numericIdentifier() const
+{
+    return m_numeric;
+}
+
+/*!
+    Returns the string identifier or an empty string if the identifier is not a string.
+*/
+QString QOpcUaNodeId::stringIdentifier() const
+{
+    return m_type == IdentifierType::String ? QString::fromUtf8(m_data) : QString();
+}
+
+/*!
+    Returns the GUID identifier or a null QUuid if the identifier is not a GUID.
+*/
+QUuid QOpcUaNodeId::guidIdentifier() const
+{
+    return m_type == IdentifierType::Guid ? QUuid::fromRfc4122(m_data) : QUuid();
+}
+
+/*!
+    Returns the opaque identifier or an empty byte array if the identifier is not a byte string.
+*/
+QByteArray QOpcUaNodeId::byteStringIdentifier() const
+{
+    return m_type == IdentifierType::ByteString ? m_data : QByteArray();
+}
+
+/*!
+    Returns \c true if this node id has the same namespace index and identifier as \a other.
+*/
+bool QOpcUaNodeId::operator==(const QOpcUaNodeId &other) const
+{
+    return m_type == other.m_type && m_namespaceIndex == other.m_namespaceIndex
+            && m_numeric == other.m_numeric && m_data == other.m_data;
+}
+
+/*!
+    \fn bool QOpcUaNodeId::operator!=(const QOpcUaNodeId &other) const
+
+    Returns \c true if this node id differs from \a other.
+*/
+
+/*!
+    \relates QOpcUaNodeId
+
+    Returns the hash value for \a key, using \a seed to seed the calculation.
+    Numeric node ids are hashed without touching any heap memory.
+*/
+uint qHash(const QOpcUaNodeId &key, uint seed) Q_DECL_NOTHROW
+{
+    if (key.identifierType() == QOpcUaNodeId::IdentifierType::Numeric)
+        return qHash((quint64(key.namespaceIndex()) << 32) | key.numericIdentifier(), seed);
+
+    return qHash(key.m_data, seed) ^ (uint(key.namespaceIndex()) << 8) ^ uint(key.identifierType());
+}
+
+QT_END_NAMESPACE
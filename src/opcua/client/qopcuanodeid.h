@@ -0,0 +1,100 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUANODEID_H
+#define QOPCUANODEID_H
+
+#include <QtOpcUa/qopcuaglobal.h>
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qmetatype.h>
+#include <QtCore/qstring.h>
+#include <QtCore/quuid.h>
+
+QT_BEGIN_NAMESPACE
+
+class Q_OPCUA_EXPORT QOpcUaNodeId
+{
+public:
+    enum class IdentifierType : quint8 {
+        Null,
+        Numeric,
+        String,
+        Guid,
+        ByteString
+    };
+
+    QOpcUaNodeId();
+    QOpcUaNodeId(quint16 namespaceIndex, quint32 identifier);
+    QOpcUaNodeId(quint16 namespaceIndex, const QString &identifier);
+    QOpcUaNodeId(quint16 namespaceIndex, const QUuid &identifier);
+    QOpcUaNodeId(quint16 namespaceIndex, const QByteArray &identifier);
+
+    static QOpcUaNodeId fromString(const QString &nodeId);
+    QString toString() const;
+
+    bool isNull() const;
+    quint16 namespaceIndex() const;
+    IdentifierType identifierType() const;
+
+    quint32 numericIdentifier() const;
+    QString stringIdentifier() const;
+    QUuid guidIdentifier() const;
+    QByteArray byteStringIdentifier() const;
+
+    bool operator==(const QOpcUaNodeId &other) const;
+    inline bool operator!=(const QOpcUaNodeId &other) const { return !(*this == other); }
+
+private:
+    friend Q_OPCUA_EXPORT uint qHash(const QOpcUaNodeId &key, uint seed) Q_DECL_NOTHROW;
+
+    // Numeric identifiers are stored in m_numeric, all other identifiers in m_data
+    // (UTF-8 for strings, RFC 4122 for GUIDs).
+    QByteArray m_data;
+    quint32 m_numeric;
+    quint16 m_namespaceIndex;
+    IdentifierType m_type;
+};
+
+Q_DECLARE_TYPEINFO(QOpcUaNodeId, Q_MOVABLE_TYPE);
+
+Q_OPCUA_EXPORT uint qHash(const QOpcUaNodeId &key, uint seed = 0) Q_DECL_NOTHROW;
+
+QT_END_NAMESPACE
+
+Q_DECLARE_METATYPE(QOpcUaNodeId)
+
+#endif // QOPCUANODEID_H
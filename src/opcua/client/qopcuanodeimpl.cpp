@@ -39,6 +39,7 @@
 QT_BEGIN_NAMESPACE
 
 QOpcUaNodeImpl::QOpcUaNodeImpl()
+    : m_handle(0)
 {
 }
 
@@ -46,4 +47,37 @@ QOpcUaNodeImpl::~QOpcUaNodeImpl()
 {
 }
 
+// Backends which can't use the parsed node id directly fall back to the string representation
+bool QOpcUaNodeImpl::callMethod(const QOpcUaNodeId &methodNodeId, const QVector<QOpcUa::TypedVariant> &args)
+{
+    return callMethod(methodNodeId.toString(), args);
+}
+
+// Backends without RegisterNodes support always use the node id passed to the constructor
+bool QOpcUaNodeImpl::registerNode()
+{
+    return false;
+}
+
+bool QOpcUaNodeImpl::unregisterNode()
+{
+    return false;
+}
+
+// The id returned by the server for a registered node, empty if the node is not registered
+QString QOpcUaNodeImpl::registeredNodeId() const
+{
+    return QString();
+}
+
+quint64 QOpcUaNodeImpl::handle() const
+{
+    return m_handle;
+}
+
+void QOpcUaNodeImpl::setHandle(quint64 handle)
+{
+    m_handle = handle;
+}
+
 QT_END_NAMESPACE
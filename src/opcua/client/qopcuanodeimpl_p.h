@@ -52,7 +52,10 @@
 #include <QtOpcUa/qopcuamonitoringparameters.h>
 #include <QtOpcUa/qopcuanode.h>
 #include <QtOpcUa/qopcuatype.h>
+#include <QtOpcUa/qopcuawriteitem.h>
+#include <private/qopcuaencodedvalue_p.h>
 
+#include <QtCore/qsharedpointer.h>
 #include <QtCore/qvariant.h>
 
 QT_BEGIN_NAMESPACE
@@ -60,9 +63,29 @@ QT_BEGIN_NAMESPACE
 struct QOpcUaReadResult {
     QOpcUa::NodeAttribute attributeId;
     QOpcUa::UaStatusCode statusCode;
-    QDateTime sourceTimestamp;
-    QDateTime serverTimestamp;
+    qint64 sourceTimestamp = 0; // 100 ns intervals since 1601-01-01 UTC, 0 if not set
+    qint64 serverTimestamp = 0;
     QVariant value;
+    // Set instead of value if the backend delivers the value undecoded
+    QSharedPointer<QOpcUaEncodedValue> encodedValue;
+
+    QVariant decodedValue() const { return encodedValue ? encodedValue->value() : value; }
+    void setValue(const QVariant &v) { value = v; encodedValue.reset(); }
+};
+
+struct QOpcUaAttributeUpdate {
+    quint64 handle;
+    QOpcUaReadResult value;
+};
+
+struct QOpcUaNodeHandle {
+    quint64 handle;
+    QString nodeId;
+};
+
+struct QOpcUaCoalescedWrite {
+    quint64 handle;
+    QOpcUaWriteItem item;
 };
 
 class Q_OPCUA_EXPORT QOpcUaNodeImpl : public QObject
@@ -84,6 +107,14 @@ public:
                                           const QVariant &value) = 0;
 
     virtual bool callMethod(const QString &methodNodeId, const QVector<QOpcUa::TypedVariant> &args) = 0;
+    virtual bool callMethod(const QOpcUaNodeId &methodNodeId, const QVector<QOpcUa::TypedVariant> &args);
+
+    virtual bool registerNode();
+    virtual bool unregisterNode();
+    virtual QString registeredNodeId() const;
+
+    quint64 handle() const;
+    void setHandle(quint64 handle);
 
 Q_SIGNALS:
     void attributesRead(QVector<QOpcUaReadResult> attr, QOpcUa::UaStatusCode serviceResult);
@@ -95,10 +126,20 @@ Q_SIGNALS:
     void monitoringStatusChanged(QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameters items,
                            QOpcUaMonitoringParameters param);
     void methodCallFinished(QString methodNodeId, QVariant result, QOpcUa::UaStatusCode statusCode);
+    void registerNodeFinished(QString registeredNodeId, QOpcUa::UaStatusCode statusCode);
+    void unregisterNodeFinished(QOpcUa::UaStatusCode statusCode);
+
+private:
+    quint64 m_handle;
 };
 
 QT_END_NAMESPACE
 
 Q_DECLARE_METATYPE(QOpcUaReadResult)
+Q_DECLARE_METATYPE(QOpcUaAttributeUpdate)
+Q_DECLARE_TYPEINFO(QOpcUaNodeHandle, Q_MOVABLE_TYPE);
+Q_DECLARE_METATYPE(QOpcUaNodeHandle)
+Q_DECLARE_TYPEINFO(QOpcUaCoalescedWrite, Q_MOVABLE_TYPE);
+Q_DECLARE_METATYPE(QOpcUaCoalescedWrite)
 
 #endif // QOPCUANODEIMPL_P_H
@@ -0,0 +1,344 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuareaditem.h"
+#include "qopcuareaditem_p.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaReadItem
+    \inmodule QtOpcUa
+    \brief Describes the attributes of a node which are to be read
+
+    This class is used to pass the nodes and attributes to read to
+    \l QOpcUaClient::readNodeAttributes().
+
+    A read item contains the node id, the attributes of the node which are to be read
+    and an optional index range for array values. Each attribute of an item results in
+    one entry in the result vector.
+
+    \sa QOpcUaReadItemResult
+*/
+
+/*!
+    \class QOpcUaReadItemResult
+    \inmodule QtOpcUa
+    \brief Contains the result of reading a single attribute of a node
+
+    This class is used to return the results of a call to \l QOpcUaClient::readNodeAttributes().
+
+    \sa QOpcUaReadItem
+*/
+
+/*!
+    Creates an empty QOpcUaReadItem object.
+*/
+QOpcUaReadItem::QOpcUaReadItem()
+    : d_ptr(new QOpcUaReadItemPrivate())
+{}
+
+/*!
+    Creates a read item for the attributes \a attributes of the node \a nodeId.
+    If \a indexRange is not empty, only the specified part of array values is read.
+*/
+QOpcUaReadItem::QOpcUaReadItem(const QString &nodeId, QOpcUa::NodeAttributes attributes, const QString &indexRange)
+    : d_ptr(new QOpcUaReadItemPrivate())
+{
+    d_ptr->nodeId = nodeId;
+    d_ptr->attributes = attributes;
+    d_ptr->indexRange = indexRange;
+}
+
+/*!
+    Creates a copy of the QOpcUaReadItem object \a other.
+*/
+QOpcUaReadItem::QOpcUaReadItem(const QOpcUaReadItem &other)
+    : d_ptr(other.d_ptr)
+{}
+
+/*!
+    Assigns the value of \a other to this object.
+*/
+QOpcUaReadItem &QOpcUaReadItem::operator=(const QOpcUaReadItem &other)
+{
+    d_ptr = other.d_ptr;
+    return *this;
+}
+
+/*!
+    Destructor for QOpcUaReadItem.
+*/
+QOpcUaReadItem::~QOpcUaReadItem()
+{}
+
+/*!
+    Returns the node id of the node to read.
+*/
+QString QOpcUaReadItem::nodeId() const
+{
+    return d_ptr->nodeId;
+}
+
+/*!
+    Sets the node id of the node to read to \a nodeId.
+*/
+void QOpcUaReadItem::setNodeId(const QString &nodeId)
+{
+    d_ptr->nodeId = nodeId;
+}
+
+/*!
+    Returns the attributes to read.
+*/
+QOpcUa::NodeAttributes QOpcUaReadItem::attributes() const
+{
+    return d_ptr->attributes;
+}
+
+/*!
+    Sets the attributes to read to \a attributes.
+*/
+void QOpcUaReadItem::setAttributes(QOpcUa::NodeAttributes attributes)
+{
+    d_ptr->attributes = attributes;
+}
+
+/*!
+    Returns the index range to read.
+*/
+QString QOpcUaReadItem::indexRange() const
+{
+    return d_ptr->indexRange;
+}
+
+/*!
+    Sets the index range to read to \a indexRange.
+*/
+void QOpcUaReadItem::setIndexRange(const QString &indexRange)
+{
+    d_ptr->indexRange = indexRange;
+}
+
+/*!
+    Creates an empty QOpcUaReadItemResult object.
+*/
+QOpcUaReadItemResult::QOpcUaReadItemResult()
+    : d_ptr(new QOpcUaReadItemResultPrivate())
+{}
+
+/*!
+    Creates a copy of the QOpcUaReadItemResult object \a other.
+*/
+QOpcUaReadItemResult::QOpcUaReadItemResult(const QOpcUaReadItemResult &other)
+    : d_ptr(other.d_ptr)
+{}
+
+/*!
+    Assigns the value of \a other to this object.
+*/
+QOpcUaReadItemResult &QOpcUaReadItemResult::operator=(const QOpcUaReadItemResult &other)
+{
+    d_ptr = other.d_ptr;
+    return *this;
+}
+
+/*!
+    Destructor for QOpcUaReadItemResult.
+*/
+QOpcUaReadItemResult::~QOpcUaReadItemResult()
+{}
+
+/*!
+    Returns the node id of the node which has been read.
+*/
+QString QOpcUaReadItemResult::nodeId() const
+{
+    return d_ptr->nodeId;
+}
+
+/*!
+    Sets the node id to \a nodeId.
+*/
+void QOpcUaReadItemResult::setNodeId(const QString &nodeId)
+{
+    d_ptr->nodeId = nodeId;
+}
+
+/*!
+    Returns the attribute which has been read.
+*/
+QOpcUa::NodeAttribute QOpcUaReadItemResult::attribute() const
+{
+    return d_ptr->attribute;
+}
+
+/*!
+    Sets the attribute to \a attribute.
+*/
+void QOpcUaReadItemResult::setAttribute(QOpcUa::NodeAttribute attribute)
+{
+    d_ptr->attribute = attribute;
+}
+
+/*!
+    Returns the index range which has been requested.
+*/
+QString QOpcUaReadItemResult::indexRange() const
+{
+    return d_ptr->indexRange;
+}
+
+/*!
+    Sets the index range to \a indexRange.
+*/
+void QOpcUaReadItemResult::setIndexRange(const QString &indexRange)
+{
+    d_ptr->indexRange = indexRange;
+}
+
+/*!
+    Returns the status code of the read operation for this attribute.
+*/
+QOpcUa::UaStatusCode QOpcUaReadItemResult::statusCode() const
+{
+    return d_ptr->statusCode;
+}
+
+/*!
+    Sets the status code to \a statusCode.
+*/
+void QOpcUaReadItemResult::setStatusCode(QOpcUa::UaStatusCode statusCode)
+{
+    d_ptr->statusCode = statusCode;
+}
+
+/*!
+    Returns the source timestamp of the value.
+
+    The QDateTime is created from the raw timestamp on every call,
+    use \l rawSourceTimestamp() to avoid the conversion.
+*/
+QDateTime QOpcUaReadItemResult::sourceTimestamp() const
+{
+    return QOpcUa::dateTimeFromTicks(d_ptr->sourceTimestamp);
+}
+
+/*!
+    Sets the source timestamp to \a sourceTimestamp.
+*/
+void QOpcUaReadItemResult::setSourceTimestamp(const QDateTime &sourceTimestamp)
+{
+    d_ptr->sourceTimestamp = QOpcUa::ticksFromDateTime(sourceTimestamp);
+}
+
+/*!
+    Returns the server timestamp of the value.
+
+    The QDateTime is created from the raw timestamp on every call,
+    use \l rawServerTimestamp() to avoid the conversion.
+*/
+QDateTime QOpcUaReadItemResult::serverTimestamp() const
+{
+    return QOpcUa::dateTimeFromTicks(d_ptr->serverTimestamp);
+}
+
+/*!
+    Sets the server timestamp to \a serverTimestamp.
+*/
+void QOpcUaReadItemResult::setServerTimestamp(const QDateTime &serverTimestamp)
+{
+    d_ptr->serverTimestamp = QOpcUa::ticksFromDateTime(serverTimestamp);
+}
+
+/*!
+    Returns the source timestamp of the value as the number of 100 nanosecond
+    intervals since January 1, 1601 (UTC), or 0 if the server didn't send one.
+
+    \sa QOpcUa::dateTimeFromTicks()
+*/
+qint64 QOpcUaReadItemResult::rawSourceTimestamp() const
+{
+    return d_ptr->sourceTimestamp;
+}
+
+/*!
+    Sets the source timestamp to \a sourceTimestamp in 100 nanosecond intervals since January 1, 1601 (UTC).
+*/
+void QOpcUaReadItemResult::setRawSourceTimestamp(qint64 sourceTimestamp)
+{
+    d_ptr->sourceTimestamp = sourceTimestamp;
+}
+
+/*!
+    Returns the server timestamp of the value as the number of 100 nanosecond
+    intervals since January 1, 1601 (UTC), or 0 if the server didn't send one.
+
+    \sa QOpcUa::dateTimeFromTicks()
+*/
+qint64 QOpcUaReadItemResult::rawServerTimestamp() const
+{
+    return d_ptr->serverTimestamp;
+}
+
+/*!
+    Sets the server timestamp to \a serverTimestamp in 100 nanosecond intervals since January 1, 1601 (UTC).
+*/
+void QOpcUaReadItemResult::setRawServerTimestamp(qint64 serverTimestamp)
+{
+    d_ptr->serverTimestamp = serverTimestamp;
+}
+
+/*!
+    Returns the value of the attribute.
+*/
+QVariant QOpcUaReadItemResult::value() const
+{
+    if (d_ptr->encodedValue)
+        return d_ptr->encodedValue->value();
+    return d_ptr->value;
+}
+
+/*!
+    Sets the value to \a value.
+*/
+void QOpcUaReadItemResult::setValue(const QVariant &value)
+{
+    d_ptr->value = value;
+    d_ptr->encodedValue.reset();
+}
+
+QT_END_NAMESPACE
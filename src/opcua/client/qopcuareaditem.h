@@ -0,0 +1,114 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUAREADITEM_H
+#define QOPCUAREADITEM_H
+
+#include <QtOpcUa/qopcuatype.h>
+
+#include <QtCore/qdatetime.h>
+#include <QtCore/qshareddata.h>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaReadItemPrivate;
+class QOpcUaReadItemResultPrivate;
+
+class Q_OPCUA_EXPORT QOpcUaReadItem
+{
+public:
+    QOpcUaReadItem();
+    QOpcUaReadItem(const QString &nodeId, QOpcUa::NodeAttributes attributes = QOpcUa::NodeAttribute::Value,
+                   const QString &indexRange = QString());
+    QOpcUaReadItem(const QOpcUaReadItem &other);
+    QOpcUaReadItem &operator=(const QOpcUaReadItem &other);
+
+    ~QOpcUaReadItem();
+
+    QString nodeId() const;
+    void setNodeId(const QString &nodeId);
+    QOpcUa::NodeAttributes attributes() const;
+    void setAttributes(QOpcUa::NodeAttributes attributes);
+    QString indexRange() const;
+    void setIndexRange(const QString &indexRange);
+
+private:
+    QSharedDataPointer<QOpcUaReadItemPrivate> d_ptr;
+};
+
+Q_DECLARE_TYPEINFO(QOpcUaReadItem, Q_MOVABLE_TYPE);
+
+class Q_OPCUA_EXPORT QOpcUaReadItemResult
+{
+public:
+    QOpcUaReadItemResult();
+    QOpcUaReadItemResult(const QOpcUaReadItemResult &other);
+    QOpcUaReadItemResult &operator=(const QOpcUaReadItemResult &other);
+
+    ~QOpcUaReadItemResult();
+
+    QString nodeId() const;
+    void setNodeId(const QString &nodeId);
+    QOpcUa::NodeAttribute attribute() const;
+    void setAttribute(QOpcUa::NodeAttribute attribute);
+    QString indexRange() const;
+    void setIndexRange(const QString &indexRange);
+    QOpcUa::UaStatusCode statusCode() const;
+    void setStatusCode(QOpcUa::UaStatusCode statusCode);
+    QDateTime sourceTimestamp() const;
+    void setSourceTimestamp(const QDateTime &sourceTimestamp);
+    QDateTime serverTimestamp() const;
+    void setServerTimestamp(const QDateTime &serverTimestamp);
+    qint64 rawSourceTimestamp() const;
+    void setRawSourceTimestamp(qint64 sourceTimestamp);
+    qint64 rawServerTimestamp() const;
+    void setRawServerTimestamp(qint64 serverTimestamp);
+    QVariant value() const;
+    void setValue(const QVariant &value);
+
+private:
+    QSharedDataPointer<QOpcUaReadItemResultPrivate> d_ptr;
+    friend class QOpcUaReadItemResultPrivate;
+};
+
+Q_DECLARE_TYPEINFO(QOpcUaReadItemResult, Q_MOVABLE_TYPE);
+
+QT_END_NAMESPACE
+
+Q_DECLARE_METATYPE(QOpcUaReadItem)
+Q_DECLARE_METATYPE(QOpcUaReadItemResult)
+
+#endif // QOPCUAREADITEM_H
@@ -0,0 +1,92 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUAREADITEM_P_H
+#define QOPCUAREADITEM_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtOpcUa/qopcuatype.h>
+#include <QtOpcUa/qopcuareaditem.h>
+#include <private/qopcuaencodedvalue_p.h>
+
+#include <QtCore/qdatetime.h>
+#include <QtCore/qshareddata.h>
+#include <QtCore/qsharedpointer.h>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaReadItemPrivate : public QSharedData
+{
+public:
+    QString nodeId;
+    QOpcUa::NodeAttributes attributes = QOpcUa::NodeAttribute::Value;
+    QString indexRange;
+};
+
+class QOpcUaReadItemResultPrivate : public QSharedData
+{
+public:
+    QString nodeId;
+    QOpcUa::NodeAttribute attribute = QOpcUa::NodeAttribute::None;
+    QString indexRange;
+    QOpcUa::UaStatusCode statusCode = QOpcUa::UaStatusCode::Good;
+    // Raw OPC UA timestamps, QDateTime objects are only created on access
+    qint64 sourceTimestamp = 0;
+    qint64 serverTimestamp = 0;
+    QVariant value;
+    // Set instead of value if the backend delivers the value undecoded
+    QSharedPointer<QOpcUaEncodedValue> encodedValue;
+
+    static void setEncodedValue(QOpcUaReadItemResult &result, const QSharedPointer<QOpcUaEncodedValue> &value)
+    {
+        result.d_ptr->value = QVariant();
+        result.d_ptr->encodedValue = value;
+    }
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUAREADITEM_P_H
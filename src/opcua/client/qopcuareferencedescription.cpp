@@ -44,7 +44,8 @@ QT_BEGIN_NAMESPACE
     \inmodule QtOpcUa
     \brief Contains information about a node
 
-    This class is used to return the results of a call to \l QOpcUaNode::browseChildren().
+    This class is used to return the results of a call to \l QOpcUaNode::browseChildren()
+    and \l QOpcUaClient::browseRecursive().
 
     It contains the type of the reference used to connect the child node to the parent
     and the values of the following attributes of the node:
@@ -134,6 +135,8 @@ void QOpcUaReferenceDescription::setBrowseName(const QOpcUa::QQualifiedName &bro
 */
 QString QOpcUaReferenceDescription::nodeId() const
 {
+    if (d_ptr->nodeId.isEmpty() && !d_ptr->targetNodeId.isNull())
+        return d_ptr->targetNodeId.toString();
     return d_ptr->nodeId;
 }
 
@@ -143,6 +146,29 @@ QString QOpcUaReferenceDescription::nodeId() const
 void QOpcUaReferenceDescription::setNodeId(const QString &nodeId)
 {
     d_ptr->nodeId = nodeId;
+    d_ptr->targetNodeId = QOpcUaNodeId();
+}
+
+/*!
+    Returns the node id of the node in parsed form.
+
+    Backends which deliver browse results as \l QOpcUaNodeId don't have to format
+    the node id as string, which is only done if \l nodeId() is called.
+*/
+QOpcUaNodeId QOpcUaReferenceDescription::targetNodeId() const
+{
+    if (d_ptr->targetNodeId.isNull() && !d_ptr->nodeId.isEmpty())
+        return QOpcUaNodeId::fromString(d_ptr->nodeId);
+    return d_ptr->targetNodeId;
+}
+
+/*!
+    Sets the node id of the node to \a nodeId.
+*/
+void QOpcUaReferenceDescription::setNodeId(const QOpcUaNodeId &nodeId)
+{
+    d_ptr->targetNodeId = nodeId;
+    d_ptr->nodeId.clear();
 }
 
 /*!
@@ -161,4 +187,23 @@ void QOpcUaReferenceDescription::setRefType(QOpcUa::ReferenceTypeId refType)
     d_ptr->refType = refType;
 }
 
+/*!
+    Returns the node id of the node which has been browsed to find this node.
+
+    The parent node id is only set for the results of \l QOpcUaClient::browseRecursive(),
+    it is empty for the results of \l QOpcUaNode::browseChildren().
+*/
+QString QOpcUaReferenceDescription::parentNodeId() const
+{
+    return d_ptr->parentNodeId;
+}
+
+/*!
+    Sets the node id of the browsed node to \a parentNodeId.
+*/
+void QOpcUaReferenceDescription::setParentNodeId(const QString &parentNodeId)
+{
+    d_ptr->parentNodeId = parentNodeId;
+}
+
 QT_END_NAMESPACE
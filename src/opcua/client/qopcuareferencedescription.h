@@ -37,6 +37,7 @@
 #ifndef QOPCUAREFERENCEDESCRIPTION_H
 #define QOPCUAREFERENCEDESCRIPTION_H
 
+#include <QtOpcUa/qopcuanodeid.h>
 #include <QtOpcUa/qopcuatype.h>
 
 #include <QtCore/qshareddata.h>
@@ -58,12 +59,16 @@ public:
     void setRefType(QOpcUa::ReferenceTypeId refType);
     QString nodeId() const;
     void setNodeId(const QString &nodeId);
+    QOpcUaNodeId targetNodeId() const;
+    void setNodeId(const QOpcUaNodeId &nodeId);
     QOpcUa::QQualifiedName browseName() const;
     void setBrowseName(const QOpcUa::QQualifiedName &browseName);
     QOpcUa::QLocalizedText displayName() const;
     void setDisplayName(const QOpcUa::QLocalizedText &displayName);
     QOpcUa::NodeClass nodeClass() const;
     void setNodeClass(QOpcUa::NodeClass nodeClass);
+    QString parentNodeId() const;
+    void setParentNodeId(const QString &parentNodeId);
 
 private:
     QSharedDataPointer<QOpcUaReferenceDescriptionPrivate> d_ptr;
@@ -48,6 +48,7 @@
 // We mean it.
 //
 
+#include <QtOpcUa/qopcuanodeid.h>
 #include <QtOpcUa/qopcuatype.h>
 
 #include <QtCore/qshareddata.h>
@@ -58,10 +59,12 @@ class QOpcUaReferenceDescriptionPrivate : public QSharedData
 {
 public:
     QOpcUa::ReferenceTypeId refType;
-    QString nodeId;
+    QString nodeId; // Empty if the node id has been set as QOpcUaNodeId
+    QOpcUaNodeId targetNodeId;
     QOpcUa::QQualifiedName browseName;
     QOpcUa::QLocalizedText displayName;
     QOpcUa::NodeClass nodeClass;
+    QString parentNodeId;
 };
 
 QT_END_NAMESPACE
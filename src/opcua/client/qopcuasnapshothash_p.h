@@ -0,0 +1,146 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUASNAPSHOTHASH_P_H
+#define QOPCUASNAPSHOTHASH_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qhash.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qthread.h>
+
+#include <atomic>
+
+QT_BEGIN_NAMESPACE
+
+// Hash which is rarely modified by the client thread and looked up for every data change by
+// the threads which deliver the data changes. Lookups don't take a lock.
+// The hash is kept in two slots with a lookup counter each. A modification writes a new copy into
+// the inactive slot and makes it the active one, the copy in the other slot is deleted when that slot
+// is reused by the next modification. Lookups which start after a switch use the new slot, so a
+// modification only waits for lookups which have been started before the previous switch.
+// A lookup increments the counter of its slot before it checks that the slot is still active, a
+// modification switches the slot before it checks the counter of the slot it reuses next time.
+// Both sides use sequentially consistent operations, one of them always sees the other.
+// An empty hash is published as null, lookups in it only load two values.
+template <typename Key, typename T>
+class QOpcUaSnapshotHash
+{
+public:
+    QOpcUaSnapshotHash()
+        : m_active(0)
+    {
+        for (Slot &slot : m_slots) {
+            slot.hash = nullptr;
+            slot.lookups = 0;
+        }
+    }
+
+    ~QOpcUaSnapshotHash()
+    {
+        for (Slot &slot : m_slots)
+            delete slot.hash.load();
+    }
+
+    T value(const Key &key) const
+    {
+        for (;;) {
+            const int index = m_active.load();
+            const Slot &slot = m_slots[index];
+            if (!slot.hash.load())
+                return T();
+
+            ++slot.lookups;
+            if (m_active.load() == index) {
+                const QHash<Key, T> *hash = slot.hash.load();
+                const T result = hash ? hash->value(key) : T();
+                --slot.lookups;
+                return result;
+            }
+            // The slot has been switched after it has been loaded, its copy may be replaced
+            --slot.lookups;
+        }
+    }
+
+    // The modifier is called with a copy of the current hash
+    template <typename Modifier>
+    void modify(Modifier modifier)
+    {
+        QMutexLocker locker(&m_writeMutex);
+
+        const int active = m_active.load();
+        const QHash<Key, T> *current = m_slots[active].hash.load();
+        QHash<Key, T> *next = current ? new QHash<Key, T>(*current) : new QHash<Key, T>();
+        modifier(*next);
+        if (next->isEmpty()) {
+            delete next;
+            next = nullptr;
+        }
+
+        // Only lookups which loaded the inactive slot before the previous switch can still use its copy
+        Slot &inactive = m_slots[1 - active];
+        while (inactive.lookups.load() != 0)
+            QThread::yieldCurrentThread();
+        delete inactive.hash.exchange(next);
+        m_active.store(1 - active);
+    }
+
+private:
+    Q_DISABLE_COPY(QOpcUaSnapshotHash)
+
+    struct Slot {
+        std::atomic<const QHash<Key, T> *> hash;
+        mutable std::atomic<int> lookups;
+    };
+
+    Slot m_slots[2];
+    std::atomic<int> m_active;
+    QMutex m_writeMutex;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUASNAPSHOTHASH_P_H
@@ -0,0 +1,187 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuastatisticscollector_p.h"
+
+QT_BEGIN_NAMESPACE
+
+// The value converters have no client context, their counters are shared by all clients
+static QBasicAtomicInteger<quint64> conversionCounter = Q_BASIC_ATOMIC_INITIALIZER(0);
+static QBasicAtomicInteger<qint64> conversionNanoseconds = Q_BASIC_ATOMIC_INITIALIZER(0);
+static thread_local int conversionDepth = 0;
+
+static int latencyBucket(qint64 latency)
+{
+    static const QVector<int> limits = QOpcUaClientStatistics::latencyBucketLimits();
+    const qint64 microseconds = latency / 1000;
+    for (int i = 0; i < limits.size(); ++i) {
+        if (microseconds <= limits.at(i))
+            return i;
+    }
+    return limits.size();
+}
+
+QOpcUaStatisticsCollector::QOpcUaStatisticsCollector()
+{
+}
+
+void QOpcUaStatisticsCollector::requestStarted(QOpcUaClientStatistics::Service service)
+{
+    m_services[int(service)].inFlight.ref();
+}
+
+// Latency is the time in nanoseconds between requestStarted() and the response
+void QOpcUaStatisticsCollector::requestFinished(QOpcUaClientStatistics::Service service, qint64 latency)
+{
+    ServiceCounters &counters = m_services[int(service)];
+    counters.inFlight.deref();
+    counters.requests.fetchAndAddRelaxed(1);
+    counters.totalLatency.fetchAndAddRelaxed(quint64(qMax<qint64>(0, latency)));
+    counters.latencyBuckets[latencyBucket(latency)].fetchAndAddRelaxed(1);
+}
+
+// Counts a request which has been handled by the SDK without a measurable latency
+void QOpcUaStatisticsCollector::requestCompleted(QOpcUaClientStatistics::Service service)
+{
+    m_services[int(service)].requests.fetchAndAddRelaxed(1);
+}
+
+void QOpcUaStatisticsCollector::notificationsReceived(quint32 subscriptionId, int count)
+{
+    if (!subscriptionId || count <= 0)
+        return;
+
+    // Linear search starting at the preferred slot, a free slot is claimed if the subscription is unknown.
+    // Concurrent callers may claim two slots for the same subscription, they are summed up in the snapshot.
+    const int start = subscriptionId % MaxSubscriptions;
+    int freeSlot = -1;
+    for (int i = 0; i < MaxSubscriptions; ++i) {
+        SubscriptionCounters &slot = m_subscriptions[(start + i) % MaxSubscriptions];
+        const quint32 id = slot.id.loadAcquire();
+        if (id == subscriptionId) {
+            slot.notifications.fetchAndAddRelaxed(count);
+            return;
+        }
+        if (id == 0 && freeSlot < 0)
+            freeSlot = (start + i) % MaxSubscriptions;
+    }
+
+    if (freeSlot >= 0 && m_subscriptions[freeSlot].id.testAndSetOrdered(0, subscriptionId))
+        m_subscriptions[freeSlot].notifications.fetchAndAddRelaxed(count);
+    // Notifications of subscriptions beyond the table size are not counted
+}
+
+void QOpcUaStatisticsCollector::subscriptionRemoved(quint32 subscriptionId)
+{
+    for (SubscriptionCounters &slot : m_subscriptions) {
+        if (slot.id.loadAcquire() == subscriptionId) {
+            slot.notifications.store(0);
+            slot.id.storeRelease(0);
+        }
+    }
+}
+
+void QOpcUaStatisticsCollector::valueSuppressed()
+{
+    m_suppressedValues.fetchAndAddRelaxed(1);
+}
+
+void QOpcUaStatisticsCollector::addTo(QOpcUaClientStatisticsPrivate *statistics, int session) const
+{
+    for (int i = 0; i < QOpcUaClientStatisticsPrivate::ServiceCount; ++i) {
+        const ServiceCounters &counters = m_services[i];
+        QOpcUaClientStatisticsPrivate::ServiceStatistics &target = statistics->services[i];
+        target.requests += counters.requests.load();
+        target.inFlight += qMax(0, counters.inFlight.load());
+        target.totalLatency += counters.totalLatency.load();
+        for (int j = 0; j < QOpcUaClientStatisticsPrivate::LatencyBucketCount; ++j)
+            target.latencyBuckets[j] += counters.latencyBuckets[j].load();
+    }
+
+    for (const SubscriptionCounters &slot : m_subscriptions) {
+        const quint32 id = slot.id.loadAcquire();
+        if (id)
+            statistics->notificationCounts[QOpcUaClientStatistics::SubscriptionKey(session, id)] += slot.notifications.load();
+    }
+
+    statistics->suppressedValues += m_suppressedValues.load();
+}
+
+const char *QOpcUaStatisticsCollector::serviceName(QOpcUaClientStatistics::Service service)
+{
+    static const char *names[QOpcUaClientStatisticsPrivate::ServiceCount] = {
+        "Read", "Write", "Browse", "Call", "CreateMonitoredItems", "Publish"
+    };
+    return names[int(service)];
+}
+
+void QOpcUaStatisticsCollector::addConversionTime(qint64 time)
+{
+    conversionCounter.fetchAndAddRelaxed(1);
+    conversionNanoseconds.fetchAndAddRelaxed(time);
+}
+
+quint64 QOpcUaStatisticsCollector::conversionCount()
+{
+    return conversionCounter.load();
+}
+
+qint64 QOpcUaStatisticsCollector::conversionTime()
+{
+    return conversionNanoseconds.load();
+}
+
+QOpcUaStatisticsCollector::ConversionTimer::ConversionTimer()
+    : m_traced(false)
+{
+    if (conversionDepth++ == 0) {
+        m_traced = QOpcUaTracer::isEnabled();
+        if (m_traced)
+            QOpcUaTracer::begin("Conversion", "conversion");
+        m_timer.start();
+    }
+}
+
+QOpcUaStatisticsCollector::ConversionTimer::~ConversionTimer()
+{
+    if (--conversionDepth == 0) {
+        addConversionTime(m_timer.nsecsElapsed());
+        if (m_traced)
+            QOpcUaTracer::end("Conversion", "conversion");
+    }
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,150 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUASTATISTICSCOLLECTOR_P_H
+#define QOPCUASTATISTICSCOLLECTOR_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtOpcUa/qopcuaclientstatistics.h>
+#include <private/qopcuaclientstatistics_p.h>
+#include <private/qopcuatracer_p.h>
+
+#include <QtCore/qatomic.h>
+#include <QtCore/qelapsedtimer.h>
+
+QT_BEGIN_NAMESPACE
+
+// Collects the statistics of one backend. The counters are updated with atomic operations
+// by the backend and SDK threads and are read without locking by the client thread.
+// The snapshot is not taken atomically as a whole, counters may be off by the requests
+// which finish while it is taken.
+class Q_OPCUA_EXPORT QOpcUaStatisticsCollector
+{
+public:
+    QOpcUaStatisticsCollector();
+
+    void requestStarted(QOpcUaClientStatistics::Service service);
+    void requestFinished(QOpcUaClientStatistics::Service service, qint64 latency);
+    void requestCompleted(QOpcUaClientStatistics::Service service);
+
+    void notificationsReceived(quint32 subscriptionId, int count);
+    void subscriptionRemoved(quint32 subscriptionId);
+
+    void valueSuppressed();
+
+    // session is the index of the backend in a client with several sessions
+    void addTo(QOpcUaClientStatisticsPrivate *statistics, int session) const;
+
+    static const char *serviceName(QOpcUaClientStatistics::Service service);
+
+    static void addConversionTime(qint64 time);
+    static quint64 conversionCount();
+    static qint64 conversionTime();
+
+    // Measures and traces a synchronous service call
+    class ServiceTimer
+    {
+    public:
+        ServiceTimer(QOpcUaStatisticsCollector &collector, QOpcUaClientStatistics::Service service)
+            : m_collector(collector)
+            , m_service(service)
+            , m_trace(serviceName(service), "service")
+        {
+            m_collector.requestStarted(m_service);
+            m_timer.start();
+        }
+        ~ServiceTimer()
+        {
+            m_collector.requestFinished(m_service, m_timer.nsecsElapsed());
+        }
+
+    private:
+        Q_DISABLE_COPY(ServiceTimer)
+        QOpcUaStatisticsCollector &m_collector;
+        QOpcUaClientStatistics::Service m_service;
+        QOpcUaTraceScope m_trace;
+        QElapsedTimer m_timer;
+    };
+
+    // Measures and traces the outermost call of a value converter, nested calls are part of its time
+    class ConversionTimer
+    {
+    public:
+        ConversionTimer();
+        ~ConversionTimer();
+
+    private:
+        Q_DISABLE_COPY(ConversionTimer)
+        QElapsedTimer m_timer;
+        bool m_traced;
+    };
+
+private:
+    Q_DISABLE_COPY(QOpcUaStatisticsCollector)
+
+    enum { MaxSubscriptions = 64 };
+
+    struct ServiceCounters {
+        QAtomicInteger<quint64> requests;
+        QAtomicInt inFlight;
+        QAtomicInteger<quint64> totalLatency;
+        QAtomicInteger<quint64> latencyBuckets[QOpcUaClientStatisticsPrivate::LatencyBucketCount];
+    };
+
+    // A subscription id of 0 marks a free slot
+    struct SubscriptionCounters {
+        QAtomicInteger<quint32> id;
+        QAtomicInteger<quint64> notifications;
+    };
+
+    ServiceCounters m_services[QOpcUaClientStatisticsPrivate::ServiceCount];
+    SubscriptionCounters m_subscriptions[MaxSubscriptions];
+    QAtomicInteger<quint64> m_suppressedValues;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUASTATISTICSCOLLECTOR_P_H
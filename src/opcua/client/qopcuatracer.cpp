@@ -0,0 +1,262 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuatracer_p.h"
+
+#include <QtCore/qcoreapplication.h>
+#include <QtCore/qfile.h>
+#include <QtCore/qloggingcategory.h>
+#include <QtCore/qthread.h>
+
+QT_BEGIN_NAMESPACE
+
+Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA)
+
+/*!
+    \class QOpcUaTracer
+    \internal
+
+    Records begin and end events of backend service calls, value conversions and the
+    delivery of backend results to the client thread, and writes them in the Chrome trace
+    event format which can be loaded into chrome://tracing or Perfetto.
+
+    Every thread records into its own buffer without locking. A buffer holds up to
+    65536 events, further events of the thread are dropped.
+
+    Tracing is enabled with QOpcUaProvider::setTracingEnabled() or by setting the
+    \c QT_OPCUA_TRACE environment variable to the name of a file the trace is written
+    to when the process exits.
+*/
+
+static const int threadBufferCapacity = 1 << 16;
+
+Q_GLOBAL_STATIC(QOpcUaTracer, opcuaTracer)
+
+QBasicAtomicInt QOpcUaTracer::enabled = Q_BASIC_ATOMIC_INITIALIZER(0);
+
+static QBasicAtomicInteger<quint64> idCounter = Q_BASIC_ATOMIC_INITIALIZER(0);
+
+QOpcUaTracer::QOpcUaTracer()
+{
+    m_clock.start();
+    m_traceFile = qEnvironmentVariable("QT_OPCUA_TRACE");
+    if (!m_traceFile.isEmpty())
+        enabled.store(1);
+}
+
+QOpcUaTracer::~QOpcUaTracer()
+{
+    enabled.store(0);
+    if (!m_traceFile.isEmpty())
+        writeTrace(m_traceFile);
+    qDeleteAll(m_buffers);
+}
+
+/*!
+    Returns the tracer which is shared by all clients of the process.
+*/
+QOpcUaTracer *QOpcUaTracer::instance()
+{
+    return opcuaTracer();
+}
+
+void QOpcUaTracer::setEnabled(bool enable)
+{
+    // Make sure the environment has been evaluated before it is overridden
+    if (!instance())
+        return;
+    enabled.store(enable ? 1 : 0);
+}
+
+void QOpcUaTracer::begin(const char *name, const char *category)
+{
+    record('B', name, category, 0);
+}
+
+void QOpcUaTracer::end(const char *name, const char *category)
+{
+    record('E', name, category, 0);
+}
+
+/*!
+    Records the start of an operation which ends in a different call stack,
+    for example an asynchronous request which is finished by its response.
+*/
+void QOpcUaTracer::asyncBegin(const char *name, const char *category, quint64 id)
+{
+    record('b', name, category, id);
+}
+
+void QOpcUaTracer::asyncEnd(const char *name, const char *category, quint64 id)
+{
+    record('e', name, category, id);
+}
+
+/*!
+    Records the hand-over of \a name to another thread. The flow event
+    with the same \a id recorded by \l flowEnd() links both threads in the trace.
+*/
+void QOpcUaTracer::flowStart(const char *name, quint64 id)
+{
+    // Flow events are bound to a slice of their thread
+    record('B', name, "queue", 0);
+    record('s', name, "queue", id);
+    record('E', name, "queue", 0);
+}
+
+void QOpcUaTracer::flowEnd(const char *name, quint64 id)
+{
+    record('f', name, "queue", id);
+}
+
+/*!
+    Returns a process-wide unique id for asynchronous and flow events.
+*/
+quint64 QOpcUaTracer::nextId()
+{
+    return idCounter.fetchAndAddRelaxed(1) + 1;
+}
+
+void QOpcUaTracer::record(char phase, const char *name, const char *category, quint64 id)
+{
+    if (!isEnabled())
+        return;
+
+    QOpcUaTracer *tracer = instance();
+    if (!tracer)
+        return;
+
+    ThreadBuffer *buffer = tracer->currentThreadBuffer();
+    const int count = buffer->count.load();
+    if (count >= threadBufferCapacity)
+        return;
+
+    Event &event = buffer->events[count];
+    event.timestamp = tracer->m_clock.nsecsElapsed();
+    event.id = id;
+    event.name = name;
+    event.category = category;
+    event.phase = phase;
+    buffer->count.storeRelease(count + 1);
+}
+
+QOpcUaTracer::ThreadBuffer *QOpcUaTracer::currentThreadBuffer()
+{
+    // Buffers are owned by the tracer and outlive their threads
+    static thread_local ThreadBuffer *threadBuffer = nullptr;
+    if (threadBuffer)
+        return threadBuffer;
+
+    ThreadBuffer *buffer = new ThreadBuffer;
+    buffer->events.resize(threadBufferCapacity);
+    buffer->count.store(0);
+    if (QThread *thread = QThread::currentThread())
+        buffer->threadName = thread->objectName();
+
+    QMutexLocker locker(&m_mutex);
+    buffer->threadId = m_buffers.size() + 1;
+    if (buffer->threadName.isEmpty())
+        buffer->threadName = QStringLiteral("Thread %1").arg(buffer->threadId);
+    m_buffers.append(buffer);
+    threadBuffer = buffer;
+    return buffer;
+}
+
+static QByteArray qt_jsonString(const QString &s)
+{
+    QByteArray result = s.toUtf8();
+    result.replace('\\', "\\\\");
+    result.replace('"', "\\\"");
+    return '"' + result + '"';
+}
+
+/*!
+    Writes the events recorded so far to \a fileName in the Chrome trace event format.
+    Returns \c true on success.
+*/
+bool QOpcUaTracer::writeTrace(const QString &fileName) const
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qCWarning(QT_OPCUA) << "Could not open trace file" << fileName << file.errorString();
+        return false;
+    }
+
+    const QByteArray pid = QByteArray::number(QCoreApplication::applicationPid());
+    bool first = true;
+
+    file.write("{\"traceEvents\":[\n");
+
+    QMutexLocker locker(&m_mutex);
+    for (const ThreadBuffer *buffer : m_buffers) {
+        const QByteArray tid = QByteArray::number(buffer->threadId);
+        const QByteArray common = ",\"pid\":" + pid + ",\"tid\":" + tid;
+
+        QByteArray data;
+        if (!first)
+            data += ",\n";
+        first = false;
+        data += "{\"name\":\"thread_name\",\"ph\":\"M\"" + common + ",\"args\":{\"name\":" + qt_jsonString(buffer->threadName) + "}}";
+
+        const int count = buffer->count.loadAcquire();
+        for (int i = 0; i < count; ++i) {
+            const Event &event = buffer->events.at(i);
+            data += ",\n{\"name\":\"";
+            data += event.name;
+            data += "\",\"cat\":\"";
+            data += event.category;
+            data += "\",\"ph\":\"";
+            data += event.phase;
+            data += "\",\"ts\":";
+            data += QByteArray::number(event.timestamp / 1000.0, 'f', 3);
+            if (event.phase != 'B' && event.phase != 'E')
+                data += ",\"id\":" + QByteArray::number(event.id);
+            data += common;
+            data += '}';
+
+            if (data.size() > 65536) {
+                file.write(data);
+                data.clear();
+            }
+        }
+        file.write(data);
+    }
+
+    file.write("\n],\"displayTimeUnit\":\"ns\"}\n");
+    return file.error() == QFileDevice::NoError;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,139 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUATRACER_P_H
+#define QOPCUATRACER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtOpcUa/qopcuaglobal.h>
+
+#include <QtCore/qatomic.h>
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qstring.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+class Q_OPCUA_EXPORT QOpcUaTracer
+{
+public:
+    QOpcUaTracer();
+    ~QOpcUaTracer();
+
+    static QOpcUaTracer *instance();
+
+    static bool isEnabled() { return enabled.load(); }
+    static void setEnabled(bool enable);
+
+    // Names and categories must be string literals, the events only store the pointers
+    static void begin(const char *name, const char *category);
+    static void end(const char *name, const char *category);
+    static void asyncBegin(const char *name, const char *category, quint64 id);
+    static void asyncEnd(const char *name, const char *category, quint64 id);
+    static void flowStart(const char *name, quint64 id);
+    static void flowEnd(const char *name, quint64 id);
+
+    static quint64 nextId();
+
+    bool writeTrace(const QString &fileName) const;
+
+private:
+    Q_DISABLE_COPY(QOpcUaTracer)
+
+    struct Event {
+        qint64 timestamp;
+        quint64 id;
+        const char *name;
+        const char *category;
+        char phase;
+    };
+
+    // Written only by the owning thread, the number of valid events is published with release semantics
+    struct ThreadBuffer {
+        QVector<Event> events;
+        QAtomicInt count;
+        int threadId;
+        QString threadName;
+    };
+
+    static void record(char phase, const char *name, const char *category, quint64 id);
+    ThreadBuffer *currentThreadBuffer();
+
+    static QBasicAtomicInt enabled;
+
+    QElapsedTimer m_clock;
+    QString m_traceFile;
+    mutable QMutex m_mutex;
+    QVector<ThreadBuffer *> m_buffers;
+};
+
+// Records a complete slice on the current thread if tracing is enabled when it starts
+class QOpcUaTraceScope
+{
+public:
+    QOpcUaTraceScope(const char *name, const char *category)
+        : m_name(QOpcUaTracer::isEnabled() ? name : nullptr)
+        , m_category(category)
+    {
+        if (m_name)
+            QOpcUaTracer::begin(m_name, m_category);
+    }
+    ~QOpcUaTraceScope()
+    {
+        if (m_name)
+            QOpcUaTracer::end(m_name, m_category);
+    }
+
+private:
+    Q_DISABLE_COPY(QOpcUaTraceScope)
+    const char *m_name;
+    const char *m_category;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUATRACER_P_H
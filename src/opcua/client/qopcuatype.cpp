@@ -645,6 +645,40 @@ QString QOpcUa::nodeIdFromInteger(quint16 ns, quint32 identifier)
     return QStringLiteral("ns=%1;i=%2").arg(ns).arg(identifier);
 }
 
+// OPC-UA part 6, 5.2.2.5: 100 nanosecond intervals since 1601-01-01 00:00 UTC
+static const qint64 ticksPerMSec = 10000;
+static const qint64 ticksFrom1601To1970 = Q_INT64_C(116444736000000000);
+
+/*!
+    Converts an OPC UA DateTime given as the number of 100 nanosecond intervals since
+    January 1, 1601 (UTC) in \a ticks to a QDateTime in local time.
+
+    Returns a null QDateTime if \a ticks is 0, which OPC UA uses for timestamps that are not set.
+    The sub-millisecond part of \a ticks is lost because QDateTime has a precision of one millisecond.
+
+    \sa ticksFromDateTime(), QOpcUaReadItemResult::rawSourceTimestamp()
+*/
+QDateTime QOpcUa::dateTimeFromTicks(qint64 ticks)
+{
+    if (!ticks)
+        return QDateTime();
+    return QDateTime::fromMSecsSinceEpoch((ticks - ticksFrom1601To1970) / ticksPerMSec);
+}
+
+/*!
+    Converts \a dateTime to the number of 100 nanosecond intervals since January 1, 1601 (UTC).
+
+    Returns 0 for an invalid \a dateTime.
+
+    \sa dateTimeFromTicks()
+*/
+qint64 QOpcUa::ticksFromDateTime(const QDateTime &dateTime)
+{
+    if (!dateTime.isValid())
+        return 0;
+    return dateTime.toMSecsSinceEpoch() * ticksPerMSec + ticksFrom1601To1970;
+}
+
 /*!
     \class QOpcUa::QRange
     \inmodule QtOpcUa
@@ -39,6 +39,7 @@
 
 #include <QtOpcUa/qopcuaglobal.h>
 
+#include <QtCore/qdatetime.h>
 #include <QtCore/qmetatype.h>
 #include <QtCore/qpair.h>
 #include <QtCore/qvariant.h>
@@ -421,6 +422,10 @@ Q_OPCUA_EXPORT QString nodeIdFromByteString(quint16 ns, const QByteArray &identi
 Q_OPCUA_EXPORT QString nodeIdFromGuid(quint16 ns, const QUuid &identifier);
 Q_OPCUA_EXPORT QString nodeIdFromInteger(quint16 ns, quint32 identifier);
 
+// Timestamp helpers
+Q_OPCUA_EXPORT QDateTime dateTimeFromTicks(qint64 ticks);
+Q_OPCUA_EXPORT qint64 ticksFromDateTime(const QDateTime &dateTime);
+
 typedef QPair<QVariant, QOpcUa::Types> TypedVariant;
 
 struct QQualifiedName {
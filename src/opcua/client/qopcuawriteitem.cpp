@@ -0,0 +1,285 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuawriteitem.h"
+#include "qopcuawriteitem_p.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaWriteItem
+    \inmodule QtOpcUa
+    \brief Describes a value which is to be written to an attribute of a node
+
+    This class is used to pass the values to write to \l QOpcUaClient::writeNodeAttributes().
+
+    A write item contains the node id, the attribute to write, the new value
+    and its type and an optional index range for array values. If the type is
+    \l {QOpcUa::Types} {Undefined}, the type of all attributes except the Value attribute
+    is determined automatically.
+
+    \sa QOpcUaWriteItemResult
+*/
+
+/*!
+    \class QOpcUaWriteItemResult
+    \inmodule QtOpcUa
+    \brief Contains the result of writing a single attribute of a node
+
+    This class is used to return the results of a call to \l QOpcUaClient::writeNodeAttributes().
+
+    \sa QOpcUaWriteItem
+*/
+
+/*!
+    Creates an empty QOpcUaWriteItem object.
+*/
+QOpcUaWriteItem::QOpcUaWriteItem()
+    : d_ptr(new QOpcUaWriteItemPrivate())
+{}
+
+/*!
+    Creates a write item for the attribute \a attribute of the node \a nodeId.
+    \a value is written using the type \a type. If \a indexRange is not empty,
+    only the specified part of an array value is written.
+*/
+QOpcUaWriteItem::QOpcUaWriteItem(const QString &nodeId, QOpcUa::NodeAttribute attribute, const QVariant &value,
+                                 QOpcUa::Types type, const QString &indexRange)
+    : d_ptr(new QOpcUaWriteItemPrivate())
+{
+    d_ptr->nodeId = nodeId;
+    d_ptr->attribute = attribute;
+    d_ptr->value = value;
+    d_ptr->type = type;
+    d_ptr->indexRange = indexRange;
+}
+
+/*!
+    Creates a copy of the QOpcUaWriteItem object \a other.
+*/
+QOpcUaWriteItem::QOpcUaWriteItem(const QOpcUaWriteItem &other)
+    : d_ptr(other.d_ptr)
+{}
+
+/*!
+    Assigns the value of \a other to this object.
+*/
+QOpcUaWriteItem &QOpcUaWriteItem::operator=(const QOpcUaWriteItem &other)
+{
+    d_ptr = other.d_ptr;
+    return *this;
+}
+
+/*!
+    Destructor for QOpcUaWriteItem.
+*/
+QOpcUaWriteItem::~QOpcUaWriteItem()
+{}
+
+/*!
+    Returns the node id of the node to write.
+*/
+QString QOpcUaWriteItem::nodeId() const
+{
+    return d_ptr->nodeId;
+}
+
+/*!
+    Sets the node id of the node to write to \a nodeId.
+*/
+void QOpcUaWriteItem::setNodeId(const QString &nodeId)
+{
+    d_ptr->nodeId = nodeId;
+}
+
+/*!
+    Returns the attribute to write.
+*/
+QOpcUa::NodeAttribute QOpcUaWriteItem::attribute() const
+{
+    return d_ptr->attribute;
+}
+
+/*!
+    Sets the attribute to write to \a attribute.
+*/
+void QOpcUaWriteItem::setAttribute(QOpcUa::NodeAttribute attribute)
+{
+    d_ptr->attribute = attribute;
+}
+
+/*!
+    Returns the value to write.
+*/
+QVariant QOpcUaWriteItem::value() const
+{
+    return d_ptr->value;
+}
+
+/*!
+    Sets the value to write to \a value.
+*/
+void QOpcUaWriteItem::setValue(const QVariant &value)
+{
+    d_ptr->value = value;
+}
+
+/*!
+    Returns the type of the value to write.
+*/
+QOpcUa::Types QOpcUaWriteItem::type() const
+{
+    return d_ptr->type;
+}
+
+/*!
+    Sets the type of the value to write to \a type.
+*/
+void QOpcUaWriteItem::setType(QOpcUa::Types type)
+{
+    d_ptr->type = type;
+}
+
+/*!
+    Returns the index range to write.
+*/
+QString QOpcUaWriteItem::indexRange() const
+{
+    return d_ptr->indexRange;
+}
+
+/*!
+    Sets the index range to write to \a indexRange.
+*/
+void QOpcUaWriteItem::setIndexRange(const QString &indexRange)
+{
+    d_ptr->indexRange = indexRange;
+}
+
+/*!
+    Creates an empty QOpcUaWriteItemResult object.
+*/
+QOpcUaWriteItemResult::QOpcUaWriteItemResult()
+    : d_ptr(new QOpcUaWriteItemResultPrivate())
+{}
+
+/*!
+    Creates a copy of the QOpcUaWriteItemResult object \a other.
+*/
+QOpcUaWriteItemResult::QOpcUaWriteItemResult(const QOpcUaWriteItemResult &other)
+    : d_ptr(other.d_ptr)
+{}
+
+/*!
+    Assigns the value of \a other to this object.
+*/
+QOpcUaWriteItemResult &QOpcUaWriteItemResult::operator=(const QOpcUaWriteItemResult &other)
+{
+    d_ptr = other.d_ptr;
+    return *this;
+}
+
+/*!
+    Destructor for QOpcUaWriteItemResult.
+*/
+QOpcUaWriteItemResult::~QOpcUaWriteItemResult()
+{}
+
+/*!
+    Returns the node id of the node which has been written.
+*/
+QString QOpcUaWriteItemResult::nodeId() const
+{
+    return d_ptr->nodeId;
+}
+
+/*!
+    Sets the node id to \a nodeId.
+*/
+void QOpcUaWriteItemResult::setNodeId(const QString &nodeId)
+{
+    d_ptr->nodeId = nodeId;
+}
+
+/*!
+    Returns the attribute which has been written.
+*/
+QOpcUa::NodeAttribute QOpcUaWriteItemResult::attribute() const
+{
+    return d_ptr->attribute;
+}
+
+/*!
+    Sets the attribute to \a attribute.
+*/
+void QOpcUaWriteItemResult::setAttribute(QOpcUa::NodeAttribute attribute)
+{
+    d_ptr->attribute = attribute;
+}
+
+/*!
+    Returns the index range which has been written.
+*/
+QString QOpcUaWriteItemResult::indexRange() const
+{
+    return d_ptr->indexRange;
+}
+
+/*!
+    Sets the index range to \a indexRange.
+*/
+void QOpcUaWriteItemResult::setIndexRange(const QString &indexRange)
+{
+    d_ptr->indexRange = indexRange;
+}
+
+/*!
+    Returns the status code of the write operation for this attribute.
+*/
+QOpcUa::UaStatusCode QOpcUaWriteItemResult::statusCode() const
+{
+    return d_ptr->statusCode;
+}
+
+/*!
+    Sets the status code to \a statusCode.
+*/
+void QOpcUaWriteItemResult::setStatusCode(QOpcUa::UaStatusCode statusCode)
+{
+    d_ptr->statusCode = statusCode;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,106 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUAWRITEITEM_H
+#define QOPCUAWRITEITEM_H
+
+#include <QtOpcUa/qopcuatype.h>
+
+#include <QtCore/qshareddata.h>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaWriteItemPrivate;
+class QOpcUaWriteItemResultPrivate;
+
+class Q_OPCUA_EXPORT QOpcUaWriteItem
+{
+public:
+    QOpcUaWriteItem();
+    QOpcUaWriteItem(const QString &nodeId, QOpcUa::NodeAttribute attribute, const QVariant &value,
+                    QOpcUa::Types type = QOpcUa::Types::Undefined, const QString &indexRange = QString());
+    QOpcUaWriteItem(const QOpcUaWriteItem &other);
+    QOpcUaWriteItem &operator=(const QOpcUaWriteItem &other);
+
+    ~QOpcUaWriteItem();
+
+    QString nodeId() const;
+    void setNodeId(const QString &nodeId);
+    QOpcUa::NodeAttribute attribute() const;
+    void setAttribute(QOpcUa::NodeAttribute attribute);
+    QVariant value() const;
+    void setValue(const QVariant &value);
+    QOpcUa::Types type() const;
+    void setType(QOpcUa::Types type);
+    QString indexRange() const;
+    void setIndexRange(const QString &indexRange);
+
+private:
+    QSharedDataPointer<QOpcUaWriteItemPrivate> d_ptr;
+};
+
+Q_DECLARE_TYPEINFO(QOpcUaWriteItem, Q_MOVABLE_TYPE);
+
+class Q_OPCUA_EXPORT QOpcUaWriteItemResult
+{
+public:
+    QOpcUaWriteItemResult();
+    QOpcUaWriteItemResult(const QOpcUaWriteItemResult &other);
+    QOpcUaWriteItemResult &operator=(const QOpcUaWriteItemResult &other);
+
+    ~QOpcUaWriteItemResult();
+
+    QString nodeId() const;
+    void setNodeId(const QString &nodeId);
+    QOpcUa::NodeAttribute attribute() const;
+    void setAttribute(QOpcUa::NodeAttribute attribute);
+    QString indexRange() const;
+    void setIndexRange(const QString &indexRange);
+    QOpcUa::UaStatusCode statusCode() const;
+    void setStatusCode(QOpcUa::UaStatusCode statusCode);
+
+private:
+    QSharedDataPointer<QOpcUaWriteItemResultPrivate> d_ptr;
+};
+
+Q_DECLARE_TYPEINFO(QOpcUaWriteItemResult, Q_MOVABLE_TYPE);
+
+QT_END_NAMESPACE
+
+Q_DECLARE_METATYPE(QOpcUaWriteItem)
+Q_DECLARE_METATYPE(QOpcUaWriteItemResult)
+
+#endif // QOPCUAWRITEITEM_H
@@ -47,4 +47,15 @@ QOpcUaPlugin::~QOpcUaPlugin()
 {
 }
 
+/*!
+    Creates a client which is configured by the backend specific \a backendProperties.
+    Backends without configurable properties ignore them and return the same client
+    as \l createClient().
+*/
+QOpcUaClient *QOpcUaPlugin::createClient(const QVariantMap &backendProperties)
+{
+    Q_UNUSED(backendProperties);
+    return createClient();
+}
+
 QT_END_NAMESPACE
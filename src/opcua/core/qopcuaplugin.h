@@ -40,12 +40,13 @@
 #include <QtOpcUa/qopcuaglobal.h>
 
 #include <QtCore/qobject.h>
+#include <QtCore/qvariant.h>
 
 QT_BEGIN_NAMESPACE
 
 class QOpcUaClient;
 
-#define QOpcUaProviderFactory_iid "org.qt-project.qt.opcua.providerfactory/1.0"
+#define QOpcUaProviderFactory_iid "org.qt-project.qt.opcua.providerfactory/1.1"
 
 class Q_OPCUA_EXPORT QOpcUaPlugin : public QObject
 {
@@ -55,6 +56,7 @@ public:
     ~QOpcUaPlugin() override;
 
     virtual QOpcUaClient *createClient() = 0;
+    virtual QOpcUaClient *createClient(const QVariantMap &backendProperties);
 };
 Q_DECLARE_INTERFACE(QOpcUaPlugin, QOpcUaProviderFactory_iid)
 
@@ -40,6 +40,7 @@
 #include <QtOpcUa/qopcuanode.h>
 #include <QtOpcUa/qopcuatype.h>
 #include <private/qopcuanodeimpl_p.h>
+#include <private/qopcuatracer_p.h>
 
 #include <private/qfactoryloader_p.h>
 #include <QtCore/qjsonarray.h>
@@ -131,15 +132,18 @@ QOpcUaProvider::QOpcUaProvider(QObject *parent)
     qRegisterMetaType<QOpcUa::NodeAttributes>();
     qRegisterMetaType<QOpcUaNode::AttributeMap>();
     qRegisterMetaType<QVector<QOpcUaReadResult>>();
+    qRegisterMetaType<QOpcUaAttributeUpdate>();
+    qRegisterMetaType<QVector<QOpcUaAttributeUpdate>>();
     qRegisterMetaType<QOpcUaClient::ClientState>();
     qRegisterMetaType<QOpcUaClient::ClientError>();
     qRegisterMetaType<QOpcUa::ReferenceTypeId>();
-    qRegisterMetaType<uintptr_t>("uintptr_t");
     qRegisterMetaType<QOpcUaMonitoringParameters::SubscriptionType>();
     qRegisterMetaType<QOpcUaMonitoringParameters::Parameter>();
     qRegisterMetaType<QOpcUaMonitoringParameters::Parameters>();
     qRegisterMetaType<QOpcUaMonitoringParameters>();
     qRegisterMetaType<QOpcUaReferenceDescription>();
+    qRegisterMetaType<QOpcUaNodeId>();
+    qRegisterMetaType<QOpcUaArrayDelta>();
     qRegisterMetaType<QVector<QOpcUaReferenceDescription>>();
     qRegisterMetaType<QOpcUa::ReferenceTypeId>();
     qRegisterMetaType<QOpcUa::QRange>();
@@ -148,6 +152,18 @@ QOpcUaProvider::QOpcUaProvider(QObject *parent)
     qRegisterMetaType<QOpcUa::QDoubleComplexNumber>();
     qRegisterMetaType<QOpcUa::QAxisInformation>();
     qRegisterMetaType<QOpcUa::QXValue>();
+    qRegisterMetaType<QOpcUaReadItem>();
+    qRegisterMetaType<QVector<QOpcUaReadItem>>();
+    qRegisterMetaType<QOpcUaReadItemResult>();
+    qRegisterMetaType<QVector<QOpcUaReadItemResult>>();
+    qRegisterMetaType<QOpcUaWriteItem>();
+    qRegisterMetaType<QVector<QOpcUaWriteItem>>();
+    qRegisterMetaType<QOpcUaWriteItemResult>();
+    qRegisterMetaType<QVector<QOpcUaWriteItemResult>>();
+    qRegisterMetaType<QOpcUaCoalescedWrite>();
+    qRegisterMetaType<QVector<QOpcUaCoalescedWrite>>();
+    qRegisterMetaType<QOpcUaNodeHandle>();
+    qRegisterMetaType<QVector<QOpcUaNodeHandle>>();
 }
 
 QOpcUaProvider::~QOpcUaProvider()
@@ -176,6 +192,36 @@ static QOpcUaPlugin *loadPlugin(const QString &key)
     when it is no longer needed.
 */
 QOpcUaClient *QOpcUaProvider::createClient(const QString &backend)
+{
+    return createClient(backend, QVariantMap());
+}
+
+/*!
+    Returns a pointer to a QOpcUaClient object by loading the selected \a backend
+    as a plugin and creating a client object which is configured by \a backendProperties.
+    If the plugin loading fails, \c nullptr is returned instead.
+
+    The following properties are currently supported:
+
+    \table
+    \header
+        \li Backend
+        \li Property
+        \li Description
+    \row
+        \li open62541
+        \li \c sessionCount
+        \li The number of sessions the client opens to the endpoint. Each session is
+             served by its own backend thread and nodes are assigned to a session by
+             the hash of their node id. The default value is 1.
+    \endtable
+
+    Properties which are not supported by the backend are ignored.
+
+    The user is responsible for deleting the returned \l QOpcUaClient object
+    when it is no longer needed.
+*/
+QOpcUaClient *QOpcUaProvider::createClient(const QString &backend, const QVariantMap &backendProperties)
 {
     QOpcUaPlugin *plugin;
     auto it = m_plugins.find(backend);
@@ -191,7 +237,7 @@ QOpcUaClient *QOpcUaProvider::createClient(const QString &backend)
     else {
         plugin = it.value();
     }
-    return plugin->createClient();
+    return plugin->createClient(backendProperties);
 }
 
 /*!
@@ -202,4 +248,47 @@ QStringList QOpcUaProvider::availableBackends()
     return plugins().keys();
 }
 
+/*!
+    Enables or disables the recording of trace events for all clients of the process if \a enable is \c true.
+
+    The trace contains the service calls of the backends, the value conversions and the delivery
+    of the results from the backend threads to the thread of the client. It is written in the
+    Chrome trace event format by \l writeTrace() and can be inspected with chrome://tracing or Perfetto.
+
+    The delivery of results is only traced for clients which have been created after tracing
+    has been enabled. Setting the \c QT_OPCUA_TRACE environment variable to a file name enables
+    tracing at startup and writes the trace to that file when the process exits.
+
+    \sa writeTrace()
+*/
+void QOpcUaProvider::setTracingEnabled(bool enable)
+{
+    QOpcUaTracer::setEnabled(enable);
+}
+
+/*!
+    Returns \c true if trace events are recorded.
+
+    \sa setTracingEnabled()
+*/
+bool QOpcUaProvider::isTracingEnabled()
+{
+    QOpcUaTracer::instance(); // Evaluates QT_OPCUA_TRACE
+    return QOpcUaTracer::isEnabled();
+}
+
+/*!
+    Writes the trace events recorded so far to \a fileName in the Chrome trace event format.
+    Returns \c true on success.
+
+    Every thread records up to 65536 events, further events of the thread are dropped.
+
+    \sa setTracingEnabled()
+*/
+bool QOpcUaProvider::writeTrace(const QString &fileName)
+{
+    QOpcUaTracer *tracer = QOpcUaTracer::instance();
+    return tracer && tracer->writeTrace(fileName);
+}
+
 QT_END_NAMESPACE
@@ -55,10 +55,15 @@ class Q_OPCUA_EXPORT QOpcUaProvider : public QObject
 public:
     static QStringList availableBackends();
 
+    static void setTracingEnabled(bool enable);
+    static bool isTracingEnabled();
+    static bool writeTrace(const QString &fileName);
+
     explicit QOpcUaProvider(QObject *parent = nullptr);
     ~QOpcUaProvider() override;
 
     Q_INVOKABLE QOpcUaClient *createClient(const QString &backend);
+    Q_INVOKABLE QOpcUaClient *createClient(const QString &backend, const QVariantMap &backendProperties);
 
 private:
     QHash<QString, QOpcUaPlugin *> m_plugins;
@@ -38,6 +38,7 @@
 #include "qfreeopcuanode.h"
 #include "qfreeopcuavalueconverter.h"
 #include "qfreeopcuaworker.h"
+#include <private/qopcuabackendthreadpool_p.h>
 #include <private/qopcuaclient_p.h>
 
 #include <QtCore/qloggingcategory.h>
@@ -49,19 +50,18 @@ Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_FREEOPCUA)
 QFreeOpcUaClientImpl::QFreeOpcUaClientImpl()
     : QOpcUaClientImpl()
 {
-    m_thread = new QThread();
+    // All SDK calls of the worker are synchronous and would block other clients on a shared thread
+    m_thread = QOpcUaBackendThreadPool::instance()->acquireThread(QOpcUaBackendThreadPool::ThreadType::Dedicated);
     m_opcuaWorker = new QFreeOpcUaWorker(this);
     connectBackendWithClient(m_opcuaWorker);
     m_opcuaWorker->moveToThread(m_thread);
-    connect(m_thread, &QThread::finished, m_opcuaWorker, &QObject::deleteLater);
-    connect(m_thread, &QThread::finished, m_thread, &QObject::deleteLater);
-    m_thread->start();
 }
 
 QFreeOpcUaClientImpl::~QFreeOpcUaClientImpl()
 {
-    if (m_thread->isRunning())
-        m_thread->quit();
+    // The worker is deleted in its thread, which may be shared with other clients
+    m_opcuaWorker->deleteLater();
+    QOpcUaBackendThreadPool::instance()->releaseThread(m_thread);
 }
 
 void QFreeOpcUaClientImpl::connectToEndpoint(const QUrl &url)
@@ -95,4 +95,48 @@ QOpcUaNode *QFreeOpcUaClientImpl::node(const QString &nodeId)
     }
 }
 
+bool QFreeOpcUaClientImpl::readNodeAttributes(const QVector<QOpcUaReadItem> &nodesToRead)
+{
+    return QMetaObject::invokeMethod(m_opcuaWorker, "readNodeAttributes", Qt::QueuedConnection,
+                                     Q_ARG(QVector<QOpcUaReadItem>, nodesToRead));
+}
+
+bool QFreeOpcUaClientImpl::writeNodeAttributes(const QVector<QOpcUaWriteItem> &nodesToWrite)
+{
+    return QMetaObject::invokeMethod(m_opcuaWorker, "writeNodeAttributes", Qt::QueuedConnection,
+                                     Q_ARG(QVector<QOpcUaWriteItem>, nodesToWrite));
+}
+
+bool QFreeOpcUaClientImpl::enableMonitoring(const QVector<QOpcUaNodeHandle> &nodes, QOpcUa::NodeAttributes attr,
+                                            const QOpcUaMonitoringParameters &settings)
+{
+    return QMetaObject::invokeMethod(m_opcuaWorker, "enableMonitoringForNodes", Qt::QueuedConnection,
+                                     Q_ARG(QVector<QOpcUaNodeHandle>, nodes),
+                                     Q_ARG(QOpcUa::NodeAttributes, attr),
+                                     Q_ARG(QOpcUaMonitoringParameters, settings));
+}
+
+bool QFreeOpcUaClientImpl::disableMonitoring(const QVector<QOpcUaNodeHandle> &nodes, QOpcUa::NodeAttributes attr)
+{
+    return QMetaObject::invokeMethod(m_opcuaWorker, "disableMonitoringForNodes", Qt::QueuedConnection,
+                                     Q_ARG(QVector<QOpcUaNodeHandle>, nodes),
+                                     Q_ARG(QOpcUa::NodeAttributes, attr));
+}
+
+bool QFreeOpcUaClientImpl::setTypedArraysEnabled(bool enabled)
+{
+    return QMetaObject::invokeMethod(m_opcuaWorker, "setTypedArraysEnabled", Qt::QueuedConnection,
+                                     Q_ARG(bool, enabled));
+}
+
+bool QFreeOpcUaClientImpl::browseRecursive(const QString &rootNodeId, QOpcUa::ReferenceTypeId referenceType,
+                                           QOpcUa::NodeClasses nodeClassMask, int maxDepth)
+{
+    return QMetaObject::invokeMethod(m_opcuaWorker, "browseRecursive", Qt::QueuedConnection,
+                                     Q_ARG(QString, rootNodeId),
+                                     Q_ARG(QOpcUa::ReferenceTypeId, referenceType),
+                                     Q_ARG(QOpcUa::NodeClasses, nodeClassMask),
+                                     Q_ARG(int, maxDepth));
+}
+
 QT_END_NAMESPACE
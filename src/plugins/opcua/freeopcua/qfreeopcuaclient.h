@@ -57,9 +57,19 @@ public:
     void connectToEndpoint(const QUrl &url) override;
     void disconnectFromEndpoint() override;
     QOpcUaNode *node(const QString &nodeId) override;
+    using QOpcUaClientImpl::node;
 
     QString backend() const override { return QStringLiteral("freeopcua"); }
 
+    bool readNodeAttributes(const QVector<QOpcUaReadItem> &nodesToRead) override;
+    bool writeNodeAttributes(const QVector<QOpcUaWriteItem> &nodesToWrite) override;
+    bool enableMonitoring(const QVector<QOpcUaNodeHandle> &nodes, QOpcUa::NodeAttributes attr,
+                          const QOpcUaMonitoringParameters &settings) override;
+    bool disableMonitoring(const QVector<QOpcUaNodeHandle> &nodes, QOpcUa::NodeAttributes attr) override;
+    bool setTypedArraysEnabled(bool enabled) override;
+    bool browseRecursive(const QString &rootNodeId, QOpcUa::ReferenceTypeId referenceType,
+                         QOpcUa::NodeClasses nodeClassMask, int maxDepth) override;
+
     QFreeOpcUaWorker *m_opcuaWorker{};
 
 private:
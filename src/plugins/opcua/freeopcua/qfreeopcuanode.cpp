@@ -66,7 +66,7 @@ bool QFreeOpcUaNode::readAttributes(QOpcUa::NodeAttributes attr, const QString &
 {
     return QMetaObject::invokeMethod(m_client->m_opcuaWorker, "readAttributes",
                                      Qt::QueuedConnection,
-                                     Q_ARG(uintptr_t, reinterpret_cast<uintptr_t>(this)),
+                                     Q_ARG(quint64, handle()),
                                      Q_ARG(OpcUa::NodeId, m_node.GetId()),
                                      Q_ARG(QOpcUa::NodeAttributes, attr),
                                      Q_ARG(QString, indexRange));
@@ -76,7 +76,7 @@ bool QFreeOpcUaNode::enableMonitoring(QOpcUa::NodeAttributes attr, const QOpcUaM
 {
     return QMetaObject::invokeMethod(m_client->m_opcuaWorker, "enableMonitoring",
                                      Qt::QueuedConnection,
-                                     Q_ARG(uintptr_t, reinterpret_cast<uintptr_t>(this)),
+                                     Q_ARG(quint64, handle()),
                                      Q_ARG(OpcUa::Node, m_node),
                                      Q_ARG(QOpcUa::NodeAttributes, attr),
                                      Q_ARG(QOpcUaMonitoringParameters, settings));
@@ -86,7 +86,7 @@ bool QFreeOpcUaNode::disableMonitoring(QOpcUa::NodeAttributes attr)
 {
     return QMetaObject::invokeMethod(m_client->m_opcuaWorker, "disableMonitoring",
                                      Qt::QueuedConnection,
-                                     Q_ARG(uintptr_t, reinterpret_cast<uintptr_t>(this)),
+                                     Q_ARG(quint64, handle()),
                                      Q_ARG(QOpcUa::NodeAttributes, attr));
 }
 
@@ -94,7 +94,7 @@ bool QFreeOpcUaNode::modifyMonitoring(QOpcUa::NodeAttribute attr, QOpcUaMonitori
 {
     return QMetaObject::invokeMethod(m_client->m_opcuaWorker, "modifyMonitoring",
                                      Qt::QueuedConnection,
-                                     Q_ARG(uintptr_t, reinterpret_cast<uintptr_t>(this)),
+                                     Q_ARG(quint64, handle()),
                                      Q_ARG(QOpcUa::NodeAttribute, attr),
                                      Q_ARG(QOpcUaMonitoringParameters::Parameter, item),
                                      Q_ARG(QVariant, value));
@@ -114,7 +114,7 @@ bool QFreeOpcUaNode::browseChildren(QOpcUa::ReferenceTypeId referenceType, QOpcU
 {
     return QMetaObject::invokeMethod(m_client->m_opcuaWorker, "browseChildren",
                                      Qt::QueuedConnection,
-                                     Q_ARG(uintptr_t, reinterpret_cast<uintptr_t>(this)),
+                                     Q_ARG(quint64, handle()),
                                      Q_ARG(OpcUa::NodeId, m_node.GetId()),
                                      Q_ARG(QOpcUa::ReferenceTypeId, referenceType),
                                      Q_ARG(QOpcUa::NodeClasses, nodeClassMask));
@@ -124,7 +124,7 @@ bool QFreeOpcUaNode::writeAttribute(QOpcUa::NodeAttribute attribute, const QVari
 {
     return QMetaObject::invokeMethod(m_client->m_opcuaWorker, "writeAttribute",
                                      Qt::QueuedConnection,
-                                     Q_ARG(uintptr_t, reinterpret_cast<uintptr_t>(this)),
+                                     Q_ARG(quint64, handle()),
                                      Q_ARG(OpcUa::Node, m_node),
                                      Q_ARG(QOpcUa::NodeAttribute, attribute),
                                      Q_ARG(QVariant, value),
@@ -136,7 +136,7 @@ bool QFreeOpcUaNode::writeAttributes(const QOpcUaNode::AttributeMap &toWrite, QO
 {
     return QMetaObject::invokeMethod(m_client->m_opcuaWorker, "writeAttributes",
                                      Qt::QueuedConnection,
-                                     Q_ARG(uintptr_t, reinterpret_cast<uintptr_t>(this)),
+                                     Q_ARG(quint64, handle()),
                                      Q_ARG(OpcUa::Node, m_node),
                                      Q_ARG(QOpcUaNode::AttributeMap, toWrite),
                                      Q_ARG(QOpcUa::Types, valueAttributeType));
@@ -146,7 +146,7 @@ bool QFreeOpcUaNode::callMethod(const QString &methodNodeId, const QVector<QOpcU
 {
     return QMetaObject::invokeMethod(m_client->m_opcuaWorker, "callMethod",
                                      Qt::QueuedConnection,
-                                     Q_ARG(uintptr_t, reinterpret_cast<uintptr_t>(this)),
+                                     Q_ARG(quint64, handle()),
                                      Q_ARG(OpcUa::NodeId, m_node.GetId()),
                                      Q_ARG(OpcUa::NodeId, QFreeOpcUaValueConverter::scalarFromQVariant<OpcUa::NodeId>(methodNodeId)),
                                      Q_ARG(QVector<QOpcUa::TypedVariant>, args));
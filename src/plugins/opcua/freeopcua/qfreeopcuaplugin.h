@@ -46,7 +46,7 @@ class QFreeOpcUaPlugin : public QOpcUaPlugin
 {
     Q_OBJECT
 
-    Q_PLUGIN_METADATA(IID "org.qt-project.qt.opcua.providerfactory/1.0" FILE "freeopcua-metadata.json")
+    Q_PLUGIN_METADATA(IID "org.qt-project.qt.opcua.providerfactory/1.1" FILE "freeopcua-metadata.json")
     Q_INTERFACES(QOpcUaPlugin)
 
 public:
@@ -80,6 +80,7 @@ bool QFreeOpcUaSubscription::removeOnServer()
     bool success = false;
     try {
         if (m_subscription) {
+            m_backend->statistics().subscriptionRemoved(m_subscription->GetId());
             m_subscription->Delete();
             success = true;
         }
@@ -108,7 +109,7 @@ void QFreeOpcUaSubscription::StatusChange(OpcUa::StatusCode status)
     if (status != OpcUa::StatusCode::BadTimeout)
         return;
 
-    QVector<QPair<uintptr_t, QOpcUa::NodeAttribute>> items;
+    QVector<QPair<quint64, QOpcUa::NodeAttribute>> items;
     for (auto it : qAsConst(m_handleToItemMapping)) {
         for (auto item : it) {
             items.push_back({item->handle, item->attr});
@@ -118,7 +119,7 @@ void QFreeOpcUaSubscription::StatusChange(OpcUa::StatusCode status)
     emit timeout(this, items);
 }
 
-void QFreeOpcUaSubscription::modifyMonitoring(uintptr_t handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value)
+void QFreeOpcUaSubscription::modifyMonitoring(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value)
 {
     Q_UNUSED(item);
     Q_UNUSED(value);
@@ -137,7 +138,7 @@ void QFreeOpcUaSubscription::modifyMonitoring(uintptr_t handle, QOpcUa::NodeAttr
     emit m_backend->monitoringEnableDisable(handle, attr, true, s);
 }
 
-bool QFreeOpcUaSubscription::addAttributeMonitoredItem(uintptr_t handle, QOpcUa::NodeAttribute attr, const OpcUa::Node &node, QOpcUaMonitoringParameters settings)
+bool QFreeOpcUaSubscription::addAttributeMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr, const OpcUa::Node &node, QOpcUaMonitoringParameters settings)
 {
     Q_UNUSED(settings); // Setting these options is not yet supported
 
@@ -151,7 +152,11 @@ bool QFreeOpcUaSubscription::addAttributeMonitoredItem(uintptr_t handle, QOpcUa:
             rvid.AttributeId = QFreeOpcUaValueConverter::toUaAttributeId(attr);
             rvid.IndexRange = settings.indexRange().toStdString();
             ids.push_back(rvid);
-            std::vector<uint32_t> monitoredItemIds = m_subscription->SubscribeDataChange(ids);
+            std::vector<uint32_t> monitoredItemIds;
+            {
+                QOpcUaStatisticsCollector::ServiceTimer timer(m_backend->statistics(), QOpcUaClientStatistics::Service::CreateMonitoredItems);
+                monitoredItemIds = m_subscription->SubscribeDataChange(ids);
+            }
             monitoredItemId = monitoredItemIds.size() ? monitoredItemIds[0] : 0;
         }
         else {
@@ -184,7 +189,7 @@ bool QFreeOpcUaSubscription::addAttributeMonitoredItem(uintptr_t handle, QOpcUa:
     return true;
 }
 
-bool QFreeOpcUaSubscription::removeAttributeMonitoredItem(uintptr_t handle, QOpcUa::NodeAttribute attr)
+bool QFreeOpcUaSubscription::removeAttributeMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr)
 {
     QScopedPointer<MonitoredItem> item(getItemForAttribute(handle, attr));
 
@@ -240,7 +245,7 @@ int QFreeOpcUaSubscription::monitoredItemsCount() const
     return m_itemIdToItemMapping.size();
 }
 
-QFreeOpcUaSubscription::MonitoredItem *QFreeOpcUaSubscription::getItemForAttribute(uintptr_t handle, QOpcUa::NodeAttribute attr)
+QFreeOpcUaSubscription::MonitoredItem *QFreeOpcUaSubscription::getItemForAttribute(quint64 handle, QOpcUa::NodeAttribute attr)
 {
     auto nodeEntry = m_handleToItemMapping.find(handle);
 
@@ -273,11 +278,18 @@ void QFreeOpcUaSubscription::DataValueChange(uint32_t handle, const OpcUa::Node
     if (item == m_itemIdToItemMapping.end())
         return;
 
+    // FreeOPC-UA doesn't report the publish responses, only the notifications are counted
+    m_backend->statistics().notificationsReceived(m_subscription ? m_subscription->GetId() : 0, 1);
+
     QOpcUaReadResult res;
     res.attributeId = item.value()->attr;
-    res.sourceTimestamp = QFreeOpcUaValueConverter::scalarUaToQt<QDateTime, OpcUa::DateTime>(val.SourceTimestamp);
-    res.serverTimestamp = QFreeOpcUaValueConverter::scalarUaToQt<QDateTime, OpcUa::DateTime>(val.ServerTimestamp);
-    res.value = QFreeOpcUaValueConverter::toQVariant(val.Value);
+    res.sourceTimestamp = val.SourceTimestamp.Value;
+    res.serverTimestamp = val.ServerTimestamp.Value;
+    res.value = QFreeOpcUaValueConverter::toQVariant(val.Value, m_backend->typedArraysEnabled());
+    res.statusCode = static_cast<QOpcUa::UaStatusCode>(val.Status);
+    if (!m_backend->passesClientSideFilter(item.value()->handle, res))
+        return;
+    m_backend->recordHistory(item.value()->handle, res);
     emit m_backend->attributeUpdated(item.value()->handle, res);
 }
 
@@ -65,10 +65,10 @@ public:
     quint32 createOnServer();
     bool removeOnServer();
 
-    void modifyMonitoring(uintptr_t handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value);
+    void modifyMonitoring(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value);
 
-    bool addAttributeMonitoredItem(uintptr_t handle, QOpcUa::NodeAttribute attr, const OpcUa::Node &node, QOpcUaMonitoringParameters settings);
-    bool removeAttributeMonitoredItem(uintptr_t handle, QOpcUa::NodeAttribute attr);
+    bool addAttributeMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr, const OpcUa::Node &node, QOpcUaMonitoringParameters settings);
+    bool removeAttributeMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr);
 
     double interval() const;
     QOpcUaMonitoringParameters::SubscriptionType shared() const;
@@ -76,10 +76,10 @@ public:
     int monitoredItemsCount() const;
 
     struct MonitoredItem {
-        uintptr_t handle;
+        quint64 handle;
         QOpcUa::NodeAttribute attr;
         quint32 monitoredItemId;
-        MonitoredItem(uintptr_t h, QOpcUa::NodeAttribute a, quint32 id)
+        MonitoredItem(quint64 h, QOpcUa::NodeAttribute a, quint32 id)
             : handle(h)
             , attr(a)
             , monitoredItemId(id)
@@ -91,10 +91,10 @@ public:
     };
 
 signals:
-    void timeout(QFreeOpcUaSubscription *sub, QVector<QPair<uintptr_t, QOpcUa::NodeAttribute>> items);
+    void timeout(QFreeOpcUaSubscription *sub, QVector<QPair<quint64, QOpcUa::NodeAttribute>> items);
 
 private:
-    MonitoredItem *getItemForAttribute(uintptr_t handle, QOpcUa::NodeAttribute attr);
+    MonitoredItem *getItemForAttribute(quint64 handle, QOpcUa::NodeAttribute attr);
 
     double m_interval;
     QOpcUaMonitoringParameters::SubscriptionType m_shared;
@@ -103,7 +103,7 @@ private:
     QFreeOpcUaWorker *m_backend;
 
     QHash<quint32, MonitoredItem *> m_itemIdToItemMapping;
-    QHash<uintptr_t, QHash<QOpcUa::NodeAttribute, MonitoredItem *>> m_handleToItemMapping;
+    QHash<quint64, QHash<QOpcUa::NodeAttribute, MonitoredItem *>> m_handleToItemMapping;
 
     bool m_timeout;
 };
@@ -35,13 +35,16 @@
 ****************************************************************************/
 
 #include "qfreeopcuavalueconverter.h"
+#include <private/qopcuabackend_p.h>
 
 #include <QtCore/qdatetime.h>
 #include <QtCore/qloggingcategory.h>
 #include <QtCore/qmetaobject.h>
 #include <QtCore/qregularexpression.h>
 #include <QtCore/quuid.h>
+#include <QtCore/qvector.h>
 
+#include <cstring>
 #include <vector>
 
 #include <opc/ua/protocol/string_utils.h>
@@ -52,13 +55,42 @@ Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_FREEOPCUA)
 
 namespace QFreeOpcUaValueConverter {
 
-QVariant toQVariant(const OpcUa::Variant &variant)
+QVariant toQVariant(const OpcUa::Variant &variant, bool typedArrays)
 {
+    QOpcUaStatisticsCollector::ConversionTimer conversionTimer;
+
     // Null variant, return empty QVariant
     if (!variant.IsScalar() && !variant.IsArray()) {
         return QVariant();
     }
 
+    if (typedArrays && variant.IsArray()) {
+        switch (variant.Type()) {
+        case OpcUa::VariantType::SBYTE:
+            return typedArrayToQVariant<qint8, int8_t>(variant);
+        case OpcUa::VariantType::BYTE:
+            return typedArrayToQVariant<quint8, uint8_t>(variant);
+        case OpcUa::VariantType::INT16:
+            return typedArrayToQVariant<qint16, int16_t>(variant);
+        case OpcUa::VariantType::UINT16:
+            return typedArrayToQVariant<quint16, uint16_t>(variant);
+        case OpcUa::VariantType::INT32:
+            return typedArrayToQVariant<qint32, int32_t>(variant);
+        case OpcUa::VariantType::UINT32:
+            return typedArrayToQVariant<quint32, uint32_t>(variant);
+        case OpcUa::VariantType::INT64:
+            return typedArrayToQVariant<qint64, int64_t>(variant);
+        case OpcUa::VariantType::UINT64:
+            return typedArrayToQVariant<quint64, uint64_t>(variant);
+        case OpcUa::VariantType::FLOAT:
+            return typedArrayToQVariant<float, float>(variant);
+        case OpcUa::VariantType::DOUBLE:
+            return typedArrayToQVariant<double, double>(variant);
+        default:
+            break;
+        }
+    }
+
     switch (variant.Type()) {
     case OpcUa::VariantType::NUL:
         return QVariant::fromValue(static_cast<QObject *>(nullptr));
@@ -132,6 +164,40 @@ QVariant toQVariant(const OpcUa::Variant &variant)
 
 OpcUa::Variant toTypedVariant(const QVariant &variant, QOpcUa::Types type)
 {
+    QOpcUaStatisticsCollector::ConversionTimer conversionTimer;
+
+    const QOpcUa::Types typedArrayType = QOpcUaBackend::typedArrayElementType(variant.userType());
+    if (typedArrayType != QOpcUa::Undefined) {
+        // A typed array of a different type is converted element by element
+        if (type != QOpcUa::Undefined && type != typedArrayType)
+            return toTypedVariant(variant.toList(), type);
+
+        switch (typedArrayType) {
+        case QOpcUa::SByte:
+            return typedArrayFromQVariant<int8_t, qint8>(variant);
+        case QOpcUa::Byte:
+            return typedArrayFromQVariant<uint8_t, quint8>(variant);
+        case QOpcUa::Int16:
+            return typedArrayFromQVariant<int16_t, qint16>(variant);
+        case QOpcUa::UInt16:
+            return typedArrayFromQVariant<uint16_t, quint16>(variant);
+        case QOpcUa::Int32:
+            return typedArrayFromQVariant<int32_t, qint32>(variant);
+        case QOpcUa::UInt32:
+            return typedArrayFromQVariant<uint32_t, quint32>(variant);
+        case QOpcUa::Int64:
+            return typedArrayFromQVariant<int64_t, qint64>(variant);
+        case QOpcUa::UInt64:
+            return typedArrayFromQVariant<uint64_t, quint64>(variant);
+        case QOpcUa::Float:
+            return typedArrayFromQVariant<float, float>(variant);
+        case QOpcUa::Double:
+            return typedArrayFromQVariant<double, double>(variant);
+        default:
+            break;
+        }
+    }
+
     switch (type) {
     case QOpcUa::Boolean:
         return arrayFromQVariant<bool>(variant);
@@ -223,6 +289,8 @@ QString nodeIdToString(const OpcUa::NodeId &id)
 
 OpcUa::Variant toVariant(const QVariant &variant)
 {
+    QOpcUaStatisticsCollector::ConversionTimer conversionTimer;
+
     switch (variant.type()) {
     case QMetaType::Bool:
         return arrayFromQVariant<bool>(variant);
@@ -253,6 +321,18 @@ OpcUa::Variant arrayFromQVariant(const QVariant &var)
     return OpcUa::Variant(scalarFromQVariant<UATYPE, QTTYPE>(var));
 }
 
+template<typename UATYPE, typename QTTYPE>
+OpcUa::Variant typedArrayFromQVariant(const QVariant &var)
+{
+    Q_STATIC_ASSERT(sizeof(UATYPE) == sizeof(QTTYPE));
+
+    const QVector<QTTYPE> vec = var.value<QVector<QTTYPE>>();
+    std::vector<UATYPE> temp(vec.size());
+    if (!vec.isEmpty())
+        std::memcpy(temp.data(), vec.constData(), vec.size() * sizeof(UATYPE));
+    return OpcUa::Variant(temp);
+}
+
 template<typename UATYPE, typename QTTYPE>
 UATYPE scalarFromQVariant(const QVariant &var)
 {
@@ -351,6 +431,18 @@ QVariant arrayToQVariant(const OpcUa::Variant &var, QMetaType::Type type)
     return QVariant();
 }
 
+template<typename QTTYPE, typename UATYPE>
+QVariant typedArrayToQVariant(const OpcUa::Variant &var)
+{
+    Q_STATIC_ASSERT(sizeof(QTTYPE) == sizeof(UATYPE));
+
+    const std::vector<UATYPE> temp = var.As<std::vector<UATYPE>>();
+    QVector<QTTYPE> result(static_cast<int>(temp.size()));
+    if (!temp.empty())
+        std::memcpy(result.data(), temp.data(), temp.size() * sizeof(UATYPE));
+    return QVariant::fromValue(result);
+}
+
 template<typename QTTYPE, typename UATYPE>
 QTTYPE scalarUaToQt(const UATYPE &data)
 {
@@ -53,7 +53,7 @@ QT_BEGIN_NAMESPACE
 namespace QFreeOpcUaValueConverter
 {
     OpcUa::Variant toVariant(const QVariant &variant);
-    QVariant toQVariant(const OpcUa::Variant &variant);
+    QVariant toQVariant(const OpcUa::Variant &variant, bool typedArrays = false);
     OpcUa::Variant toTypedVariant(const QVariant &variant, QOpcUa::Types type);
     QString nodeIdToString(const OpcUa::NodeId &id);
     OpcUa::NodeId stringToNodeId(const QString &id);
@@ -63,6 +63,9 @@ namespace QFreeOpcUaValueConverter
     template <typename UATYPE, typename QTTYPE=UATYPE>
     OpcUa::Variant arrayFromQVariant(const QVariant &var);
 
+    template <typename UATYPE, typename QTTYPE=UATYPE>
+    OpcUa::Variant typedArrayFromQVariant(const QVariant &var);
+
     inline OpcUa::AttributeId toUaAttributeId(QOpcUa::NodeAttribute attr)
     {
         const int attributeIdUsedBits = 22;
@@ -81,6 +84,9 @@ namespace QFreeOpcUaValueConverter
 
     template<typename QTTYPE, typename UATYPE>
     QVariant arrayToQVariant(const OpcUa::Variant &var, QMetaType::Type type = QMetaType::UnknownType);
+
+    template<typename QTTYPE, typename UATYPE>
+    QVariant typedArrayToQVariant(const OpcUa::Variant &var);
 }
 
 QT_END_NAMESPACE
@@ -42,6 +42,7 @@
 
 #include <QtNetwork/qhostinfo.h>
 #include <QtCore/qloggingcategory.h>
+#include <QtCore/qset.h>
 
 #include <opc/ua/node.h>
 
@@ -53,6 +54,9 @@ QFreeOpcUaWorker::QFreeOpcUaWorker(QFreeOpcUaClientImpl *client)
     : QOpcUaBackend()
     , m_client(client)
     , m_minPublishingInterval(0)
+    , m_maxNodesPerRead(defaultMaxOperationsPerRequest())
+    , m_maxNodesPerWrite(defaultMaxOperationsPerRequest())
+    , m_maxNodesPerBrowse(defaultMaxOperationsPerRequest())
 {}
 
 QFreeOpcUaWorker::~QFreeOpcUaWorker()
@@ -110,7 +114,18 @@ void QFreeOpcUaWorker::asyncDisconnectFromEndpoint()
     emit stateAndOrErrorChanged(QOpcUaClient::Disconnected, QOpcUaClient::UnknownError);
 }
 
-void QFreeOpcUaWorker::browseChildren(uintptr_t handle, OpcUa::NodeId id, QOpcUa::ReferenceTypeId referenceType, QOpcUa::NodeClasses nodeClassMask)
+static QOpcUaReferenceDescription convertReferenceDescription(const OpcUa::ReferenceDescription &src)
+{
+    QOpcUaReferenceDescription temp;
+    temp.setNodeId(QFreeOpcUaValueConverter::nodeIdToString(src.TargetNodeId));
+    temp.setRefType(static_cast<QOpcUa::ReferenceTypeId>(src.ReferenceTypeId.GetIntegerIdentifier()));
+    temp.setNodeClass(static_cast<QOpcUa::NodeClass>(src.TargetNodeClass));
+    temp.setBrowseName(QFreeOpcUaValueConverter::scalarUaToQt<QOpcUa::QQualifiedName>(src.BrowseName));
+    temp.setDisplayName(QFreeOpcUaValueConverter::scalarUaToQt<QOpcUa::QLocalizedText>(src.DisplayName));
+    return temp;
+}
+
+void QFreeOpcUaWorker::browseChildren(quint64 handle, OpcUa::NodeId id, QOpcUa::ReferenceTypeId referenceType, QOpcUa::NodeClasses nodeClassMask)
 {
     OpcUa::BrowseDescription description;
     description.NodeToBrowse = id;
@@ -129,7 +144,11 @@ void QFreeOpcUaWorker::browseChildren(uintptr_t handle, OpcUa::NodeId id, QOpcUa
     QVector<QOpcUaReferenceDescription> ret;
 
     try {
-        std::vector<OpcUa::BrowseResult> results = Server->Views()->Browse(query);
+        std::vector<OpcUa::BrowseResult> results;
+        {
+            QOpcUaStatisticsCollector::ServiceTimer timer(statistics(), QOpcUaClientStatistics::Service::Browse);
+            results = Server->Views()->Browse(query);
+        }
 
         while (!results.empty()) {
             if (results[0].Status != OpcUa::StatusCode::Good) {
@@ -137,15 +156,8 @@ void QFreeOpcUaWorker::browseChildren(uintptr_t handle, OpcUa::NodeId id, QOpcUa
                 break;
             }
 
-            for (std::vector<OpcUa::ReferenceDescription>::const_iterator it  = results[0].Referencies.begin(); it != results[0].Referencies.end(); ++it) {
-                QOpcUaReferenceDescription temp;
-                temp.setNodeId(QFreeOpcUaValueConverter::nodeIdToString(it->TargetNodeId));
-                temp.setRefType(static_cast<QOpcUa::ReferenceTypeId>(it->ReferenceTypeId.GetIntegerIdentifier()));
-                temp.setNodeClass(static_cast<QOpcUa::NodeClass>(it->TargetNodeClass));
-                temp.setBrowseName(QFreeOpcUaValueConverter::scalarUaToQt<QOpcUa::QQualifiedName>(it->BrowseName));
-                temp.setDisplayName(QFreeOpcUaValueConverter::scalarUaToQt<QOpcUa::QLocalizedText>(it->DisplayName));
-                ret.push_back(temp);
-            }
+            for (std::vector<OpcUa::ReferenceDescription>::const_iterator it  = results[0].Referencies.begin(); it != results[0].Referencies.end(); ++it)
+                ret.push_back(convertReferenceDescription(*it));
 
             results = Server->Views()->BrowseNext();
         }
@@ -157,7 +169,112 @@ void QFreeOpcUaWorker::browseChildren(uintptr_t handle, OpcUa::NodeId id, QOpcUa
     emit browseFinished(handle, ret, statusCode);
 }
 
-void QFreeOpcUaWorker::readAttributes(uintptr_t handle, OpcUa::NodeId id, QOpcUa::NodeAttributes attr, QString indexRange)
+void QFreeOpcUaWorker::browseRecursive(QString rootNodeId, QOpcUa::ReferenceTypeId referenceType, QOpcUa::NodeClasses nodeClassMask, int maxDepth)
+{
+    QOpcUa::UaStatusCode statusCode = QOpcUa::UaStatusCode::Good;
+
+    QSet<QString> visited;
+    visited.insert(rootNodeId);
+    QVector<QString> currentLevel;
+    currentLevel.push_back(rootNodeId);
+
+    // The address space is browsed level by level, each Browse request contains as many nodes as the server accepts
+    for (int depth = 0; !currentLevel.isEmpty(); ++depth) {
+        const bool browseChildren = maxDepth < 0 || depth + 1 < maxDepth;
+        QVector<QString> nextLevel;
+
+        for (int offset = 0; offset < currentLevel.size();) {
+            const int chunkSize = qMin(m_maxNodesPerBrowse, currentLevel.size() - offset);
+
+            OpcUa::NodesQuery query;
+            query.MaxReferenciesPerNode = 0; // Let the server choose a maximum value
+            for (int i = offset; i < offset + chunkSize; ++i) {
+                OpcUa::BrowseDescription description;
+                description.NodeToBrowse = QFreeOpcUaValueConverter::stringToNodeId(currentLevel.at(i));
+                description.Direction = OpcUa::BrowseDirection::Forward;
+                description.IncludeSubtypes = true;
+                description.NodeClasses = static_cast<OpcUa::NodeClass>(static_cast<quint32>(nodeClassMask));
+                description.ResultMask = OpcUa::BrowseResultMask::BrowseName | OpcUa::BrowseResultMask::DisplayName |
+                        OpcUa::BrowseResultMask::ReferenceTypeId | OpcUa::BrowseResultMask::NodeClass;
+                description.ReferenceTypeId = static_cast<OpcUa::ReferenceId>(referenceType);
+                query.NodesToBrowse.push_back(description);
+            }
+
+            try {
+                std::vector<OpcUa::BrowseResult> results;
+                {
+                    QOpcUaStatisticsCollector::ServiceTimer timer(statistics(), QOpcUaClientStatistics::Service::Browse);
+                    results = Server->Views()->Browse(query);
+                }
+
+                // Index into currentLevel of the node each result belongs to
+                QVector<int> parents;
+                for (int i = 0; i < chunkSize; ++i)
+                    parents.push_back(offset + i);
+
+                while (!results.empty()) {
+                    QVector<QOpcUaReferenceDescription> references;
+                    QVector<int> continuedParents;
+
+                    for (size_t i = 0; i < results.size() && i < static_cast<size_t>(parents.size()); ++i) {
+                        const OpcUa::BrowseResult &result = results[i];
+                        const QString &parentNodeId = currentLevel.at(parents.at(static_cast<int>(i)));
+
+                        if (result.Status != OpcUa::StatusCode::Good) {
+                            if (statusCode == QOpcUa::UaStatusCode::Good)
+                                statusCode = static_cast<QOpcUa::UaStatusCode>(result.Status);
+                            continue;
+                        }
+
+                        for (const OpcUa::ReferenceDescription &ref : result.Referencies) {
+                            QOpcUaReferenceDescription temp = convertReferenceDescription(ref);
+                            temp.setParentNodeId(parentNodeId);
+                            references.push_back(temp);
+
+                            // Nodes on other servers can't be browsed with this connection
+                            if (!browseChildren || ref.TargetNodeId.HasServerIndex() || ref.TargetNodeId.HasNamespaceURI())
+                                continue;
+                            if (!visited.contains(temp.nodeId())) {
+                                visited.insert(temp.nodeId());
+                                nextLevel.push_back(temp.nodeId());
+                            }
+                        }
+
+                        // BrowseNext() returns results for all continuation points of the previous call in order
+                        if (!result.ContinuationPoint.empty())
+                            continuedParents.push_back(parents.at(static_cast<int>(i)));
+                    }
+
+                    if (!references.isEmpty())
+                        emit browseRecursiveResultsAvailable(rootNodeId, references);
+
+                    if (continuedParents.isEmpty())
+                        break;
+
+                    parents = continuedParents;
+                    results = Server->Views()->BrowseNext();
+                }
+            } catch (const std::exception &ex) {
+                const QOpcUa::UaStatusCode chunkStatus = QFreeOpcUaValueConverter::exceptionToStatusCode(ex);
+                if (chunkStatus == QOpcUa::UaStatusCode::BadTooManyOperations && chunkSize > 1) {
+                    m_maxNodesPerBrowse = chunkSize / 2;
+                    continue;
+                }
+                qCWarning(QT_OPCUA_PLUGINS_FREEOPCUA) << "Recursive browse error:" << ex.what();
+                if (statusCode == QOpcUa::UaStatusCode::Good)
+                    statusCode = chunkStatus;
+            }
+
+            offset += chunkSize;
+        }
+
+        currentLevel = nextLevel;
+    }
+
+    emit browseRecursiveFinished(rootNodeId, statusCode);
+}
+
+void QFreeOpcUaWorker::readAttributes(quint64 handle, OpcUa::NodeId id, QOpcUa::NodeAttributes attr, QString indexRange)
 {
     QVector<QOpcUaReadResult> vec;
 
@@ -176,15 +293,20 @@ void QFreeOpcUaWorker::readAttributes(uintptr_t handle, OpcUa::NodeId id, QOpcUa
             vec.push_back(temp);
         });
 
-        std::vector<OpcUa::DataValue> res = GetRootNode().GetServices()->Attributes()->Read(params);
+        std::vector<OpcUa::DataValue> res;
+        {
+            QOpcUaStatisticsCollector::ServiceTimer timer(statistics(), QOpcUaClientStatistics::Service::Read);
+            res = GetRootNode().GetServices()->Attributes()->Read(params);
+        }
 
         for (size_t i = 0; i < res.size(); ++i) {
             vec[i].statusCode = static_cast<QOpcUa::UaStatusCode>(res[i].Status);
             if (res[i].Status == OpcUa::StatusCode::Good) {
-                vec[i].value = QFreeOpcUaValueConverter::toQVariant(res[i].Value);
+                vec[i].value = QFreeOpcUaValueConverter::toQVariant(res[i].Value, typedArraysEnabled());
             }
-            vec[i].sourceTimestamp = QFreeOpcUaValueConverter::scalarUaToQt<QDateTime, OpcUa::DateTime>(res[i].SourceTimestamp);
-            vec[i].serverTimestamp = QFreeOpcUaValueConverter::scalarUaToQt<QDateTime, OpcUa::DateTime>(res[i].ServerTimestamp);
+            // OpcUa::DateTime holds the 100 ns intervals since 1601-01-01 UTC
+            vec[i].sourceTimestamp = res[i].SourceTimestamp.Value;
+            vec[i].serverTimestamp = res[i].ServerTimestamp.Value;
         }
 
         emit attributesRead(handle, vec, QOpcUa::UaStatusCode::Good);
@@ -194,7 +316,79 @@ void QFreeOpcUaWorker::readAttributes(uintptr_t handle, OpcUa::NodeId id, QOpcUa
     }
 }
 
-void QFreeOpcUaWorker::writeAttribute(uintptr_t handle, OpcUa::Node node, QOpcUa::NodeAttribute attr, QVariant value, QOpcUa::Types type, QString indexRange)
+void QFreeOpcUaWorker::readNodeAttributes(QVector<QOpcUaReadItem> nodesToRead)
+{
+    std::vector<OpcUa::ReadValueId> valueIds;
+    QVector<QOpcUaReadItemResult> results;
+
+    for (const QOpcUaReadItem &item : qAsConst(nodesToRead)) {
+        const OpcUa::NodeId id = QFreeOpcUaValueConverter::stringToNodeId(item.nodeId());
+        const std::string indexRange = item.indexRange().toStdString();
+
+        qt_forEachAttribute(item.attributes(), [&](QOpcUa::NodeAttribute attribute) {
+            OpcUa::ReadValueId readId;
+            readId.NodeId = id;
+            readId.AttributeId = QFreeOpcUaValueConverter::toUaAttributeId(attribute);
+            readId.IndexRange = indexRange;
+            valueIds.push_back(readId);
+
+            QOpcUaReadItemResult temp;
+            temp.setNodeId(item.nodeId());
+            temp.setAttribute(attribute);
+            temp.setIndexRange(item.indexRange());
+            results.push_back(temp);
+        });
+    }
+
+    QOpcUa::UaStatusCode serviceResult = QOpcUa::UaStatusCode::Good;
+
+    // Split the request if it exceeds the number of operations accepted by the server
+    for (size_t offset = 0; offset < valueIds.size();) {
+        const size_t chunkSize = qMin(static_cast<size_t>(m_maxNodesPerRead), valueIds.size() - offset);
+
+        try {
+            OpcUa::ReadParameters params;
+            params.TimestampsToReturn = OpcUa::TimestampsToReturn::Both;
+            params.AttributesToRead.assign(valueIds.begin() + offset, valueIds.begin() + offset + chunkSize);
+
+            std::vector<OpcUa::DataValue> res;
+            {
+                QOpcUaStatisticsCollector::ServiceTimer timer(statistics(), QOpcUaClientStatistics::Service::Read);
+                res = GetRootNode().GetServices()->Attributes()->Read(params);
+            }
+
+            for (size_t i = 0; i < chunkSize; ++i) {
+                QOpcUaReadItemResult &result = results[static_cast<int>(offset + i)];
+                if (i >= res.size()) {
+                    result.setStatusCode(QOpcUa::UaStatusCode::BadUnexpectedError);
+                    continue;
+                }
+                result.setStatusCode(static_cast<QOpcUa::UaStatusCode>(res[i].Status));
+                if (res[i].Status == OpcUa::StatusCode::Good)
+                    result.setValue(QFreeOpcUaValueConverter::toQVariant(res[i].Value, typedArraysEnabled()));
+                result.setRawSourceTimestamp(res[i].SourceTimestamp.Value);
+                result.setRawServerTimestamp(res[i].ServerTimestamp.Value);
+            }
+        } catch (const std::exception &ex) {
+            const QOpcUa::UaStatusCode statusCode = QFreeOpcUaValueConverter::exceptionToStatusCode(ex);
+            if (statusCode == QOpcUa::UaStatusCode::BadTooManyOperations && chunkSize > 1) {
+                m_maxNodesPerRead = static_cast<int>(chunkSize / 2);
+                continue;
+            }
+            qCWarning(QT_OPCUA_PLUGINS_FREEOPCUA) << "Reading node attributes failed:" << ex.what();
+            for (size_t i = 0; i < chunkSize; ++i)
+                results[static_cast<int>(offset + i)].setStatusCode(statusCode);
+            if (serviceResult == QOpcUa::UaStatusCode::Good)
+                serviceResult = statusCode;
+        }
+
+        offset += chunkSize;
+    }
+
+    emit readNodeAttributesFinished(results, serviceResult);
+}
+
+void QFreeOpcUaWorker::writeAttribute(quint64 handle, OpcUa::Node node, QOpcUa::NodeAttribute attr, QVariant value, QOpcUa::Types type, QString indexRange)
 {
     std::vector<OpcUa::StatusCode> res;
 
@@ -211,7 +405,10 @@ void QFreeOpcUaWorker::writeAttribute(uintptr_t handle, OpcUa::Node node, QOpcUa
         std::vector<OpcUa::WriteValue> req;
         req.push_back(val);
 
-        res = node.GetServices()->Attributes()->Write(req);
+        {
+            QOpcUaStatisticsCollector::ServiceTimer timer(statistics(), QOpcUaClientStatistics::Service::Write);
+            res = node.GetServices()->Attributes()->Write(req);
+        }
 
         emit attributeWritten(handle, attr, res[0] == OpcUa::StatusCode::Good ? value : QVariant(), static_cast<QOpcUa::UaStatusCode>(res[0]));
     } catch (const std::exception &ex) {
@@ -220,7 +417,7 @@ void QFreeOpcUaWorker::writeAttribute(uintptr_t handle, OpcUa::Node node, QOpcUa
     }
 }
 
-void QFreeOpcUaWorker::writeAttributes(uintptr_t handle, OpcUa::Node node, QOpcUaNode::AttributeMap toWrite, QOpcUa::Types valueAttributeType)
+void QFreeOpcUaWorker::writeAttributes(quint64 handle, OpcUa::Node node, QOpcUaNode::AttributeMap toWrite, QOpcUa::Types valueAttributeType)
 {
     if (toWrite.size() == 0) {
         qCWarning(QT_OPCUA_PLUGINS_FREEOPCUA) << "No values to be written";
@@ -242,7 +439,10 @@ void QFreeOpcUaWorker::writeAttributes(uintptr_t handle, OpcUa::Node node, QOpcU
             req.push_back(val);
         }
 
-        res = node.GetServices()->Attributes()->Write(req);
+        {
+            QOpcUaStatisticsCollector::ServiceTimer timer(statistics(), QOpcUaClientStatistics::Service::Write);
+            res = node.GetServices()->Attributes()->Write(req);
+        }
 
         size_t index = 0;
         for (auto it = toWrite.constBegin(); it != toWrite.constEnd(); ++it, ++index) {
@@ -257,6 +457,68 @@ void QFreeOpcUaWorker::writeAttributes(uintptr_t handle, OpcUa::Node node, QOpcU
     }
 }
 
+void QFreeOpcUaWorker::writeNodeAttributes(QVector<QOpcUaWriteItem> nodesToWrite)
+{
+    std::vector<OpcUa::WriteValue> writeValues;
+    QVector<QOpcUaWriteItemResult> results;
+    results.reserve(nodesToWrite.size());
+
+    for (const QOpcUaWriteItem &item : qAsConst(nodesToWrite)) {
+        QOpcUa::Types type = item.type();
+        if (type == QOpcUa::Types::Undefined && item.attribute() != QOpcUa::NodeAttribute::Value)
+            type = attributeIdToTypeId(item.attribute());
+
+        OpcUa::WriteValue val;
+        val.NodeId = QFreeOpcUaValueConverter::stringToNodeId(item.nodeId());
+        val.AttributeId = QFreeOpcUaValueConverter::toUaAttributeId(item.attribute());
+        val.IndexRange = item.indexRange().toStdString();
+        val.Value = OpcUa::DataValue(QFreeOpcUaValueConverter::toTypedVariant(item.value(), type));
+        writeValues.push_back(val);
+
+        QOpcUaWriteItemResult temp;
+        temp.setNodeId(item.nodeId());
+        temp.setAttribute(item.attribute());
+        temp.setIndexRange(item.indexRange());
+        results.push_back(temp);
+    }
+
+    QOpcUa::UaStatusCode serviceResult = QOpcUa::UaStatusCode::Good;
+
+    // Split the request if it exceeds the number of operations accepted by the server
+    for (size_t offset = 0; offset < writeValues.size();) {
+        const size_t chunkSize = qMin(static_cast<size_t>(m_maxNodesPerWrite), writeValues.size() - offset);
+
+        try {
+            const std::vector<OpcUa::WriteValue> req(writeValues.begin() + offset, writeValues.begin() + offset + chunkSize);
+            std::vector<OpcUa::StatusCode> res;
+            {
+                QOpcUaStatisticsCollector::ServiceTimer timer(statistics(), QOpcUaClientStatistics::Service::Write);
+                res = GetRootNode().GetServices()->Attributes()->Write(req);
+            }
+
+            for (size_t i = 0; i < chunkSize; ++i) {
+                results[static_cast<int>(offset + i)].setStatusCode(i < res.size() ? static_cast<QOpcUa::UaStatusCode>(res[i])
+                                                                                 : QOpcUa::UaStatusCode::BadUnexpectedError);
+            }
+        } catch (const std::exception &ex) {
+            const QOpcUa::UaStatusCode statusCode = QFreeOpcUaValueConverter::exceptionToStatusCode(ex);
+            if (statusCode == QOpcUa::UaStatusCode::BadTooManyOperations && chunkSize > 1) {
+                m_maxNodesPerWrite = static_cast<int>(chunkSize / 2);
+                continue;
+            }
+            qCWarning(QT_OPCUA_PLUGINS_FREEOPCUA) << "Writing node attributes failed:" << ex.what();
+            for (size_t i = 0; i < chunkSize; ++i)
+                results[static_cast<int>(offset + i)].setStatusCode(statusCode);
+            if (serviceResult == QOpcUa::UaStatusCode::Good)
+                serviceResult = statusCode;
+        }
+
+        offset += chunkSize;
+    }
+
+    emit writeNodeAttributesFinished(nodesToWrite, results, serviceResult);
+}
+
 QFreeOpcUaSubscription *QFreeOpcUaWorker::getSubscription(const QOpcUaMonitoringParameters &settings)
 {
     if (settings.shared() == QOpcUaMonitoringParameters::SubscriptionType::Shared) {
@@ -292,7 +554,7 @@ bool QFreeOpcUaWorker::removeSubscription(quint32 subscriptionId)
     return false;
 }
 
-void QFreeOpcUaWorker::enableMonitoring(uintptr_t handle, OpcUa::Node node, QOpcUa::NodeAttributes attr, const QOpcUaMonitoringParameters &settings)
+void QFreeOpcUaWorker::enableMonitoring(quint64 handle, OpcUa::Node node, QOpcUa::NodeAttributes attr, const QOpcUaMonitoringParameters &settings)
 {
     QFreeOpcUaSubscription *usedSubscription = nullptr;
 
@@ -339,7 +601,7 @@ void QFreeOpcUaWorker::enableMonitoring(uintptr_t handle, OpcUa::Node node, QOpc
         removeSubscription(usedSubscription->subscriptionId()); // No items were added
 }
 
-void QFreeOpcUaWorker::disableMonitoring(uintptr_t handle, QOpcUa::NodeAttributes attr)
+void QFreeOpcUaWorker::disableMonitoring(quint64 handle, QOpcUa::NodeAttributes attr)
 {
     qt_forEachAttribute(attr, [&](QOpcUa::NodeAttribute attr) {
         QFreeOpcUaSubscription *sub = getSubscriptionForItem(handle, attr);
@@ -352,7 +614,34 @@ void QFreeOpcUaWorker::disableMonitoring(uintptr_t handle, QOpcUa::NodeAttribute
     });
 }
 
-void QFreeOpcUaWorker::modifyMonitoring(uintptr_t handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value)
+void QFreeOpcUaWorker::enableMonitoringForNodes(QVector<QOpcUaNodeHandle> nodes, QOpcUa::NodeAttributes attr, QOpcUaMonitoringParameters settings)
+{
+    // FreeOPC-UA aborts a CreateMonitoredItems call with multiple items on the first bad result
+    // and loses the status of the other items, so the items are created node by node.
+    for (const QOpcUaNodeHandle &node : qAsConst(nodes)) {
+        OpcUa::Node uaNode;
+        try {
+            uaNode = GetNode(QFreeOpcUaValueConverter::stringToNodeId(node.nodeId));
+        } catch (const std::exception &ex) {
+            qCWarning(QT_OPCUA_PLUGINS_FREEOPCUA) << "Could not get node:" << node.nodeId << ex.what();
+            QOpcUaMonitoringParameters s;
+            s.setStatusCode(QFreeOpcUaValueConverter::exceptionToStatusCode(ex));
+            qt_forEachAttribute(attr, [&](QOpcUa::NodeAttribute attribute) {
+                emit monitoringEnableDisable(node.handle, attribute, true, s);
+            });
+            continue;
+        }
+        enableMonitoring(node.handle, uaNode, attr, settings);
+    }
+}
+
+void QFreeOpcUaWorker::disableMonitoringForNodes(QVector<QOpcUaNodeHandle> nodes, QOpcUa::NodeAttributes attr)
+{
+    for (const QOpcUaNodeHandle &node : qAsConst(nodes))
+        disableMonitoring(node.handle, attr);
+}
+
+void QFreeOpcUaWorker::modifyMonitoring(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value)
 {
     QFreeOpcUaSubscription *subscription = getSubscriptionForItem(handle, attr);
     if (!subscription) {
@@ -366,7 +655,7 @@ void QFreeOpcUaWorker::modifyMonitoring(uintptr_t handle, QOpcUa::NodeAttribute
     subscription->modifyMonitoring(handle, attr, item, value);
 }
 
-QFreeOpcUaSubscription *QFreeOpcUaWorker::getSubscriptionForItem(uintptr_t handle, QOpcUa::NodeAttribute attr)
+QFreeOpcUaSubscription *QFreeOpcUaWorker::getSubscriptionForItem(quint64 handle, QOpcUa::NodeAttribute attr)
 {
     auto nodeEntry = m_attributeMapping.find(handle);
     if (nodeEntry == m_attributeMapping.end())
@@ -387,7 +676,7 @@ void QFreeOpcUaWorker::cleanupSubscriptions()
     m_minPublishingInterval = 0;
 }
 
-void QFreeOpcUaWorker::callMethod(uintptr_t handle, OpcUa::NodeId objectId, OpcUa::NodeId methodId, QVector<QOpcUa::TypedVariant> args)
+void QFreeOpcUaWorker::callMethod(quint64 handle, OpcUa::NodeId objectId, OpcUa::NodeId methodId, QVector<QOpcUa::TypedVariant> args)
 {
     try {
         std::vector<OpcUa::Variant> arguments;
@@ -404,18 +693,22 @@ void QFreeOpcUaWorker::callMethod(uintptr_t handle, OpcUa::NodeId objectId, OpcU
         myCallVector.push_back(myCallRequest);
 
         OpcUa::Node object = this->GetNode(objectId);
-        std::vector<OpcUa::Variant> returnedValues = object.CallMethod(methodId, arguments);
+        std::vector<OpcUa::Variant> returnedValues;
+        {
+            QOpcUaStatisticsCollector::ServiceTimer timer(statistics(), QOpcUaClientStatistics::Service::Call);
+            returnedValues = object.CallMethod(methodId, arguments);
+        }
 
         QVariant result;
 
         if (returnedValues.size() > 1) {
             QVariantList temp;
             for (auto it = returnedValues.cbegin(); it != returnedValues.cend(); ++it)
-                temp.append(QFreeOpcUaValueConverter::toQVariant(*it));
+                temp.append(QFreeOpcUaValueConverter::toQVariant(*it, typedArraysEnabled()));
 
             result = temp;
         } else if (returnedValues.size() == 1) {
-            result = QFreeOpcUaValueConverter::toQVariant(returnedValues[0]);
+            result = QFreeOpcUaValueConverter::toQVariant(returnedValues[0], typedArraysEnabled());
         }
 
         emit methodCallFinished(handle, QFreeOpcUaValueConverter::nodeIdToString(methodId), result, QOpcUa::UaStatusCode::Good);
@@ -426,7 +719,7 @@ void QFreeOpcUaWorker::callMethod(uintptr_t handle, OpcUa::NodeId objectId, OpcU
     }
 }
 
-void QFreeOpcUaWorker::handleSubscriptionTimeout(QFreeOpcUaSubscription *sub, QVector<QPair<uintptr_t, QOpcUa::NodeAttribute> > items)
+void QFreeOpcUaWorker::handleSubscriptionTimeout(QFreeOpcUaSubscription *sub, QVector<QPair<quint64, QOpcUa::NodeAttribute> > items)
 {
     for (auto it : items) {
         auto item = m_attributeMapping.find(it.first);
@@ -61,30 +61,39 @@ public slots:
     void asyncConnectToEndpoint(const QUrl &url);
     void asyncDisconnectFromEndpoint();
 
-    void readAttributes(uintptr_t handle, OpcUa::NodeId id, QOpcUa::NodeAttributes attr, QString indexRange);
-    void writeAttribute(uintptr_t handle, OpcUa::Node node, QOpcUa::NodeAttribute attr, QVariant value, QOpcUa::Types type, QString indexRange);
-    void writeAttributes(uintptr_t handle, OpcUa::Node node, QOpcUaNode::AttributeMap toWrite, QOpcUa::Types valueAttributeType);
-    void browseChildren(uintptr_t handle, OpcUa::NodeId id, QOpcUa::ReferenceTypeId referenceType, QOpcUa::NodeClasses nodeClassMask);
+    void readAttributes(quint64 handle, OpcUa::NodeId id, QOpcUa::NodeAttributes attr, QString indexRange);
+    void readNodeAttributes(QVector<QOpcUaReadItem> nodesToRead);
+    void writeAttribute(quint64 handle, OpcUa::Node node, QOpcUa::NodeAttribute attr, QVariant value, QOpcUa::Types type, QString indexRange);
+    void writeAttributes(quint64 handle, OpcUa::Node node, QOpcUaNode::AttributeMap toWrite, QOpcUa::Types valueAttributeType);
+    void writeNodeAttributes(QVector<QOpcUaWriteItem> nodesToWrite);
+    void browseChildren(quint64 handle, OpcUa::NodeId id, QOpcUa::ReferenceTypeId referenceType, QOpcUa::NodeClasses nodeClassMask);
+    void browseRecursive(QString rootNodeId, QOpcUa::ReferenceTypeId referenceType, QOpcUa::NodeClasses nodeClassMask, int maxDepth);
 
     QFreeOpcUaSubscription *getSubscription(const QOpcUaMonitoringParameters &settings);
     bool removeSubscription(quint32 subscriptionId);
 
-    void enableMonitoring(uintptr_t handle, OpcUa::Node node, QOpcUa::NodeAttributes attr, const QOpcUaMonitoringParameters &settings);
-    void disableMonitoring(uintptr_t handle, QOpcUa::NodeAttributes attr);
-    void modifyMonitoring(uintptr_t handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value);
-    void callMethod(uintptr_t handle, OpcUa::NodeId objectId, OpcUa::NodeId methodId, QVector<QOpcUa::TypedVariant> args);
+    void enableMonitoring(quint64 handle, OpcUa::Node node, QOpcUa::NodeAttributes attr, const QOpcUaMonitoringParameters &settings);
+    void disableMonitoring(quint64 handle, QOpcUa::NodeAttributes attr);
+    void enableMonitoringForNodes(QVector<QOpcUaNodeHandle> nodes, QOpcUa::NodeAttributes attr, QOpcUaMonitoringParameters settings);
+    void disableMonitoringForNodes(QVector<QOpcUaNodeHandle> nodes, QOpcUa::NodeAttributes attr);
+    void modifyMonitoring(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value);
+    void callMethod(quint64 handle, OpcUa::NodeId objectId, OpcUa::NodeId methodId, QVector<QOpcUa::TypedVariant> args);
 
-    void handleSubscriptionTimeout(QFreeOpcUaSubscription *sub, QVector<QPair<uintptr_t, QOpcUa::NodeAttribute>> items);
+    void handleSubscriptionTimeout(QFreeOpcUaSubscription *sub, QVector<QPair<quint64, QOpcUa::NodeAttribute>> items);
 private:
-    QFreeOpcUaSubscription *getSubscriptionForItem(uintptr_t handle, QOpcUa::NodeAttribute attr);
+    QFreeOpcUaSubscription *getSubscriptionForItem(quint64 handle, QOpcUa::NodeAttribute attr);
     void cleanupSubscriptions();
 
     QFreeOpcUaClientImpl *m_client;
 
     QHash<quint32, QFreeOpcUaSubscription *> m_subscriptions;
-    QHash<uintptr_t, QHash<QOpcUa::NodeAttribute, QFreeOpcUaSubscription *>> m_attributeMapping; // Handle -> Attribute -> Subscription
+    QHash<quint64, QHash<QOpcUa::NodeAttribute, QFreeOpcUaSubscription *>> m_attributeMapping; // Handle -> Attribute -> Subscription
 
     double m_minPublishingInterval;
+
+    int m_maxNodesPerRead;
+    int m_maxNodesPerWrite;
+    int m_maxNodesPerBrowse;
 };
 
 QT_END_NAMESPACE
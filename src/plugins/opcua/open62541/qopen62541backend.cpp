@@ -39,12 +39,15 @@
 #include "qopen62541utils.h"
 #include "qopen62541valueconverter.h"
 #include <private/qopcuaclient_p.h>
+#include <private/qopcuareaditem_p.h>
 
 #include <QtCore/qloggingcategory.h>
 #include <QtCore/qstringlist.h>
 #include <QtCore/qurl.h>
 #include <QtCore/quuid.h>
 
+#include <limits>
+
 QT_BEGIN_NAMESPACE
 
 Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_OPEN62541)
@@ -67,8 +70,14 @@ Open62541AsyncBackend::Open62541AsyncBackend(QOpen62541Client *parent)
     , m_subscriptionTimer(this)
     , m_sendPublishRequests(false)
     , m_minPublishingInterval(0)
+    , m_maxNodesPerRead(defaultMaxOperationsPerRequest())
+    , m_maxNodesPerWrite(defaultMaxOperationsPerRequest())
+    , m_maxMonitoredItemsPerRequest(defaultMaxOperationsPerRequest())
+    , m_maxNodesPerBrowse(defaultMaxOperationsPerRequest())
+    , m_maxPendingRequests(defaultMaxPendingRequests())
 {
     m_subscriptionTimer.setSingleShot(true);
+    m_subscriptionTimer.setTimerType(Qt::PreciseTimer);
     QObject::connect(&m_subscriptionTimer, &QTimer::timeout,
                      this, &Open62541AsyncBackend::sendPublishRequest);
 }
@@ -78,62 +87,220 @@ Open62541AsyncBackend::~Open62541AsyncBackend()
     cleanupSubscriptions();
     if (m_uaclient)
         UA_Client_delete(m_uaclient);
+    m_uaclient = nullptr;
+    abortAsyncRequests(UA_STATUSCODE_BADSHUTDOWN);
 }
 
-void Open62541AsyncBackend::readAttributes(uintptr_t handle, UA_NodeId id, QOpcUa::NodeAttributes attr, QString indexRange)
+// Shared by the chunks of a split read request, the result is emitted when the last chunk has been answered
+struct Open62541AsyncBackend::ReadChunkState
 {
-    UA_ReadRequest req;
-    UA_ReadRequest_init(&req);
+    ReadChunkState()
+        : batchId(0)
+        , pendingChunks(0)
+        , serviceResult(UA_STATUSCODE_GOOD)
+    {}
+
+    ~ReadChunkState()
+    {
+        for (UA_ReadValueId &readId : valueIds)
+            UA_ReadValueId_deleteMembers(&readId);
+    }
+
     QVector<UA_ReadValueId> valueIds;
+    QVector<QOpcUaReadItemResult> results;
+    quint64 batchId; // Non-zero if the request is a part of a batch split across sessions
+    int pendingChunks;
+    UA_StatusCode serviceResult;
+};
 
-    UA_ReadValueId readId;
-    UA_ReadValueId_init(&readId);
-    readId.nodeId = id;
+// Shared by the chunks of a split write request, the result is emitted when the last chunk has been answered
+struct Open62541AsyncBackend::WriteChunkState
+{
+    WriteChunkState()
+        : writeValues(nullptr)
+        , batchId(0)
+        , pendingChunks(0)
+        , serviceResult(UA_STATUSCODE_GOOD)
+    {}
+
+    ~WriteChunkState()
+    {
+        UA_Array_delete(writeValues, nodesToWrite.size(), &UA_TYPES[UA_TYPES_WRITEVALUE]);
+    }
+
+    UA_WriteValue *writeValues;
+    QVector<QOpcUaWriteItem> nodesToWrite;
+    QVector<quint64> handles; // Set for coalesced writes, the results are emitted per node
+    QVector<QOpcUaWriteItemResult> results;
+    quint64 batchId; // Non-zero if the request is a part of a batch split across sessions
+    int pendingChunks;
+    UA_StatusCode serviceResult;
+};
 
+void Open62541AsyncBackend::readAttributes(quint64 handle, UA_NodeId id, QOpcUa::NodeAttributes attr, QString indexRange)
+{
     QVector<QOpcUaReadResult> vec;
 
     qt_forEachAttribute(attr, [&](QOpcUa::NodeAttribute attribute){
-        readId.attributeId = QOpen62541ValueConverter::toUaAttributeId(attribute);
-        if (indexRange.length())
-            readId.indexRange = UA_STRING_ALLOC(indexRange.toUtf8().data());
-        valueIds.push_back(readId);
         QOpcUaReadResult temp;
         temp.attributeId = attribute;
         vec.push_back(temp);
     });
 
-    UA_ReadResponse res;
-    UA_ReadResponse_init(&res);
-    req.nodesToRead = valueIds.data();
-    req.nodesToReadSize = valueIds.size();
+    UA_ReadRequest req;
+    UA_ReadRequest_init(&req);
+    req.nodesToReadSize = vec.size();
+    req.nodesToRead = static_cast<UA_ReadValueId *>(UA_Array_new(req.nodesToReadSize, &UA_TYPES[UA_TYPES_READVALUEID]));
     req.timestampsToReturn = UA_TIMESTAMPSTORETURN_BOTH;
 
-    res = UA_Client_Service_read(m_uaclient, req);
-
+    const QByteArray range = indexRange.toUtf8();
     for (int i = 0; i < vec.size(); ++i) {
-        // Use the service result as status code if there is no specific result for the current value.
-        // This ensures a result for each attribute when UA_Client_Service_read is called for a disconnected client.
-        if (static_cast<size_t>(i) >= res.resultsSize) {
-            vec[i].statusCode = static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult);
-            continue;
+        UA_NodeId_copy(&id, &req.nodesToRead[i].nodeId);
+        req.nodesToRead[i].attributeId = QOpen62541ValueConverter::toUaAttributeId(vec.at(i).attributeId);
+        if (range.size())
+            req.nodesToRead[i].indexRange = UA_STRING_ALLOC(range.constData());
+    }
+    UA_NodeId_deleteMembers(&id);
+
+    sendAsyncRequest(&req, &UA_TYPES[UA_TYPES_READREQUEST], &UA_TYPES[UA_TYPES_READRESPONSE],
+                     [this, handle, vec](void *response) mutable {
+        UA_ReadResponse *res = static_cast<UA_ReadResponse *>(response);
+        const bool lazy = lazyValueDecodingEnabled();
+
+        for (int i = 0; i < vec.size(); ++i) {
+            // Use the service result as status code if there is no specific result for the current value.
+            // This ensures a result for each attribute when the request fails for a disconnected client.
+            if (static_cast<size_t>(i) >= res->resultsSize) {
+                vec[i].statusCode = static_cast<QOpcUa::UaStatusCode>(res->responseHeader.serviceResult);
+                continue;
+            }
+            if (res->results[i].hasStatus)
+                vec[i].statusCode = static_cast<QOpcUa::UaStatusCode>(res->results[i].status);
+            else
+                vec[i].statusCode = QOpcUa::UaStatusCode::Good;
+            if (res->results[i].hasValue && res->results[i].value.data) {
+                if (lazy && vec.at(i).attributeId == QOpcUa::NodeAttribute::Value)
+                    vec[i].encodedValue.reset(new QOpen62541EncodedValue(&res->results[i].value, typedArraysEnabled()));
+                else
+                    vec[i].value = QOpen62541ValueConverter::toQVariant(res->results[i].value, typedArraysEnabled());
+            }
+            // UA_DateTime has the same representation as the raw timestamps of the result
+            if (res->results[i].hasSourceTimestamp)
+                vec[i].sourceTimestamp = res->results[i].sourceTimestamp;
+            if (res->results[i].hasServerTimestamp)
+                vec[i].serverTimestamp = res->results[i].serverTimestamp;
         }
-        if (res.results[i].hasStatus)
-            vec[i].statusCode = static_cast<QOpcUa::UaStatusCode>(res.results[i].status);
-        else
-            vec[i].statusCode = QOpcUa::UaStatusCode::Good;
-        if (res.results[i].hasValue && res.results[i].value.data)
-                vec[i].value = QOpen62541ValueConverter::toQVariant(res.results[i].value);
-        if (res.results[i].hasServerTimestamp)
-            vec[i].sourceTimestamp = QOpen62541ValueConverter::uaDateTimeToQDateTime(res.results[i].sourceTimestamp);
-        if (res.results[i].hasSourceTimestamp)
-            vec[i].serverTimestamp = QOpen62541ValueConverter::uaDateTimeToQDateTime(res.results[i].serverTimestamp);
+        emit attributesRead(handle, vec, static_cast<QOpcUa::UaStatusCode>(res->responseHeader.serviceResult));
+    });
+}
+
+void Open62541AsyncBackend::readNodeAttributes(QVector<QOpcUaReadItem> nodesToRead)
+{
+    readNodeAttributesPart(0, nodesToRead);
+}
+
+void Open62541AsyncBackend::readNodeAttributesPart(quint64 batchId, QVector<QOpcUaReadItem> nodesToRead)
+{
+    QSharedPointer<ReadChunkState> state(new ReadChunkState);
+    state->batchId = batchId;
+
+    for (const QOpcUaReadItem &item : qAsConst(nodesToRead)) {
+        UA_NodeId id = requestNodeId(item.nodeId());
+        const QByteArray indexRange = item.indexRange().toUtf8();
+
+        qt_forEachAttribute(item.attributes(), [&](QOpcUa::NodeAttribute attribute) {
+            UA_ReadValueId readId;
+            UA_ReadValueId_init(&readId);
+            UA_NodeId_copy(&id, &readId.nodeId);
+            readId.attributeId = QOpen62541ValueConverter::toUaAttributeId(attribute);
+            if (indexRange.size())
+                readId.indexRange = UA_STRING_ALLOC(indexRange.constData());
+            state->valueIds.push_back(readId);
+
+            QOpcUaReadItemResult temp;
+            temp.setNodeId(item.nodeId());
+            temp.setAttribute(attribute);
+            temp.setIndexRange(item.indexRange());
+            state->results.push_back(temp);
+        });
+
+        UA_NodeId_deleteMembers(&id);
     }
-    emit attributesRead(handle, vec, static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult));
-    UA_ReadValueId_deleteMembers(&readId);
-    UA_ReadResponse_deleteMembers(&res);
+
+    // Split the request if it exceeds the number of operations accepted by the server.
+    // All chunks are in flight at the same time, the extra count keeps the result from
+    // being emitted before the last chunk has been sent.
+    ++state->pendingChunks;
+    for (int offset = 0; offset < state->valueIds.size(); offset += m_maxNodesPerRead)
+        sendReadChunk(state, offset, qMin(m_maxNodesPerRead, state->valueIds.size() - offset));
+    finishReadChunk(state);
 }
 
-void Open62541AsyncBackend::writeAttribute(uintptr_t handle, UA_NodeId id, QOpcUa::NodeAttribute attrId, QVariant value, QOpcUa::Types type, QString indexRange)
+void Open62541AsyncBackend::sendReadChunk(const QSharedPointer<ReadChunkState> &state, int offset, int size)
+{
+    UA_ReadRequest req;
+    UA_ReadRequest_init(&req);
+    UA_Array_copy(state->valueIds.constData() + offset, size, reinterpret_cast<void **>(&req.nodesToRead),
+                  &UA_TYPES[UA_TYPES_READVALUEID]);
+    req.nodesToReadSize = size;
+    req.timestampsToReturn = UA_TIMESTAMPSTORETURN_BOTH;
+
+    ++state->pendingChunks;
+    sendAsyncRequest(&req, &UA_TYPES[UA_TYPES_READREQUEST], &UA_TYPES[UA_TYPES_READRESPONSE],
+                     [this, state, offset, size](void *response) {
+        UA_ReadResponse *res = static_cast<UA_ReadResponse *>(response);
+
+        if (res->responseHeader.serviceResult == UA_STATUSCODE_BADTOOMANYOPERATIONS && size > 1) {
+            m_maxNodesPerRead = qMin(m_maxNodesPerRead, size / 2);
+            qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Server rejected" << size << "read operations, reducing chunk size to" << m_maxNodesPerRead;
+            for (int i = offset; i < offset + size; i += m_maxNodesPerRead)
+                sendReadChunk(state, i, qMin(m_maxNodesPerRead, offset + size - i));
+            finishReadChunk(state);
+            return;
+        }
+
+        for (int i = 0; i < size; ++i) {
+            QOpcUaReadItemResult &result = state->results[offset + i];
+            // Use the service result as status code if there is no specific result for the current value.
+            if (static_cast<size_t>(i) >= res->resultsSize) {
+                result.setStatusCode(static_cast<QOpcUa::UaStatusCode>(res->responseHeader.serviceResult));
+                continue;
+            }
+            UA_DataValue &value = res->results[i];
+            result.setStatusCode(value.hasStatus ? static_cast<QOpcUa::UaStatusCode>(value.status) : QOpcUa::UaStatusCode::Good);
+            if (value.hasValue && value.value.data) {
+                if (lazyValueDecodingEnabled() && result.attribute() == QOpcUa::NodeAttribute::Value) {
+                    QOpcUaReadItemResultPrivate::setEncodedValue(result, QSharedPointer<QOpcUaEncodedValue>(
+                                                                     new QOpen62541EncodedValue(&value.value, typedArraysEnabled())));
+                } else {
+                    result.setValue(QOpen62541ValueConverter::toQVariant(value.value, typedArraysEnabled()));
+                }
+            }
+            if (value.hasSourceTimestamp)
+                result.setRawSourceTimestamp(value.sourceTimestamp);
+            if (value.hasServerTimestamp)
+                result.setRawServerTimestamp(value.serverTimestamp);
+        }
+
+        if (state->serviceResult == UA_STATUSCODE_GOOD)
+            state->serviceResult = res->responseHeader.serviceResult;
+
+        finishReadChunk(state);
+    });
+}
+
+void Open62541AsyncBackend::finishReadChunk(const QSharedPointer<ReadChunkState> &state)
+{
+    if (--state->pendingChunks != 0)
+        return;
+
+    if (state->batchId)
+        emit readNodeAttributesPartFinished(state->batchId, state->results, static_cast<QOpcUa::UaStatusCode>(state->serviceResult));
+    else
+        emit readNodeAttributesFinished(state->results, static_cast<QOpcUa::UaStatusCode>(state->serviceResult));
+}
+
+void Open62541AsyncBackend::writeAttribute(quint64 handle, UA_NodeId id, QOpcUa::NodeAttribute attrId, QVariant value, QOpcUa::Types type, QString indexRange)
 {
     if (type == QOpcUa::Types::Undefined && attrId != QOpcUa::NodeAttribute::Value)
         type = attributeIdToTypeId(attrId);
@@ -151,22 +318,22 @@ void Open62541AsyncBackend::writeAttribute(uintptr_t handle, UA_NodeId id, QOpcU
     if (indexRange.length())
         req.nodesToWrite->indexRange = UA_STRING_ALLOC(indexRange.toUtf8().data());
 
-    UA_WriteResponse res = UA_Client_Service_write(m_uaclient, req);
-
-    QOpcUa::UaStatusCode status = res.resultsSize ?
-                static_cast<QOpcUa::UaStatusCode>(res.results[0]) : static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult);
-
-    emit attributeWritten(handle, attrId, value, status);
+    sendAsyncRequest(&req, &UA_TYPES[UA_TYPES_WRITEREQUEST], &UA_TYPES[UA_TYPES_WRITERESPONSE],
+                     [this, handle, attrId, value](void *response) {
+        const UA_WriteResponse *res = static_cast<UA_WriteResponse *>(response);
+        QOpcUa::UaStatusCode status = res->resultsSize ?
+                    static_cast<QOpcUa::UaStatusCode>(res->results[0]) : static_cast<QOpcUa::UaStatusCode>(res->responseHeader.serviceResult);
 
-    UA_WriteRequest_deleteMembers(&req);
-    UA_WriteResponse_deleteMembers(&res);
+        emit attributeWritten(handle, attrId, value, status);
+    });
 }
 
-void Open62541AsyncBackend::writeAttributes(uintptr_t handle, UA_NodeId id, QOpcUaNode::AttributeMap toWrite, QOpcUa::Types valueAttributeType)
+void Open62541AsyncBackend::writeAttributes(quint64 handle, UA_NodeId id, QOpcUaNode::AttributeMap toWrite, QOpcUa::Types valueAttributeType)
 {
     if (toWrite.size() == 0) {
         qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "No values to be written";
         emit attributeWritten(handle, QOpcUa::NodeAttribute::None, QVariant(), QOpcUa::UaStatusCode::BadNothingToDo);
+        UA_NodeId_deleteMembers(&id);
         return;
     }
 
@@ -182,21 +349,133 @@ void Open62541AsyncBackend::writeAttributes(uintptr_t handle, UA_NodeId id, QOpc
         QOpcUa::Types type = it.key() == QOpcUa::NodeAttribute::Value ? valueAttributeType : attributeIdToTypeId(it.key());
         req.nodesToWrite[index].value.value = QOpen62541ValueConverter::toOpen62541Variant(it.value(), type);
     }
-    UA_WriteResponse res = UA_Client_Service_write(m_uaclient, req);
+    UA_NodeId_deleteMembers(&id);
 
-    index = 0;
-    for (auto it = toWrite.begin(); it != toWrite.end(); ++it, ++index) {
-        QOpcUa::UaStatusCode status = index < res.resultsSize ?
-                    static_cast<QOpcUa::UaStatusCode>(res.results[index]) : static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult);
-        emit attributeWritten(handle, it.key(), it.value(), status);
+    sendAsyncRequest(&req, &UA_TYPES[UA_TYPES_WRITEREQUEST], &UA_TYPES[UA_TYPES_WRITERESPONSE],
+                     [this, handle, toWrite](void *response) {
+        const UA_WriteResponse *res = static_cast<UA_WriteResponse *>(response);
+        size_t index = 0;
+        for (auto it = toWrite.constBegin(); it != toWrite.constEnd(); ++it, ++index) {
+            QOpcUa::UaStatusCode status = index < res->resultsSize ?
+                        static_cast<QOpcUa::UaStatusCode>(res->results[index]) : static_cast<QOpcUa::UaStatusCode>(res->responseHeader.serviceResult);
+            emit attributeWritten(handle, it.key(), it.value(), status);
+        }
+    });
+}
+
+void Open62541AsyncBackend::writeNodeAttributes(QVector<QOpcUaWriteItem> nodesToWrite)
+{
+    writeNodeAttributesPart(0, nodesToWrite);
+}
+
+void Open62541AsyncBackend::writeNodeAttributesPart(quint64 batchId, QVector<QOpcUaWriteItem> nodesToWrite)
+{
+    QSharedPointer<WriteChunkState> state(new WriteChunkState);
+    state->batchId = batchId;
+    state->nodesToWrite = nodesToWrite;
+    sendWriteRequest(state);
+}
+
+// The writes of a coalescing window are sent like a batch write, each node receives its own result
+void Open62541AsyncBackend::writeCoalesced(QVector<QOpcUaCoalescedWrite> writes)
+{
+    QSharedPointer<WriteChunkState> state(new WriteChunkState);
+    state->nodesToWrite.reserve(writes.size());
+    state->handles.reserve(writes.size());
+    for (const QOpcUaCoalescedWrite &write : qAsConst(writes)) {
+        state->nodesToWrite.push_back(write.item);
+        state->handles.push_back(write.handle);
+    }
+    sendWriteRequest(state);
+}
+
+void Open62541AsyncBackend::sendWriteRequest(const QSharedPointer<WriteChunkState> &state)
+{
+    const QVector<QOpcUaWriteItem> &nodesToWrite = state->nodesToWrite;
+    state->writeValues = static_cast<UA_WriteValue *>(UA_Array_new(nodesToWrite.size(), &UA_TYPES[UA_TYPES_WRITEVALUE]));
+    state->results.reserve(nodesToWrite.size());
+
+    for (int i = 0; i < nodesToWrite.size(); ++i) {
+        const QOpcUaWriteItem &item = nodesToWrite.at(i);
+        QOpcUa::Types type = item.type();
+        if (type == QOpcUa::Types::Undefined && item.attribute() != QOpcUa::NodeAttribute::Value)
+            type = attributeIdToTypeId(item.attribute());
+
+        UA_WriteValue &writeValue = state->writeValues[i];
+        writeValue.nodeId = requestNodeId(item.nodeId());
+        writeValue.attributeId = QOpen62541ValueConverter::toUaAttributeId(item.attribute());
+        writeValue.value.value = QOpen62541ValueConverter::toOpen62541Variant(item.value(), type);
+        writeValue.value.hasValue = true;
+        if (item.indexRange().length())
+            writeValue.indexRange = UA_STRING_ALLOC(item.indexRange().toUtf8().constData());
+
+        QOpcUaWriteItemResult temp;
+        temp.setNodeId(item.nodeId());
+        temp.setAttribute(item.attribute());
+        temp.setIndexRange(item.indexRange());
+        state->results.push_back(temp);
     }
 
-    UA_WriteRequest_deleteMembers(&req);
-    UA_WriteResponse_deleteMembers(&res);
-    UA_NodeId_deleteMembers(&id);
+    // Split the request if it exceeds the number of operations accepted by the server.
+    // All chunks are in flight at the same time, see readNodeAttributes().
+    ++state->pendingChunks;
+    for (int offset = 0; offset < nodesToWrite.size(); offset += m_maxNodesPerWrite)
+        sendWriteChunk(state, offset, qMin(m_maxNodesPerWrite, nodesToWrite.size() - offset));
+    finishWriteChunk(state);
 }
 
-void Open62541AsyncBackend::enableMonitoring(uintptr_t handle, UA_NodeId id, QOpcUa::NodeAttributes attr, const QOpcUaMonitoringParameters &settings)
+void Open62541AsyncBackend::sendWriteChunk(const QSharedPointer<WriteChunkState> &state, int offset, int size)
+{
+    UA_WriteRequest req;
+    UA_WriteRequest_init(&req);
+    UA_Array_copy(state->writeValues + offset, size, reinterpret_cast<void **>(&req.nodesToWrite),
+                  &UA_TYPES[UA_TYPES_WRITEVALUE]);
+    req.nodesToWriteSize = size;
+
+    ++state->pendingChunks;
+    sendAsyncRequest(&req, &UA_TYPES[UA_TYPES_WRITEREQUEST], &UA_TYPES[UA_TYPES_WRITERESPONSE],
+                     [this, state, offset, size](void *response) {
+        const UA_WriteResponse *res = static_cast<UA_WriteResponse *>(response);
+
+        if (res->responseHeader.serviceResult == UA_STATUSCODE_BADTOOMANYOPERATIONS && size > 1) {
+            m_maxNodesPerWrite = qMin(m_maxNodesPerWrite, size / 2);
+            qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Server rejected" << size << "write operations, reducing chunk size to" << m_maxNodesPerWrite;
+            for (int i = offset; i < offset + size; i += m_maxNodesPerWrite)
+                sendWriteChunk(state, i, qMin(m_maxNodesPerWrite, offset + size - i));
+            finishWriteChunk(state);
+            return;
+        }
+
+        for (int i = 0; i < size; ++i) {
+            const UA_StatusCode status = static_cast<size_t>(i) < res->resultsSize ? res->results[i] : res->responseHeader.serviceResult;
+            state->results[offset + i].setStatusCode(static_cast<QOpcUa::UaStatusCode>(status));
+        }
+
+        if (state->serviceResult == UA_STATUSCODE_GOOD)
+            state->serviceResult = res->responseHeader.serviceResult;
+
+        finishWriteChunk(state);
+    });
+}
+
+void Open62541AsyncBackend::finishWriteChunk(const QSharedPointer<WriteChunkState> &state)
+{
+    if (--state->pendingChunks != 0)
+        return;
+
+    if (!state->handles.isEmpty()) {
+        for (int i = 0; i < state->handles.size(); ++i) {
+            emit attributeWritten(state->handles.at(i), state->results.at(i).attribute(), state->nodesToWrite.at(i).value(),
+                                  state->results.at(i).statusCode());
+        }
+    } else if (state->batchId) {
+        emit writeNodeAttributesPartFinished(state->batchId, state->results, static_cast<QOpcUa::UaStatusCode>(state->serviceResult));
+    } else {
+        emit writeNodeAttributesFinished(state->nodesToWrite, state->results, static_cast<QOpcUa::UaStatusCode>(state->serviceResult));
+    }
+}
+
+void Open62541AsyncBackend::enableMonitoring(quint64 handle, UA_NodeId id, QOpcUa::NodeAttributes attr, const QOpcUaMonitoringParameters &settings)
 {
     QOpen62541Subscription *usedSubscription = nullptr;
 
@@ -237,7 +516,7 @@ void Open62541AsyncBackend::enableMonitoring(uintptr_t handle, UA_NodeId id, QOp
         } else {
             bool success = usedSubscription->addAttributeMonitoredItem(handle, attribute, id, settings);
             if (success)
-                m_attributeMapping[handle][attribute] = usedSubscription;
+                m_attributeMapping.insert(handle, attribute, usedSubscription);
         }
     });
 
@@ -249,13 +528,13 @@ void Open62541AsyncBackend::enableMonitoring(uintptr_t handle, UA_NodeId id, QOp
     modifyPublishRequests();
 }
 
-void Open62541AsyncBackend::disableMonitoring(uintptr_t handle, QOpcUa::NodeAttributes attr)
+void Open62541AsyncBackend::disableMonitoring(quint64 handle, QOpcUa::NodeAttributes attr)
 {
     qt_forEachAttribute(attr, [&](QOpcUa::NodeAttribute attribute){
         QOpen62541Subscription *sub = getSubscriptionForItem(handle, attribute);
         if (sub) {
             sub->removeAttributeMonitoredItem(handle, attribute);
-            m_attributeMapping[handle].remove(attribute);
+            m_attributeMapping.remove(handle, attribute);
             if (sub->monitoredItemsCount() == 0)
                 removeSubscription(sub->subscriptionId());
         }
@@ -263,7 +542,136 @@ void Open62541AsyncBackend::disableMonitoring(uintptr_t handle, QOpcUa::NodeAttr
     modifyPublishRequests();
 }
 
-void Open62541AsyncBackend::modifyMonitoring(uintptr_t handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value)
+void Open62541AsyncBackend::enableMonitoringForNodes(QVector<QOpcUaNodeHandle> nodes, QOpcUa::NodeAttributes attr, QOpcUaMonitoringParameters settings)
+{
+    const auto reportError = [&](QOpcUa::UaStatusCode statusCode) {
+        QOpcUaMonitoringParameters s;
+        s.setStatusCode(statusCode);
+        for (const QOpcUaNodeHandle &node : qAsConst(nodes)) {
+            qt_forEachAttribute(attr, [&](QOpcUa::NodeAttribute attribute){
+                emit monitoringEnableDisable(node.handle, attribute, true, s);
+            });
+        }
+    };
+
+    QOpen62541Subscription *usedSubscription = nullptr;
+
+    // Create a new subscription if necessary
+    if (settings.subscriptionId()) {
+        usedSubscription = m_subscriptions.value(settings.subscriptionId());
+        if (!usedSubscription) {
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "There is no subscription with id" << settings.subscriptionId();
+            reportError(QOpcUa::UaStatusCode::BadSubscriptionIdInvalid);
+            return;
+        }
+    } else {
+        usedSubscription = getSubscription(settings);
+        if (!usedSubscription) {
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not create subscription with interval" << settings.publishingInterval();
+            reportError(QOpcUa::UaStatusCode::BadSubscriptionIdInvalid);
+            return;
+        }
+    }
+
+    QVector<UA_NodeId> nodeIds;
+    nodeIds.reserve(nodes.size());
+    QVector<QOpen62541Subscription::ItemToMonitor> items;
+    // A handle may be passed more than once, each attribute is only monitored once per handle
+    QSet<QPair<quint64, uint>> requestedItems;
+
+    for (const QOpcUaNodeHandle &node : qAsConst(nodes)) {
+        nodeIds.push_back(requestNodeId(node.nodeId));
+        const UA_NodeId &id = nodeIds.last();
+
+        qt_forEachAttribute(attr, [&](QOpcUa::NodeAttribute attribute){
+            QOpcUaMonitoringParameters s;
+            const QPair<quint64, uint> key(node.handle, static_cast<uint>(attribute));
+            if (UA_NodeId_isNull(&id)) {
+                s.setStatusCode(QOpcUa::UaStatusCode::BadNodeIdInvalid);
+                emit monitoringEnableDisable(node.handle, attribute, true, s);
+            } else if (getSubscriptionForItem(node.handle, attribute) || requestedItems.contains(key)) {
+                qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Monitored item for" << attribute << "has already been created";
+                s.setStatusCode(QOpcUa::UaStatusCode::BadEntryExists);
+                emit monitoringEnableDisable(node.handle, attribute, true, s);
+            } else {
+                requestedItems.insert(key);
+                items.push_back({node.handle, attribute, id});
+            }
+        });
+    }
+
+    // Split the request if it exceeds the number of operations accepted by the server
+    for (int offset = 0; offset < items.size();) {
+        const int chunkSize = qMin(m_maxMonitoredItemsPerRequest, items.size() - offset);
+
+        const UA_StatusCode serviceResult = usedSubscription->addAttributeMonitoredItems(items.mid(offset, chunkSize), settings);
+
+        if (serviceResult == UA_STATUSCODE_BADTOOMANYOPERATIONS && chunkSize > 1) {
+            m_maxMonitoredItemsPerRequest = chunkSize / 2;
+            qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Server rejected" << chunkSize << "monitored items, reducing chunk size to" << m_maxMonitoredItemsPerRequest;
+            continue;
+        }
+
+        for (int i = offset; i < offset + chunkSize; ++i) {
+            const QOpen62541Subscription::ItemToMonitor &item = items.at(i);
+            if (usedSubscription->hasMonitoredItem(item.handle, item.attr))
+                m_attributeMapping.insert(item.handle, item.attr, usedSubscription);
+        }
+
+        offset += chunkSize;
+    }
+
+    for (UA_NodeId &id : nodeIds)
+        UA_NodeId_deleteMembers(&id);
+
+    if (usedSubscription->monitoredItemsCount() == 0)
+        removeSubscription(usedSubscription->subscriptionId()); // No items were added
+
+    modifyPublishRequests();
+}
+
+void Open62541AsyncBackend::disableMonitoringForNodes(QVector<QOpcUaNodeHandle> nodes, QOpcUa::NodeAttributes attr)
+{
+    QHash<QOpen62541Subscription *, QVector<QPair<quint64, QOpcUa::NodeAttribute>>> itemsPerSubscription;
+
+    for (const QOpcUaNodeHandle &node : qAsConst(nodes)) {
+        qt_forEachAttribute(attr, [&](QOpcUa::NodeAttribute attribute){
+            QOpen62541Subscription *sub = getSubscriptionForItem(node.handle, attribute);
+            if (sub)
+                itemsPerSubscription[sub].push_back(qMakePair(node.handle, attribute));
+        });
+    }
+
+    for (auto it = itemsPerSubscription.constBegin(); it != itemsPerSubscription.constEnd(); ++it) {
+        QOpen62541Subscription *sub = it.key();
+        const QVector<QPair<quint64, QOpcUa::NodeAttribute>> &items = it.value();
+
+        // Split the request if it exceeds the number of operations accepted by the server
+        for (int offset = 0; offset < items.size();) {
+            const int chunkSize = qMin(m_maxMonitoredItemsPerRequest, items.size() - offset);
+
+            const UA_StatusCode serviceResult = sub->removeAttributeMonitoredItems(items.mid(offset, chunkSize));
+
+            if (serviceResult == UA_STATUSCODE_BADTOOMANYOPERATIONS && chunkSize > 1) {
+                m_maxMonitoredItemsPerRequest = chunkSize / 2;
+                qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Server rejected" << chunkSize << "monitored items, reducing chunk size to" << m_maxMonitoredItemsPerRequest;
+                continue;
+            }
+
+            offset += chunkSize;
+        }
+
+        for (const auto &item : items)
+            m_attributeMapping.remove(item.first, item.second);
+
+        if (sub->monitoredItemsCount() == 0)
+            removeSubscription(sub->subscriptionId());
+    }
+
+    modifyPublishRequests();
+}
+
+void Open62541AsyncBackend::modifyMonitoring(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value)
 {
     QOpen62541Subscription *subscription = getSubscriptionForItem(handle, attr);
     if (!subscription) {
@@ -316,53 +724,166 @@ bool Open62541AsyncBackend::removeSubscription(UA_UInt32 subscriptionId)
     return false;
 }
 
-void Open62541AsyncBackend::callMethod(uintptr_t handle, UA_NodeId objectId, UA_NodeId methodId, QVector<QOpcUa::TypedVariant> args)
+void Open62541AsyncBackend::callMethod(quint64 handle, UA_NodeId objectId, UA_NodeId methodId, QVector<QOpcUa::TypedVariant> args)
 {
-    UA_Variant *inputArgs = nullptr;
+    const QString methodNodeId = Open62541Utils::nodeIdToQString(methodId);
+
+    UA_CallRequest req;
+    UA_CallRequest_init(&req);
+    req.methodsToCallSize = 1;
+    req.methodsToCall = UA_CallMethodRequest_new();
+    req.methodsToCall->objectId = objectId;
+    req.methodsToCall->methodId = methodId;
 
     if (args.size()) {
-        inputArgs = static_cast<UA_Variant *>(UA_Array_new(args.size(), &UA_TYPES[UA_TYPES_VARIANT]));
+        req.methodsToCall->inputArgumentsSize = args.size();
+        req.methodsToCall->inputArguments = static_cast<UA_Variant *>(UA_Array_new(args.size(), &UA_TYPES[UA_TYPES_VARIANT]));
         for (int i = 0; i < args.size(); ++i)
-            inputArgs[i] = QOpen62541ValueConverter::toOpen62541Variant(args[i].first, args[i].second);
+            req.methodsToCall->inputArguments[i] = QOpen62541ValueConverter::toOpen62541Variant(args[i].first, args[i].second);
     }
 
-    size_t outputSize = 0;
-    UA_Variant *outputArguments;
-    UA_StatusCode res = UA_Client_call(m_uaclient, objectId, methodId, args.size(), inputArgs, &outputSize, &outputArguments);
+    sendAsyncRequest(&req, &UA_TYPES[UA_TYPES_CALLREQUEST], &UA_TYPES[UA_TYPES_CALLRESPONSE],
+                     [this, handle, methodNodeId](void *response) {
+        const UA_CallResponse *res = static_cast<UA_CallResponse *>(response);
+
+        UA_StatusCode status = res->responseHeader.serviceResult;
+        if (status == UA_STATUSCODE_GOOD)
+            status = res->resultsSize == 1 ? res->results[0].statusCode : UA_STATUSCODE_BADUNEXPECTEDERROR;
+
+        if (status != UA_STATUSCODE_GOOD)
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not call method:" << UA_StatusCode_name(status);
 
-    if (res != UA_STATUSCODE_GOOD)
-        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not call method:" << UA_StatusCode_name(res);
+        QVariant result;
 
-    QVariant result;
+        if (status == UA_STATUSCODE_GOOD) {
+            const size_t outputSize = res->results[0].outputArgumentsSize;
+            const UA_Variant *outputArguments = res->results[0].outputArguments;
 
-    if (outputSize > 1 && res == UA_STATUSCODE_GOOD) {
-        QVariantList temp;
-        for (size_t i = 0; i < outputSize; ++i)
-            temp.append(QOpen62541ValueConverter::toQVariant(outputArguments[i]));
+            if (outputSize > 1) {
+                QVariantList temp;
+                for (size_t i = 0; i < outputSize; ++i)
+                    temp.append(QOpen62541ValueConverter::toQVariant(outputArguments[i], typedArraysEnabled()));
+
+                result = temp;
+            } else if (outputSize == 1) {
+                result = QOpen62541ValueConverter::toQVariant(outputArguments[0], typedArraysEnabled());
+            }
+        }
 
-        result = temp;
-    } else if (outputSize == 1 && res == UA_STATUSCODE_GOOD) {
-        result = QOpen62541ValueConverter::toQVariant(outputArguments[0]);
+        emit methodCallFinished(handle, methodNodeId, result, static_cast<QOpcUa::UaStatusCode>(status));
+    });
+}
+
+void Open62541AsyncBackend::registerNodes(QVector<QOpcUaNodeHandle> nodes)
+{
+    if (nodes.isEmpty())
+        return;
+
+    UA_RegisterNodesRequest req;
+    UA_RegisterNodesRequest_init(&req);
+    req.nodesToRegisterSize = nodes.size();
+    req.nodesToRegister = static_cast<UA_NodeId *>(UA_Array_new(nodes.size(), &UA_TYPES[UA_TYPES_NODEID]));
+    for (int i = 0; i < nodes.size(); ++i)
+        req.nodesToRegister[i] = Open62541Utils::nodeIdFromQString(nodes.at(i).nodeId);
+
+    sendAsyncRequest(&req, &UA_TYPES[UA_TYPES_REGISTERNODESREQUEST], &UA_TYPES[UA_TYPES_REGISTERNODESRESPONSE],
+                     [this, nodes](void *response) {
+        const UA_RegisterNodesResponse *res = static_cast<UA_RegisterNodesResponse *>(response);
+
+        UA_StatusCode status = res->responseHeader.serviceResult;
+        // The registered ids are returned in the order of the request
+        if (status == UA_STATUSCODE_GOOD && res->registeredNodeIdsSize != static_cast<size_t>(nodes.size()))
+            status = UA_STATUSCODE_BADUNEXPECTEDERROR;
+
+        if (status != UA_STATUSCODE_GOOD)
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not register nodes:" << UA_StatusCode_name(status);
+
+        for (int i = 0; i < nodes.size(); ++i) {
+            QString registeredNodeId;
+            if (status == UA_STATUSCODE_GOOD) {
+                registeredNodeId = Open62541Utils::nodeIdToQString(res->registeredNodeIds[i]);
+                m_registeredNodeIds.insert(nodes.at(i).handle, registeredNodeId);
+                QVector<quint64> &handles = m_registeredHandles[nodes.at(i).nodeId];
+                if (!handles.contains(nodes.at(i).handle))
+                    handles.push_back(nodes.at(i).handle);
+            }
+            emit nodeRegistered(nodes.at(i).handle, registeredNodeId, static_cast<QOpcUa::UaStatusCode>(status));
+        }
+    });
+}
+
+// Batch requests only contain node ids, they use the id returned by RegisterNodes
+// for any node with this node id. The caller owns the returned node id.
+UA_NodeId Open62541AsyncBackend::requestNodeId(const QString &nodeId) const
+{
+    if (!m_registeredHandles.isEmpty()) {
+        const auto it = m_registeredHandles.constFind(nodeId);
+        if (it != m_registeredHandles.constEnd())
+            return Open62541Utils::nodeIdFromQString(m_registeredNodeIds.value(it.value().first()));
+    }
+    return Open62541Utils::nodeIdFromQString(nodeId);
+}
+
+void Open62541AsyncBackend::unregisterNodes(QVector<QOpcUaNodeHandle> nodes)
+{
+    // Nodes which are not registered in this session are rejected without a request
+    QVector<quint64> handles;
+    QVector<QString> registeredNodeIds;
+    for (const QOpcUaNodeHandle &node : qAsConst(nodes)) {
+        const auto it = m_registeredNodeIds.find(node.handle);
+        if (it == m_registeredNodeIds.end()) {
+            emit nodeUnregistered(node.handle, QOpcUa::UaStatusCode::BadInvalidState);
+            continue;
+        }
+        handles.push_back(node.handle);
+        registeredNodeIds.push_back(it.value());
+        m_registeredNodeIds.erase(it);
+
+        const auto handlesIt = m_registeredHandles.find(node.nodeId);
+        if (handlesIt != m_registeredHandles.end()) {
+            handlesIt.value().removeOne(node.handle);
+            if (handlesIt.value().isEmpty())
+                m_registeredHandles.erase(handlesIt);
+        }
     }
 
-    UA_Array_delete(inputArgs, args.size(), &UA_TYPES[UA_TYPES_VARIANT]);
-    if (outputSize > 0)
-        UA_Array_delete(outputArguments, outputSize, &UA_TYPES[UA_TYPES_VARIANT]);
+    if (handles.isEmpty())
+        return;
+
+    UA_UnregisterNodesRequest req;
+    UA_UnregisterNodesRequest_init(&req);
+    req.nodesToUnregisterSize = registeredNodeIds.size();
+    req.nodesToUnregister = static_cast<UA_NodeId *>(UA_Array_new(registeredNodeIds.size(), &UA_TYPES[UA_TYPES_NODEID]));
+    for (int i = 0; i < registeredNodeIds.size(); ++i)
+        req.nodesToUnregister[i] = Open62541Utils::nodeIdFromQString(registeredNodeIds.at(i));
+
+    sendAsyncRequest(&req, &UA_TYPES[UA_TYPES_UNREGISTERNODESREQUEST], &UA_TYPES[UA_TYPES_UNREGISTERNODESRESPONSE],
+                     [this, handles](void *response) {
+        const UA_UnregisterNodesResponse *res = static_cast<UA_UnregisterNodesResponse *>(response);
 
-    emit methodCallFinished(handle, Open62541Utils::nodeIdToQString(methodId), result, static_cast<QOpcUa::UaStatusCode>(res));
+        const UA_StatusCode status = res->responseHeader.serviceResult;
+        if (status != UA_STATUSCODE_GOOD)
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not unregister nodes:" << UA_StatusCode_name(status);
 
-    UA_NodeId_deleteMembers(&objectId);
-    UA_NodeId_deleteMembers(&methodId);
+        for (quint64 handle : handles)
+            emit nodeUnregistered(handle, static_cast<QOpcUa::UaStatusCode>(status));
+    });
 }
 
-static void convertBrowseResult(UA_BrowseResult *src, quint32 referencesSize, QVector<QOpcUaReferenceDescription> &dst)
+void Open62541AsyncBackend::setMaxPendingRequests(int count)
+{
+    m_maxPendingRequests = qMax(1, count);
+    dispatchQueuedRequests();
+}
+
+static void convertBrowseResult(const UA_BrowseResult *src, quint32 referencesSize, QVector<QOpcUaReferenceDescription> &dst)
 {
     if (!src)
         return;
 
     for (size_t i = 0; i < referencesSize; ++i) {
         QOpcUaReferenceDescription temp;
-        temp.setNodeId(Open62541Utils::nodeIdToQString(src->references[i].nodeId.nodeId));
+        temp.setNodeId(Open62541Utils::nodeIdToQOpcUaNodeId(src->references[i].nodeId.nodeId));
         temp.setRefType(static_cast<QOpcUa::ReferenceTypeId>(src->references[i].referenceTypeId.identifier.numeric));
         temp.setNodeClass(static_cast<QOpcUa::NodeClass>(src->references[i].nodeClass));
         temp.setBrowseName(QOpen62541ValueConverter::scalarToQVariant<QOpcUa::QQualifiedName, UA_QualifiedName>(
@@ -373,7 +894,7 @@ static void convertBrowseResult(UA_BrowseResult *src, quint32 referencesSize, QV
     }
 }
 
-void Open62541AsyncBackend::browseChildren(uintptr_t handle, UA_NodeId id, QOpcUa::ReferenceTypeId referenceType, QOpcUa::NodeClasses nodeClassMask)
+void Open62541AsyncBackend::browseChildren(quint64 handle, UA_NodeId id, QOpcUa::ReferenceTypeId referenceType, QOpcUa::NodeClasses nodeClassMask)
 {
     UA_BrowseRequest request;
     UA_BrowseRequest_init(&request);
@@ -388,41 +909,277 @@ void Open62541AsyncBackend::browseChildren(uintptr_t handle, UA_NodeId id, QOpcU
     request.nodesToBrowse->referenceTypeId = UA_NODEID_NUMERIC(0, static_cast<quint32>(referenceType));
     request.requestedMaxReferencesPerNode = 0; // Let the server choose a maximum value
 
-    UA_BrowseResponse *response = UA_BrowseResponse_new();
-    *response = UA_Client_Service_browse(m_uaclient, request);
-    UA_BrowseRequest_deleteMembers(&request);
+    sendAsyncRequest(&request, &UA_TYPES[UA_TYPES_BROWSEREQUEST], &UA_TYPES[UA_TYPES_BROWSERESPONSE],
+                     [this, handle](void *response) {
+        const UA_BrowseResponse *res = static_cast<UA_BrowseResponse *>(response);
+        handleBrowseResult(handle, res->responseHeader.serviceResult, res->resultsSize, res->results,
+                           QVector<QOpcUaReferenceDescription>());
+    });
+}
+
+void Open62541AsyncBackend::handleBrowseResult(quint64 handle, UA_StatusCode serviceResult, size_t resultsSize,
+                                               const UA_BrowseResult *results, QVector<QOpcUaReferenceDescription> references)
+{
+    if (serviceResult != UA_STATUSCODE_GOOD || !resultsSize || results->statusCode != UA_STATUSCODE_GOOD) {
+        const UA_StatusCode statusCode = serviceResult != UA_STATUSCODE_GOOD || !resultsSize ? serviceResult : results->statusCode;
+        emit browseFinished(handle, references, static_cast<QOpcUa::UaStatusCode>(statusCode));
+        return;
+    }
+
+    convertBrowseResult(results, results->referencesSize, references);
 
-    QVector<QOpcUaReferenceDescription> ret;
+    if (!results->continuationPoint.length) {
+        emit browseFinished(handle, references, QOpcUa::UaStatusCode::Good);
+        return;
+    }
+
+    // The next part of the result is requested asynchronously as well, other requests are not blocked
+    UA_BrowseNextRequest nextReq;
+    UA_BrowseNextRequest_init(&nextReq);
+    nextReq.continuationPoints = UA_ByteString_new();
+    UA_ByteString_copy(&(results->continuationPoint), nextReq.continuationPoints);
+    nextReq.continuationPointsSize = 1;
+    const QVector<QByteArray> pendingContinuationPoints{QByteArray(reinterpret_cast<const char *>(results->continuationPoint.data),
+                                                                   static_cast<int>(results->continuationPoint.length))};
+
+    sendAsyncRequest(&nextReq, &UA_TYPES[UA_TYPES_BROWSENEXTREQUEST], &UA_TYPES[UA_TYPES_BROWSENEXTRESPONSE],
+                     [this, handle, references, pendingContinuationPoints](void *response) {
+        const UA_BrowseNextResponse *res = static_cast<UA_BrowseNextResponse *>(response);
+        if (res->responseHeader.serviceResult != UA_STATUSCODE_GOOD)
+            releaseContinuationPoints(pendingContinuationPoints, res->responseHeader.serviceResult);
+        handleBrowseResult(handle, res->responseHeader.serviceResult, res->resultsSize, res->results, references);
+    });
+}
+
+// State of a recursive browse operation, shared by all of its requests
+struct Open62541AsyncBackend::BrowseRecursiveState
+{
+    BrowseRecursiveState()
+        : referenceType(QOpcUa::ReferenceTypeId::HierarchicalReferences)
+        , maxDepth(-1)
+        , pendingRequests(0)
+        , statusCode(UA_STATUSCODE_GOOD)
+        , aborted(false)
+        , finished(false)
+    {}
+
+    QString rootNodeId;
+    QOpcUa::ReferenceTypeId referenceType;
+    QOpcUa::NodeClasses nodeClassMask;
+    int maxDepth;
+    QSet<QString> visited;
+    QQueue<BrowseTarget> nodesToBrowse;
+    int pendingRequests;
+    UA_StatusCode statusCode;
+    bool aborted; // A request failed, the requests in flight are only waited for
+    bool finished;
+};
+
+void Open62541AsyncBackend::browseRecursive(QString rootNodeId, QOpcUa::ReferenceTypeId referenceType, QOpcUa::NodeClasses nodeClassMask, int maxDepth)
+{
+    QSharedPointer<BrowseRecursiveState> state(new BrowseRecursiveState);
+    state->rootNodeId = rootNodeId;
+    state->referenceType = referenceType;
+    state->nodeClassMask = nodeClassMask;
+    state->maxDepth = maxDepth;
+    state->visited.insert(rootNodeId);
+    state->nodesToBrowse.enqueue(BrowseTarget(rootNodeId, 0));
+
+    sendRecursiveBrowseRequests(state);
+}
 
-    QOpcUa::UaStatusCode statusCode = QOpcUa::UaStatusCode::Good;
+void Open62541AsyncBackend::sendRecursiveBrowseRequests(const QSharedPointer<BrowseRecursiveState> &state)
+{
+    // Requests to a disconnected client fail right away, the remaining nodes are dropped instead
+    if (!m_uaclient && !state->aborted)
+        abortRecursiveBrowse(state, UA_STATUSCODE_BADSERVERNOTCONNECTED);
 
-    while (response->resultsSize && statusCode == QOpcUa::UaStatusCode::Good) {
-        UA_BrowseResponse *res = static_cast<UA_BrowseResponse *>(response);
+    // Leave room in the pipeline for requests of other operations
+    const int maxRequests = qMax(1, m_maxPendingRequests / 2);
 
-        if (res->responseHeader.serviceResult != UA_STATUSCODE_GOOD || res->results->statusCode != UA_STATUSCODE_GOOD) {
-            statusCode = static_cast<QOpcUa::UaStatusCode>(res->results->statusCode);
+    while (!state->nodesToBrowse.isEmpty() && state->pendingRequests < maxRequests) {
+        // As long as responses are outstanding, they will add more nodes. Only full batches are sent until then.
+        if (state->pendingRequests > 0 && state->nodesToBrowse.size() < m_maxNodesPerBrowse)
             break;
+
+        QVector<BrowseTarget> targets;
+        const int batchSize = qMin(m_maxNodesPerBrowse, state->nodesToBrowse.size());
+        targets.reserve(batchSize);
+        for (int i = 0; i < batchSize; ++i)
+            targets.push_back(state->nodesToBrowse.dequeue());
+
+        UA_BrowseRequest request;
+        UA_BrowseRequest_init(&request);
+        request.nodesToBrowseSize = targets.size();
+        request.nodesToBrowse = static_cast<UA_BrowseDescription *>(UA_Array_new(targets.size(), &UA_TYPES[UA_TYPES_BROWSEDESCRIPTION]));
+        request.requestedMaxReferencesPerNode = 0; // Let the server choose a maximum value
+
+        for (int i = 0; i < targets.size(); ++i) {
+            UA_BrowseDescription &description = request.nodesToBrowse[i];
+            description.nodeId = Open62541Utils::nodeIdFromQString(targets.at(i).first);
+            description.browseDirection = UA_BROWSEDIRECTION_FORWARD;
+            description.includeSubtypes = true;
+            description.nodeClassMask = static_cast<quint32>(state->nodeClassMask);
+            description.resultMask = UA_BROWSERESULTMASK_BROWSENAME | UA_BROWSERESULTMASK_DISPLAYNAME |
+                    UA_BROWSERESULTMASK_REFERENCETYPEID | UA_BROWSERESULTMASK_NODECLASS;
+            description.referenceTypeId = UA_NODEID_NUMERIC(0, static_cast<quint32>(state->referenceType));
         }
 
-        convertBrowseResult(res->results, res->results->referencesSize, ret);
-
-        if (res->results->continuationPoint.length) {
-            UA_BrowseNextRequest nextReq;
-            UA_BrowseNextRequest_init(&nextReq);
-            nextReq.continuationPoints = UA_ByteString_new();
-            UA_ByteString_copy(&(res->results->continuationPoint), nextReq.continuationPoints);
-            nextReq.continuationPointsSize = 1;
-            UA_BrowseResponse_deleteMembers(res);
-            *reinterpret_cast<UA_BrowseNextResponse *>(response) = UA_Client_Service_browseNext(m_uaclient, nextReq);
-            UA_BrowseNextRequest_deleteMembers(&nextReq);
-        } else {
-            break;
+        ++state->pendingRequests;
+        sendAsyncRequest(&request, &UA_TYPES[UA_TYPES_BROWSEREQUEST], &UA_TYPES[UA_TYPES_BROWSERESPONSE],
+                         [this, state, targets](void *response) {
+            const UA_BrowseResponse *res = static_cast<UA_BrowseResponse *>(response);
+            --state->pendingRequests;
+
+            if (res->responseHeader.serviceResult == UA_STATUSCODE_BADTOOMANYOPERATIONS && targets.size() > 1 && !state->aborted) {
+                m_maxNodesPerBrowse = qMin(m_maxNodesPerBrowse, targets.size() / 2);
+                qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Server rejected" << targets.size() << "browse operations, reducing chunk size to" << m_maxNodesPerBrowse;
+                for (auto it = targets.crbegin(); it != targets.crend(); ++it)
+                    state->nodesToBrowse.prepend(*it);
+            } else {
+                handleRecursiveBrowseResults(state, targets, res->responseHeader.serviceResult, res->resultsSize, res->results);
+            }
+
+            sendRecursiveBrowseRequests(state);
+        });
+    }
+
+    if (!state->finished && state->pendingRequests == 0 && state->nodesToBrowse.isEmpty()) {
+        state->finished = true;
+        emit browseRecursiveFinished(state->rootNodeId, static_cast<QOpcUa::UaStatusCode>(state->statusCode));
+    }
+}
+
+void Open62541AsyncBackend::handleRecursiveBrowseResults(const QSharedPointer<BrowseRecursiveState> &state, const QVector<BrowseTarget> &targets,
+                                                         UA_StatusCode serviceResult, size_t resultsSize, const UA_BrowseResult *results)
+{
+    const bool failed = serviceResult != UA_STATUSCODE_GOOD || resultsSize != static_cast<size_t>(targets.size());
+    if (failed || state->aborted) {
+        UA_StatusCode reason = serviceResult;
+        if (failed) {
+            reason = serviceResult != UA_STATUSCODE_GOOD ? serviceResult : UA_STATUSCODE_BADUNEXPECTEDERROR;
+            abortRecursiveBrowse(state, reason);
+        }
+
+        // The references behind the continuation points are not requested
+        QVector<QByteArray> unusedContinuationPoints;
+        for (size_t i = 0; i < resultsSize; ++i) {
+            const UA_ByteString &continuationPoint = results[i].continuationPoint;
+            if (continuationPoint.length)
+                unusedContinuationPoints.push_back(QByteArray(reinterpret_cast<const char *>(continuationPoint.data),
+                                                              static_cast<int>(continuationPoint.length)));
+        }
+        releaseContinuationPoints(unusedContinuationPoints, reason);
+        return;
+    }
+
+    QVector<QOpcUaReferenceDescription> references;
+    QVector<BrowseTarget> continuationTargets;
+    QVector<UA_ByteString> continuationPoints;
+    QVector<QByteArray> pendingContinuationPoints;
+
+    for (size_t i = 0; i < resultsSize; ++i) {
+        const UA_BrowseResult &result = results[i];
+        const BrowseTarget &target = targets.at(static_cast<int>(i));
+
+        if (result.statusCode != UA_STATUSCODE_GOOD) {
+            if (state->statusCode == UA_STATUSCODE_GOOD)
+                state->statusCode = result.statusCode;
+            continue;
         }
+
+        const int first = references.size();
+        convertBrowseResult(&result, result.referencesSize, references);
+
+        const bool browseChildren = state->maxDepth < 0 || target.second + 1 < state->maxDepth;
+        for (int j = first; j < references.size(); ++j) {
+            QOpcUaReferenceDescription &reference = references[j];
+            reference.setParentNodeId(target.first);
+
+            // Nodes on other servers can't be browsed with this connection
+            const UA_ExpandedNodeId &targetId = result.references[j - first].nodeId;
+            if (!browseChildren || targetId.serverIndex != 0 || targetId.namespaceUri.length)
+                continue;
+
+            const QString nodeId = reference.nodeId();
+            if (!state->visited.contains(nodeId)) {
+                state->visited.insert(nodeId);
+                state->nodesToBrowse.enqueue(BrowseTarget(nodeId, target.second + 1));
+            }
+        }
+
+        if (result.continuationPoint.length) {
+            UA_ByteString continuationPoint;
+            UA_ByteString_copy(&result.continuationPoint, &continuationPoint);
+            continuationPoints.push_back(continuationPoint);
+            continuationTargets.push_back(target);
+            pendingContinuationPoints.push_back(QByteArray(reinterpret_cast<const char *>(continuationPoint.data),
+                                                           static_cast<int>(continuationPoint.length)));
+        }
+    }
+
+    if (!references.isEmpty())
+        emit browseRecursiveResultsAvailable(state->rootNodeId, references);
+
+    if (continuationPoints.isEmpty())
+        return;
+
+    // The remaining references of all nodes in this response are requested at once
+    UA_BrowseNextRequest request;
+    UA_BrowseNextRequest_init(&request);
+    request.continuationPointsSize = continuationPoints.size();
+    request.continuationPoints = static_cast<UA_ByteString *>(UA_Array_new(continuationPoints.size(), &UA_TYPES[UA_TYPES_BYTESTRING]));
+    memcpy(request.continuationPoints, continuationPoints.constData(), continuationPoints.size() * sizeof(UA_ByteString));
+
+    ++state->pendingRequests;
+    sendAsyncRequest(&request, &UA_TYPES[UA_TYPES_BROWSENEXTREQUEST], &UA_TYPES[UA_TYPES_BROWSENEXTRESPONSE],
+                     [this, state, continuationTargets, pendingContinuationPoints](void *response) {
+        const UA_BrowseNextResponse *res = static_cast<UA_BrowseNextResponse *>(response);
+        --state->pendingRequests;
+        // The server keeps the continuation points of a failed request
+        if (res->responseHeader.serviceResult != UA_STATUSCODE_GOOD)
+            releaseContinuationPoints(pendingContinuationPoints, res->responseHeader.serviceResult);
+        handleRecursiveBrowseResults(state, continuationTargets, res->responseHeader.serviceResult, res->resultsSize, res->results);
+        sendRecursiveBrowseRequests(state);
+    });
+}
+
+// A failed request ends the recursive browse, browseRecursiveFinished() is emitted once the requests in flight have returned.
+// Without this, every queued batch would be sent to a disconnected client and fail synchronously.
+void Open62541AsyncBackend::abortRecursiveBrowse(const QSharedPointer<BrowseRecursiveState> &state, UA_StatusCode statusCode)
+{
+    if (state->statusCode == UA_STATUSCODE_GOOD)
+        state->statusCode = statusCode;
+    state->aborted = true;
+    state->nodesToBrowse.clear();
+}
+
+// Continuation points hold resources on the server until they are used or released.
+// The server drops them with the session, nothing is sent if the connection is gone.
+void Open62541AsyncBackend::releaseContinuationPoints(const QVector<QByteArray> &continuationPoints, UA_StatusCode reason)
+{
+    if (continuationPoints.isEmpty() || reason == UA_STATUSCODE_BADSHUTDOWN || reason == UA_STATUSCODE_BADSERVERNOTCONNECTED
+            || reason == UA_STATUSCODE_BADCONNECTIONCLOSED || reason == UA_STATUSCODE_BADSESSIONIDINVALID) {
+        return;
     }
 
-    emit browseFinished(handle, ret, statusCode);
+    UA_BrowseNextRequest request;
+    UA_BrowseNextRequest_init(&request);
+    request.releaseContinuationPoints = true;
+    request.continuationPointsSize = continuationPoints.size();
+    request.continuationPoints = static_cast<UA_ByteString *>(UA_Array_new(continuationPoints.size(), &UA_TYPES[UA_TYPES_BYTESTRING]));
+    for (int i = 0; i < continuationPoints.size(); ++i) {
+        const QByteArray &continuationPoint = continuationPoints.at(i);
+        UA_ByteString_allocBuffer(&request.continuationPoints[i], continuationPoint.size());
+        memcpy(request.continuationPoints[i].data, continuationPoint.constData(), continuationPoint.size());
+    }
 
-    UA_BrowseResponse_delete(static_cast<UA_BrowseResponse *>(response));
+    sendAsyncRequest(&request, &UA_TYPES[UA_TYPES_BROWSENEXTREQUEST], &UA_TYPES[UA_TYPES_BROWSENEXTRESPONSE],
+                     [](void *response) {
+        const UA_BrowseNextResponse *res = static_cast<UA_BrowseNextResponse *>(response);
+        if (res->responseHeader.serviceResult != UA_STATUSCODE_GOOD)
+            qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Could not release continuation points:" << UA_StatusCode_name(res->responseHeader.serviceResult);
+    });
 }
 
 static void clientStateCallback(UA_Client *client, UA_ClientState state)
@@ -444,6 +1201,8 @@ void Open62541AsyncBackend::connectToEndpoint(const QUrl &url)
 
     if (m_uaclient)
         UA_Client_delete(m_uaclient);
+    m_uaclient = nullptr;
+    abortAsyncRequests(UA_STATUSCODE_BADSHUTDOWN);
 
     m_useStateCallback = false;
 
@@ -490,6 +1249,12 @@ void Open62541AsyncBackend::disconnectFromEndpoint()
         m_uaclient = nullptr;
     }
 
+    abortAsyncRequests(UA_STATUSCODE_BADSHUTDOWN);
+
+    // Registered node ids are only valid in the session they have been registered in
+    m_registeredNodeIds.clear();
+    m_registeredHandles.clear();
+
     emit stateAndOrErrorChanged(QOpcUaClient::Disconnected, QOpcUaClient::NoError);
 }
 
@@ -498,26 +1263,221 @@ void Open62541AsyncBackend::sendPublishRequest()
     if (!m_uaclient)
         return;
 
-    if (!m_sendPublishRequests) {
+    if (!m_sendPublishRequests && m_pendingRequests.isEmpty())
         return;
-    }
 
+    // The bundled open62541 does not expose the client socket for a QSocketNotifier. UA_Client_runAsync() is
+    // called with a zero timeout instead, it only processes the publish responses and service responses which
+    // have already arrived and never blocks the thread. Queued slots and other backends sharing the thread run
+    // between two polls. The polls follow the shortest publishing interval, the thread sleeps in between.
     // If BADSERVERNOTCONNECTED is returned, the subscriptions are gone and local information can be deleted.
-    if (UA_Client_runAsync(m_uaclient, 1) == UA_STATUSCODE_BADSERVERNOTCONNECTED) {
+    const UA_StatusCode result = UA_Client_runAsync(m_uaclient, 0);
+
+    // All notifications received in this iteration are delivered to the client thread in one batch
+    flushAttributeUpdates();
+
+    if (result == UA_STATUSCODE_BADSERVERNOTCONNECTED) {
         qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Unable to send publish request";
         m_sendPublishRequests = false;
         cleanupSubscriptions();
+        abortAsyncRequests(result);
+        return;
+    }
+
+    schedulePoll();
+}
+
+static void asyncServiceCallback(UA_Client *client, void *userdata, UA_UInt32 requestId, void *response)
+{
+    Q_UNUSED(client);
+    static_cast<Open62541AsyncBackend *>(userdata)->handleAsyncResponse(requestId, response);
+}
+
+static int qt_statisticsService(const UA_DataType *requestType)
+{
+    if (requestType == &UA_TYPES[UA_TYPES_READREQUEST])
+        return static_cast<int>(QOpcUaClientStatistics::Service::Read);
+    if (requestType == &UA_TYPES[UA_TYPES_WRITEREQUEST])
+        return static_cast<int>(QOpcUaClientStatistics::Service::Write);
+    if (requestType == &UA_TYPES[UA_TYPES_BROWSEREQUEST] || requestType == &UA_TYPES[UA_TYPES_BROWSENEXTREQUEST])
+        return static_cast<int>(QOpcUaClientStatistics::Service::Browse);
+    if (requestType == &UA_TYPES[UA_TYPES_CALLREQUEST])
+        return static_cast<int>(QOpcUaClientStatistics::Service::Call);
+    return -1;
+}
+
+void Open62541AsyncBackend::sendAsyncRequest(void *request, const UA_DataType *requestType, const UA_DataType *responseType,
+                                             const AsyncCallback &callback)
+{
+    // The request is moved to the heap because it might have to wait for a free slot in the pipeline
+    AsyncRequest asyncRequest;
+    asyncRequest.request = UA_new(requestType);
+    memcpy(asyncRequest.request, request, requestType->memSize);
+    UA_init(request, requestType);
+    asyncRequest.requestType = requestType;
+    asyncRequest.responseType = responseType;
+    asyncRequest.callback = callback;
+
+    // The latency includes the time the request waits for a free slot in the pipeline
+    asyncRequest.service = qt_statisticsService(requestType);
+    if (asyncRequest.service >= 0) {
+        const auto service = static_cast<QOpcUaClientStatistics::Service>(asyncRequest.service);
+        statistics().requestStarted(service);
+        asyncRequest.timer.start();
+        if (QOpcUaTracer::isEnabled()) {
+            asyncRequest.traceId = QOpcUaTracer::nextId();
+            QOpcUaTracer::asyncBegin(QOpcUaStatisticsCollector::serviceName(service), "service", asyncRequest.traceId);
+        }
+    }
+
+    m_queuedRequests.enqueue(asyncRequest);
+    dispatchQueuedRequests();
+}
+
+void Open62541AsyncBackend::dispatchQueuedRequests()
+{
+    while (!m_queuedRequests.isEmpty() && m_pendingRequests.size() < m_maxPendingRequests) {
+        AsyncRequest asyncRequest = m_queuedRequests.dequeue();
+
+        UA_UInt32 requestId = 0;
+        UA_StatusCode ret = UA_STATUSCODE_BADSERVERNOTCONNECTED;
+        if (m_uaclient)
+            ret = __UA_Client_AsyncService(m_uaclient, asyncRequest.request, asyncRequest.requestType,
+                                           &asyncServiceCallback, asyncRequest.responseType, this, &requestId);
+
+        // The request has been encoded and sent, only the callback is needed to handle the response
+        UA_delete(asyncRequest.request, asyncRequest.requestType);
+        asyncRequest.request = nullptr;
+
+        if (ret != UA_STATUSCODE_GOOD) {
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not send request:" << UA_StatusCode_name(ret);
+            failAsyncRequest(asyncRequest, ret);
+            continue;
+        }
+
+        m_pendingRequests.insert(requestId, asyncRequest);
+    }
+
+    // Responses are only processed in UA_Client_runAsync()
+    if (!m_pendingRequests.isEmpty())
+        schedulePoll();
+}
+
+void Open62541AsyncBackend::handleAsyncResponse(UA_UInt32 requestId, void *response)
+{
+    const AsyncRequest asyncRequest = m_pendingRequests.take(requestId);
+    if (!asyncRequest.callback) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Received response for unknown request" << requestId;
+        return;
+    }
+
+    recordAsyncRequestFinished(asyncRequest);
+    asyncRequest.callback(response);
+    dispatchQueuedRequests();
+}
+
+void Open62541AsyncBackend::failAsyncRequest(AsyncRequest &request, UA_StatusCode statusCode)
+{
+    if (request.request) {
+        UA_delete(request.request, request.requestType);
+        request.request = nullptr;
+    }
+
+    recordAsyncRequestFinished(request);
+
+    // Every response type starts with the response header, the callback gets an empty response with the error code
+    void *response = UA_new(request.responseType);
+    static_cast<UA_ResponseHeader *>(response)->serviceResult = statusCode;
+    request.callback(response);
+    UA_delete(response, request.responseType);
+}
+
+void Open62541AsyncBackend::recordAsyncRequestFinished(const AsyncRequest &request)
+{
+    if (request.service < 0)
         return;
+
+    const auto service = static_cast<QOpcUaClientStatistics::Service>(request.service);
+    statistics().requestFinished(service, request.timer.nsecsElapsed());
+    if (request.traceId)
+        QOpcUaTracer::asyncEnd(QOpcUaStatisticsCollector::serviceName(service), "service", request.traceId);
+}
+
+void Open62541AsyncBackend::abortAsyncRequests(UA_StatusCode statusCode)
+{
+    // Requests sent by the callbacks are queued and aborted in the next iteration
+    while (!m_pendingRequests.isEmpty() || !m_queuedRequests.isEmpty()) {
+        QVector<AsyncRequest> requests;
+        requests.reserve(m_pendingRequests.size() + m_queuedRequests.size());
+        for (const AsyncRequest &request : qAsConst(m_pendingRequests))
+            requests.push_back(request);
+        m_pendingRequests.clear();
+        while (!m_queuedRequests.isEmpty())
+            requests.push_back(m_queuedRequests.dequeue());
+
+        for (AsyncRequest &request : requests)
+            failAsyncRequest(request, statusCode);
     }
+}
 
-    m_subscriptionTimer.start(0);
+void Open62541AsyncBackend::queueAttributeUpdate(quint64 handle, const QOpcUaReadResult &value)
+{
+    if (!passesClientSideFilter(handle, value))
+        return;
+
+    QOpcUaAttributeUpdate update;
+    update.handle = handle;
+    update.value = value;
+    m_pendingAttributeUpdates.push_back(update);
+    recordHistory(handle, value);
+}
+
+void Open62541AsyncBackend::flushAttributeUpdates()
+{
+    if (m_pendingAttributeUpdates.isEmpty())
+        return;
+
+    // The publish requests are handled by open62541, only the responses with data changes are counted
+    statistics().requestCompleted(QOpcUaClientStatistics::Service::Publish);
+    emit attributesUpdated(m_pendingAttributeUpdates);
+    m_pendingAttributeUpdates.clear();
+}
+
+int Open62541AsyncBackend::pollInterval() const
+{
+    // Publish responses can't arrive more often than the shortest publishing interval, the server sends
+    // keep-alive messages even less often. An idle subscription only wakes the thread once per interval.
+    double shortestInterval = std::numeric_limits<int>::max();
+    for (const QOpen62541Subscription *sub : qAsConst(m_subscriptions))
+        shortestInterval = qMin(shortestInterval, sub->interval());
+
+    // Each poll picks up all responses which have arrived since the previous one and refills the pipeline.
+    // A shorter interval would mostly wake the thread for nothing, and the thread may serve other backends.
+    static const double requestPollInterval = 10;
+    if (!m_pendingRequests.isEmpty() || !m_queuedRequests.isEmpty())
+        shortestInterval = qMin(shortestInterval, requestPollInterval);
+
+    return static_cast<int>(qBound(1.0, shortestInterval, double(std::numeric_limits<int>::max())));
+}
+
+void Open62541AsyncBackend::schedulePoll()
+{
+    // A poll which is due earlier than the new interval is kept, a new request brings
+    // a poll scheduled for an idle subscription forward
+    const int interval = pollInterval();
+    if (m_subscriptionTimer.isActive() && m_subscriptionTimer.remainingTime() <= interval)
+        return;
+
+    m_subscriptionTimer.start(interval);
 }
 
 void Open62541AsyncBackend::modifyPublishRequests()
 {
     if (m_subscriptions.count() == 0) {
-        m_subscriptionTimer.stop();
+        if (m_pendingRequests.isEmpty())
+            m_subscriptionTimer.stop();
         m_sendPublishRequests = false;
+        m_pendingAttributeUpdates.clear(); // There are no monitored items left to deliver them to
         return;
     }
 
@@ -526,31 +1486,18 @@ void Open62541AsyncBackend::modifyPublishRequests()
     sendPublishRequest();
 }
 
-void Open62541AsyncBackend::handleSubscriptionTimeout(QOpen62541Subscription *sub, QVector<QPair<uintptr_t, QOpcUa::NodeAttribute>> items)
+void Open62541AsyncBackend::handleSubscriptionTimeout(QOpen62541Subscription *sub, QVector<QPair<quint64, QOpcUa::NodeAttribute>> items)
 {
-    for (auto it : qAsConst(items)) {
-        auto item = m_attributeMapping.find(it.first);
-        if (item == m_attributeMapping.end())
-            continue;
-        item->remove(it.second);
-    }
+    for (auto it : qAsConst(items))
+        m_attributeMapping.remove(it.first, it.second);
     m_subscriptions.remove(sub->subscriptionId());
     delete sub;
     modifyPublishRequests();
 }
 
-QOpen62541Subscription *Open62541AsyncBackend::getSubscriptionForItem(uintptr_t handle, QOpcUa::NodeAttribute attr)
+QOpen62541Subscription *Open62541AsyncBackend::getSubscriptionForItem(quint64 handle, QOpcUa::NodeAttribute attr)
 {
-    auto nodeEntry = m_attributeMapping.find(handle);
-    if (nodeEntry == m_attributeMapping.end())
-        return nullptr;
-
-    auto subscription = nodeEntry->find(attr);
-    if (subscription == nodeEntry->end()) {
-        return nullptr;
-    }
-
-    return subscription.value();
+    return m_attributeMapping.value(handle, attr);
 }
 
 void Open62541AsyncBackend::cleanupSubscriptions()
@@ -558,6 +1505,7 @@ void Open62541AsyncBackend::cleanupSubscriptions()
     qDeleteAll(m_subscriptions);
     m_subscriptions.clear();
     m_attributeMapping.clear();
+    m_pendingAttributeUpdates.clear();
     m_minPublishingInterval = 0;
 }
 
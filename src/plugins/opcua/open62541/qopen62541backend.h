@@ -37,11 +37,17 @@
 #include "qopen62541client.h"
 #include "qopen62541subscription.h"
 #include <private/qopcuabackend_p.h>
+#include <private/qopcuahandletable_p.h>
 
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qqueue.h>
 #include <QtCore/qset.h>
+#include <QtCore/qsharedpointer.h>
 #include <QtCore/qstring.h>
 #include <QtCore/qtimer.h>
 
+#include <functional>
+
 QT_BEGIN_NAMESPACE
 
 class Open62541AsyncBackend : public QOpcUaBackend
@@ -56,41 +62,119 @@ public Q_SLOTS:
     void disconnectFromEndpoint();
 
     // Node functions
-    void browseChildren(uintptr_t handle, UA_NodeId id, QOpcUa::ReferenceTypeId referenceType, QOpcUa::NodeClasses nodeClassMask);
-    void readAttributes(uintptr_t handle, UA_NodeId id, QOpcUa::NodeAttributes attr, QString indexRange);
-
-    void writeAttribute(uintptr_t handle, UA_NodeId id, QOpcUa::NodeAttribute attrId, QVariant value, QOpcUa::Types type, QString indexRange);
-    void writeAttributes(uintptr_t handle, UA_NodeId id, QOpcUaNode::AttributeMap toWrite, QOpcUa::Types valueAttributeType);
-    void enableMonitoring(uintptr_t handle, UA_NodeId id, QOpcUa::NodeAttributes attr, const QOpcUaMonitoringParameters &settings);
-    void disableMonitoring(uintptr_t handle, QOpcUa::NodeAttributes attr);
-    void modifyMonitoring(uintptr_t handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value);
-    void callMethod(uintptr_t handle, UA_NodeId objectId, UA_NodeId methodId, QVector<QOpcUa::TypedVariant> args);
+    void browseChildren(quint64 handle, UA_NodeId id, QOpcUa::ReferenceTypeId referenceType, QOpcUa::NodeClasses nodeClassMask);
+    void browseRecursive(QString rootNodeId, QOpcUa::ReferenceTypeId referenceType, QOpcUa::NodeClasses nodeClassMask, int maxDepth);
+    void readAttributes(quint64 handle, UA_NodeId id, QOpcUa::NodeAttributes attr, QString indexRange);
+    void readNodeAttributes(QVector<QOpcUaReadItem> nodesToRead);
+    void readNodeAttributesPart(quint64 batchId, QVector<QOpcUaReadItem> nodesToRead);
+
+    void writeAttribute(quint64 handle, UA_NodeId id, QOpcUa::NodeAttribute attrId, QVariant value, QOpcUa::Types type, QString indexRange);
+    void writeAttributes(quint64 handle, UA_NodeId id, QOpcUaNode::AttributeMap toWrite, QOpcUa::Types valueAttributeType);
+    void writeNodeAttributes(QVector<QOpcUaWriteItem> nodesToWrite);
+    void writeNodeAttributesPart(quint64 batchId, QVector<QOpcUaWriteItem> nodesToWrite);
+    void writeCoalesced(QVector<QOpcUaCoalescedWrite> writes);
+    void enableMonitoring(quint64 handle, UA_NodeId id, QOpcUa::NodeAttributes attr, const QOpcUaMonitoringParameters &settings);
+    void disableMonitoring(quint64 handle, QOpcUa::NodeAttributes attr);
+    void enableMonitoringForNodes(QVector<QOpcUaNodeHandle> nodes, QOpcUa::NodeAttributes attr, QOpcUaMonitoringParameters settings);
+    void disableMonitoringForNodes(QVector<QOpcUaNodeHandle> nodes, QOpcUa::NodeAttributes attr);
+    void modifyMonitoring(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value);
+    void callMethod(quint64 handle, UA_NodeId objectId, UA_NodeId methodId, QVector<QOpcUa::TypedVariant> args);
+    void registerNodes(QVector<QOpcUaNodeHandle> nodes);
+    void unregisterNodes(QVector<QOpcUaNodeHandle> nodes);
+
+    void setMaxPendingRequests(int count);
 
     // Subscription
     QOpen62541Subscription *getSubscription(const QOpcUaMonitoringParameters &settings);
     bool removeSubscription(UA_UInt32 subscriptionId);
     void sendPublishRequest();
     void modifyPublishRequests();
-    void handleSubscriptionTimeout(QOpen62541Subscription *sub, QVector<QPair<uintptr_t, QOpcUa::NodeAttribute>> items);
+    void handleSubscriptionTimeout(QOpen62541Subscription *sub, QVector<QPair<quint64, QOpcUa::NodeAttribute>> items);
     void cleanupSubscriptions();
 
+Q_SIGNALS:
+    // Results of a part of a batch request which has been split across several sessions
+    void readNodeAttributesPartFinished(quint64 batchId, QVector<QOpcUaReadItemResult> results, QOpcUa::UaStatusCode serviceResult);
+    void writeNodeAttributesPartFinished(quint64 batchId, QVector<QOpcUaWriteItemResult> results, QOpcUa::UaStatusCode serviceResult);
+
 public:
+    void queueAttributeUpdate(quint64 handle, const QOpcUaReadResult &value);
+    void handleAsyncResponse(UA_UInt32 requestId, void *response);
+
     UA_Client *m_uaclient;
     QOpen62541Client *m_clientImpl;
     bool m_useStateCallback;
 
 private:
-    QOpen62541Subscription *getSubscriptionForItem(uintptr_t handle, QOpcUa::NodeAttribute attr);
-
+    // Called with the response of an asynchronous service request. The response is owned by open62541.
+    typedef std::function<void(void *response)> AsyncCallback;
+
+    struct AsyncRequest
+    {
+        AsyncRequest() : request(nullptr), requestType(nullptr), responseType(nullptr), service(-1), traceId(0) {}
+        void *request;
+        const UA_DataType *requestType;
+        const UA_DataType *responseType;
+        AsyncCallback callback;
+        int service; // QOpcUaClientStatistics::Service or -1 for services without statistics
+        QElapsedTimer timer; // Started when the request is queued
+        quint64 traceId; // Links the begin and end events of the request if tracing is enabled
+    };
+
+    struct ReadChunkState;
+    struct WriteChunkState;
+    struct BrowseRecursiveState;
+    typedef QPair<QString, int> BrowseTarget; // Node id and depth below the root node
+
+    void sendAsyncRequest(void *request, const UA_DataType *requestType, const UA_DataType *responseType,
+                          const AsyncCallback &callback);
+    void dispatchQueuedRequests();
+    void failAsyncRequest(AsyncRequest &request, UA_StatusCode statusCode);
+    void recordAsyncRequestFinished(const AsyncRequest &request);
+    void abortAsyncRequests(UA_StatusCode statusCode);
+    void handleBrowseResult(quint64 handle, UA_StatusCode serviceResult, size_t resultsSize, const UA_BrowseResult *results,
+                            QVector<QOpcUaReferenceDescription> references);
+    void sendReadChunk(const QSharedPointer<ReadChunkState> &state, int offset, int size);
+    void finishReadChunk(const QSharedPointer<ReadChunkState> &state);
+    void sendWriteRequest(const QSharedPointer<WriteChunkState> &state);
+    void sendWriteChunk(const QSharedPointer<WriteChunkState> &state, int offset, int size);
+    void finishWriteChunk(const QSharedPointer<WriteChunkState> &state);
+    void sendRecursiveBrowseRequests(const QSharedPointer<BrowseRecursiveState> &state);
+    void handleRecursiveBrowseResults(const QSharedPointer<BrowseRecursiveState> &state, const QVector<BrowseTarget> &targets,
+                                      UA_StatusCode serviceResult, size_t resultsSize, const UA_BrowseResult *results);
+    void abortRecursiveBrowse(const QSharedPointer<BrowseRecursiveState> &state, UA_StatusCode statusCode);
+    void releaseContinuationPoints(const QVector<QByteArray> &continuationPoints, UA_StatusCode reason);
+
+    QOpen62541Subscription *getSubscriptionForItem(quint64 handle, QOpcUa::NodeAttribute attr);
+    UA_NodeId requestNodeId(const QString &nodeId) const;
+    int pollInterval() const;
+    void schedulePoll();
+    void flushAttributeUpdates();
+
+    // Polls UA_Client_runAsync() while there are subscriptions or pending asynchronous requests
     QTimer m_subscriptionTimer;
 
     QHash<quint32, QOpen62541Subscription *> m_subscriptions;
 
-    QHash<uintptr_t, QHash<QOpcUa::NodeAttribute, QOpen62541Subscription *>> m_attributeMapping; // Handle -> Attribute -> Subscription
+    QOpcUaAttributeMap<QOpen62541Subscription *> m_attributeMapping; // Handle -> Attribute -> Subscription
 
     bool m_sendPublishRequests;
 
     double m_minPublishingInterval;
+
+    int m_maxNodesPerRead;
+    int m_maxNodesPerWrite;
+    int m_maxMonitoredItemsPerRequest;
+    int m_maxNodesPerBrowse;
+
+    int m_maxPendingRequests;
+    QHash<UA_UInt32, AsyncRequest> m_pendingRequests; // Request id -> request waiting for its response
+    QQueue<AsyncRequest> m_queuedRequests; // Requests waiting for a free slot in the pipeline
+
+    QVector<QOpcUaAttributeUpdate> m_pendingAttributeUpdates;
+
+    QHash<quint64, QString> m_registeredNodeIds; // Handle -> node id returned by RegisterNodes
+    QHash<QString, QVector<quint64>> m_registeredHandles; // Node id -> handles of the registered nodes
 };
 
 QT_END_NAMESPACE
@@ -40,40 +40,80 @@
 #include "qopen62541subscription.h"
 #include "qopen62541utils.h"
 #include "qopen62541valueconverter.h"
+#include <private/qopcuabackendthreadpool_p.h>
 #include <private/qopcuaclient_p.h>
 
 #include <QtCore/qstringlist.h>
 #include <QtCore/qthread.h>
 #include <QtCore/qurl.h>
 
+#include <algorithm>
+
 QT_BEGIN_NAMESPACE
 
-QOpen62541Client::QOpen62541Client()
+QOpen62541Client::QOpen62541Client(int sessionCount)
     : QOpcUaClientImpl()
-    , m_backend(new Open62541AsyncBackend(this))
+    , m_state(QOpcUaClient::Disconnected)
+    , m_sessionError(QOpcUaClient::NoError)
+    , m_nextBatchId(0)
 {
-    m_thread = new QThread();
-    connectBackendWithClient(m_backend);
-    m_backend->moveToThread(m_thread);
-    connect(m_thread, &QThread::finished, m_thread, &QObject::deleteLater);
-    connect(m_thread, &QThread::finished, m_backend, &QObject::deleteLater);
-    m_thread->start();
+    sessionCount = qMax(1, sessionCount);
+
+    for (int i = 0; i < sessionCount; ++i) {
+        Open62541AsyncBackend *backend = new Open62541AsyncBackend(this);
+        // Responses and notifications are polled without blocking, only connecting and subscription
+        // management wait for the server. The thread can serve the backends of other clients.
+        QThread *thread = QOpcUaBackendThreadPool::instance()->acquireThread(QOpcUaBackendThreadPool::ThreadType::Shared);
+        // The sessions report their state to the aggregation below instead of the client
+        connectBackendWithClient(backend, sessionCount > 1 ? BackendState::Ignore : BackendState::Forward);
+
+        if (sessionCount > 1) {
+            connect(backend, &QOpcUaBackend::stateAndOrErrorChanged, this,
+                    [this, i](QOpcUaClient::ClientState state, QOpcUaClient::ClientError error) {
+                handleSessionStateChanged(i, state, error);
+            });
+            connect(backend, &Open62541AsyncBackend::readNodeAttributesPartFinished, this,
+                    [this, i](quint64 batchId, QVector<QOpcUaReadItemResult> results, QOpcUa::UaStatusCode serviceResult) {
+                handleReadPartFinished(i, batchId, results, serviceResult);
+            });
+            connect(backend, &Open62541AsyncBackend::writeNodeAttributesPartFinished, this,
+                    [this, i](quint64 batchId, QVector<QOpcUaWriteItemResult> results, QOpcUa::UaStatusCode serviceResult) {
+                handleWritePartFinished(i, batchId, results, serviceResult);
+            });
+        }
+
+        backend->moveToThread(thread);
+
+        m_threads.append(thread);
+        m_backends.append(backend);
+    }
+
+    m_sessionStates.fill(QOpcUaClient::Disconnected, sessionCount);
 }
 
 QOpen62541Client::~QOpen62541Client()
 {
-    if (m_thread->isRunning())
-        m_thread->quit();
+    // The backends are deleted in their thread, which may be shared with other clients
+    for (int i = 0; i < m_backends.size(); ++i) {
+        m_backends.at(i)->deleteLater();
+        QOpcUaBackendThreadPool::instance()->releaseThread(m_threads.at(i));
+    }
 }
 
 void QOpen62541Client::connectToEndpoint(const QUrl &url)
 {
-    QMetaObject::invokeMethod(m_backend, "connectToEndpoint", Qt::QueuedConnection, Q_ARG(QUrl, url));
+    m_state = QOpcUaClient::Connecting;
+    m_sessionError = QOpcUaClient::NoError;
+    m_sessionStates.fill(QOpcUaClient::Connecting);
+
+    for (Open62541AsyncBackend *backend : qAsConst(m_backends))
+        QMetaObject::invokeMethod(backend, "connectToEndpoint", Qt::QueuedConnection, Q_ARG(QUrl, url));
 }
 
 void QOpen62541Client::disconnectFromEndpoint()
 {
-    QMetaObject::invokeMethod(m_backend, "disconnectFromEndpoint", Qt::QueuedConnection);
+    for (Open62541AsyncBackend *backend : qAsConst(m_backends))
+        QMetaObject::invokeMethod(backend, "disconnectFromEndpoint", Qt::QueuedConnection);
 }
 
 QOpcUaNode *QOpen62541Client::node(const QString &nodeId)
@@ -85,9 +125,321 @@ QOpcUaNode *QOpen62541Client::node(const QString &nodeId)
     return new QOpcUaNode(new QOpen62541Node(uaNodeId, this, nodeId), m_client);
 }
 
+QOpcUaNode *QOpen62541Client::node(const QOpcUaNodeId &nodeId)
+{
+    UA_NodeId uaNodeId = Open62541Utils::nodeIdFromQOpcUaNodeId(nodeId);
+    if (UA_NodeId_isNull(&uaNodeId))
+        return nullptr;
+
+    // The string representation is created on demand by QOpen62541Node::nodeId()
+    return new QOpcUaNode(new QOpen62541Node(uaNodeId, this, QString()), m_client);
+}
+
 QString QOpen62541Client::backend() const
 {
     return QStringLiteral("open62541");
 }
 
+bool QOpen62541Client::readNodeAttributes(const QVector<QOpcUaReadItem> &nodesToRead)
+{
+    const int sessionCount = m_backends.size();
+
+    ReadBatch batch;
+    batch.indices.resize(sessionCount);
+    QVector<QVector<QOpcUaReadItem>> parts(sessionCount);
+    int resultCount = 0;
+
+    if (sessionCount > 1) {
+        for (const QOpcUaReadItem &item : nodesToRead) {
+            const int session = sessionForNode(item.nodeId());
+            parts[session].append(item);
+            qt_forEachAttribute(item.attributes(), [&](QOpcUa::NodeAttribute) {
+                batch.indices[session].append(resultCount++);
+            });
+        }
+    }
+
+    // Requests which touch a single session are sent unchanged
+    const int usedSessions = std::count_if(parts.constBegin(), parts.constEnd(),
+                                           [](const QVector<QOpcUaReadItem> &part) { return !part.isEmpty(); });
+    if (usedSessions < 2) {
+        const int session = nodesToRead.isEmpty() ? 0 : sessionForNode(nodesToRead.first().nodeId());
+        return QMetaObject::invokeMethod(m_backends.at(session), "readNodeAttributes", Qt::QueuedConnection,
+                                         Q_ARG(QVector<QOpcUaReadItem>, nodesToRead));
+    }
+
+    const quint64 batchId = ++m_nextBatchId;
+    batch.results.resize(resultCount);
+    batch.pendingParts = usedSessions;
+    batch.serviceResult = QOpcUa::UaStatusCode::Good;
+    m_readBatches.insert(batchId, batch);
+
+    bool success = true;
+    for (int i = 0; i < sessionCount; ++i) {
+        if (parts.at(i).isEmpty())
+            continue;
+        success &= QMetaObject::invokeMethod(m_backends.at(i), "readNodeAttributesPart", Qt::QueuedConnection,
+                                             Q_ARG(quint64, batchId),
+                                             Q_ARG(QVector<QOpcUaReadItem>, parts.at(i)));
+    }
+    return success;
+}
+
+bool QOpen62541Client::writeNodeAttributes(const QVector<QOpcUaWriteItem> &nodesToWrite)
+{
+    const int sessionCount = m_backends.size();
+
+    WriteBatch batch;
+    batch.indices.resize(sessionCount);
+    QVector<QVector<QOpcUaWriteItem>> parts(sessionCount);
+
+    if (sessionCount > 1) {
+        for (int i = 0; i < nodesToWrite.size(); ++i) {
+            const int session = sessionForNode(nodesToWrite.at(i).nodeId());
+            parts[session].append(nodesToWrite.at(i));
+            batch.indices[session].append(i);
+        }
+    }
+
+    // Requests which touch a single session are sent unchanged
+    const int usedSessions = std::count_if(parts.constBegin(), parts.constEnd(),
+                                           [](const QVector<QOpcUaWriteItem> &part) { return !part.isEmpty(); });
+    if (usedSessions < 2) {
+        const int session = nodesToWrite.isEmpty() ? 0 : sessionForNode(nodesToWrite.first().nodeId());
+        return QMetaObject::invokeMethod(m_backends.at(session), "writeNodeAttributes", Qt::QueuedConnection,
+                                         Q_ARG(QVector<QOpcUaWriteItem>, nodesToWrite));
+    }
+
+    const quint64 batchId = ++m_nextBatchId;
+    batch.nodesToWrite = nodesToWrite;
+    batch.results.resize(nodesToWrite.size());
+    batch.pendingParts = usedSessions;
+    batch.serviceResult = QOpcUa::UaStatusCode::Good;
+    m_writeBatches.insert(batchId, batch);
+
+    bool success = true;
+    for (int i = 0; i < sessionCount; ++i) {
+        if (parts.at(i).isEmpty())
+            continue;
+        success &= QMetaObject::invokeMethod(m_backends.at(i), "writeNodeAttributesPart", Qt::QueuedConnection,
+                                             Q_ARG(quint64, batchId),
+                                             Q_ARG(QVector<QOpcUaWriteItem>, parts.at(i)));
+    }
+    return success;
+}
+
+// Sends one write request per session for all coalesced writes of the window
+bool QOpen62541Client::writeCoalesced(const QVector<QOpcUaCoalescedWrite> &writes)
+{
+    QVector<QVector<QOpcUaCoalescedWrite>> parts(m_backends.size());
+    for (const QOpcUaCoalescedWrite &write : writes)
+        parts[sessionForNode(write.item.nodeId())].append(write);
+
+    bool success = true;
+    for (int i = 0; i < parts.size(); ++i) {
+        if (parts.at(i).isEmpty())
+            continue;
+        success &= QMetaObject::invokeMethod(m_backends.at(i), "writeCoalesced", Qt::QueuedConnection,
+                                             Q_ARG(QVector<QOpcUaCoalescedWrite>, parts.at(i)));
+    }
+    return success;
+}
+
+bool QOpen62541Client::enableMonitoring(const QVector<QOpcUaNodeHandle> &nodes, QOpcUa::NodeAttributes attr,
+                                        const QOpcUaMonitoringParameters &settings)
+{
+    const QVector<QVector<QOpcUaNodeHandle>> parts = nodesBySession(nodes);
+
+    bool success = true;
+    for (int i = 0; i < parts.size(); ++i) {
+        if (parts.at(i).isEmpty())
+            continue;
+        success &= QMetaObject::invokeMethod(m_backends.at(i), "enableMonitoringForNodes", Qt::QueuedConnection,
+                                             Q_ARG(QVector<QOpcUaNodeHandle>, parts.at(i)),
+                                             Q_ARG(QOpcUa::NodeAttributes, attr),
+                                             Q_ARG(QOpcUaMonitoringParameters, settings));
+    }
+    return success;
+}
+
+bool QOpen62541Client::disableMonitoring(const QVector<QOpcUaNodeHandle> &nodes, QOpcUa::NodeAttributes attr)
+{
+    const QVector<QVector<QOpcUaNodeHandle>> parts = nodesBySession(nodes);
+
+    bool success = true;
+    for (int i = 0; i < parts.size(); ++i) {
+        if (parts.at(i).isEmpty())
+            continue;
+        success &= QMetaObject::invokeMethod(m_backends.at(i), "disableMonitoringForNodes", Qt::QueuedConnection,
+                                             Q_ARG(QVector<QOpcUaNodeHandle>, parts.at(i)),
+                                             Q_ARG(QOpcUa::NodeAttributes, attr));
+    }
+    return success;
+}
+
+bool QOpen62541Client::registerNodes(const QVector<QOpcUaNodeHandle> &nodes)
+{
+    // One RegisterNodes request per session
+    const QVector<QVector<QOpcUaNodeHandle>> parts = nodesBySession(nodes);
+
+    bool success = true;
+    for (int i = 0; i < parts.size(); ++i) {
+        if (parts.at(i).isEmpty())
+            continue;
+        success &= QMetaObject::invokeMethod(m_backends.at(i), "registerNodes", Qt::QueuedConnection,
+                                             Q_ARG(QVector<QOpcUaNodeHandle>, parts.at(i)));
+    }
+    return success;
+}
+
+bool QOpen62541Client::unregisterNodes(const QVector<QOpcUaNodeHandle> &nodes)
+{
+    // Requests sent from now on must not use the registered ids anymore
+    for (const QOpcUaNodeHandle &node : nodes) {
+        QOpen62541Node *impl = static_cast<QOpen62541Node *>(nodeForHandle(node.handle));
+        if (impl)
+            impl->clearRegisteredNodeId();
+    }
+
+    const QVector<QVector<QOpcUaNodeHandle>> parts = nodesBySession(nodes);
+
+    bool success = true;
+    for (int i = 0; i < parts.size(); ++i) {
+        if (parts.at(i).isEmpty())
+            continue;
+        success &= QMetaObject::invokeMethod(m_backends.at(i), "unregisterNodes", Qt::QueuedConnection,
+                                             Q_ARG(QVector<QOpcUaNodeHandle>, parts.at(i)));
+    }
+    return success;
+}
+
+bool QOpen62541Client::setTypedArraysEnabled(bool enabled)
+{
+    bool success = true;
+    for (Open62541AsyncBackend *backend : qAsConst(m_backends))
+        success &= QMetaObject::invokeMethod(backend, "setTypedArraysEnabled", Qt::QueuedConnection,
+                                             Q_ARG(bool, enabled));
+    return success;
+}
+
+bool QOpen62541Client::setMaxPendingRequests(int count)
+{
+    // The limit applies to each session
+    bool success = true;
+    for (Open62541AsyncBackend *backend : qAsConst(m_backends))
+        success &= QMetaObject::invokeMethod(backend, "setMaxPendingRequests", Qt::QueuedConnection,
+                                             Q_ARG(int, count));
+    return success;
+}
+
+bool QOpen62541Client::browseRecursive(const QString &rootNodeId, QOpcUa::ReferenceTypeId referenceType,
+                                       QOpcUa::NodeClasses nodeClassMask, int maxDepth)
+{
+    // The whole crawl runs on the session of the root node
+    return QMetaObject::invokeMethod(m_backends.at(sessionForNode(rootNodeId)), "browseRecursive", Qt::QueuedConnection,
+                                     Q_ARG(QString, rootNodeId),
+                                     Q_ARG(QOpcUa::ReferenceTypeId, referenceType),
+                                     Q_ARG(QOpcUa::NodeClasses, nodeClassMask),
+                                     Q_ARG(int, maxDepth));
+}
+
+int QOpen62541Client::sessionForNode(const UA_NodeId &nodeId) const
+{
+    if (m_backends.size() == 1)
+        return 0;
+    return qHash(Open62541Utils::nodeIdToQOpcUaNodeId(nodeId)) % m_backends.size();
+}
+
+int QOpen62541Client::sessionForNode(const QString &nodeId) const
+{
+    // Must match the session of the UA_NodeId overload for the same node
+    if (m_backends.size() == 1)
+        return 0;
+    return qHash(QOpcUaNodeId::fromString(nodeId)) % m_backends.size();
+}
+
+QVector<QVector<QOpcUaNodeHandle>> QOpen62541Client::nodesBySession(const QVector<QOpcUaNodeHandle> &nodes) const
+{
+    QVector<QVector<QOpcUaNodeHandle>> parts(m_backends.size());
+    if (m_backends.size() == 1) {
+        parts[0] = nodes;
+        return parts;
+    }
+
+    for (const QOpcUaNodeHandle &node : nodes)
+        parts[sessionForNode(node.nodeId)].append(node);
+    return parts;
+}
+
+void QOpen62541Client::handleSessionStateChanged(int session, QOpcUaClient::ClientState state, QOpcUaClient::ClientError error)
+{
+    m_sessionStates[session] = state;
+    if (error != QOpcUaClient::NoError && m_sessionError == QOpcUaClient::NoError)
+        m_sessionError = error;
+
+    // The client is only usable with all sessions, a failed session takes down the others
+    if (state == QOpcUaClient::Disconnected && error != QOpcUaClient::NoError) {
+        for (int i = 0; i < m_backends.size(); ++i) {
+            if (m_sessionStates.at(i) != QOpcUaClient::Disconnected)
+                QMetaObject::invokeMethod(m_backends.at(i), "disconnectFromEndpoint", Qt::QueuedConnection);
+        }
+    }
+
+    if (m_sessionStates.count(QOpcUaClient::Connected) == m_sessionStates.size()) {
+        if (m_state != QOpcUaClient::Connected) {
+            m_state = QOpcUaClient::Connected;
+            emit stateAndOrErrorChanged(QOpcUaClient::Connected, QOpcUaClient::NoError);
+        }
+    } else if (m_sessionStates.count(QOpcUaClient::Disconnected) == m_sessionStates.size()) {
+        if (m_state != QOpcUaClient::Disconnected) {
+            const QOpcUaClient::ClientError sessionError = m_sessionError;
+            m_state = QOpcUaClient::Disconnected;
+            m_sessionError = QOpcUaClient::NoError;
+            emit stateAndOrErrorChanged(QOpcUaClient::Disconnected, sessionError);
+        }
+    }
+}
+
+void QOpen62541Client::handleReadPartFinished(int session, quint64 batchId, const QVector<QOpcUaReadItemResult> &results,
+                                              QOpcUa::UaStatusCode serviceResult)
+{
+    auto it = m_readBatches.find(batchId);
+    if (it == m_readBatches.end())
+        return;
+
+    const QVector<int> &indices = it->indices.at(session);
+    for (int i = 0; i < qMin(results.size(), indices.size()); ++i)
+        it->results[indices.at(i)] = results.at(i);
+
+    if (it->serviceResult == QOpcUa::UaStatusCode::Good)
+        it->serviceResult = serviceResult;
+
+    if (--it->pendingParts == 0) {
+        const ReadBatch batch = *it;
+        m_readBatches.erase(it);
+        emit readNodeAttributesFinished(batch.results, batch.serviceResult);
+    }
+}
+
+void QOpen62541Client::handleWritePartFinished(int session, quint64 batchId, const QVector<QOpcUaWriteItemResult> &results,
+                                               QOpcUa::UaStatusCode serviceResult)
+{
+    auto it = m_writeBatches.find(batchId);
+    if (it == m_writeBatches.end())
+        return;
+
+    const QVector<int> &indices = it->indices.at(session);
+    for (int i = 0; i < qMin(results.size(), indices.size()); ++i)
+        it->results[indices.at(i)] = results.at(i);
+
+    if (it->serviceResult == QOpcUa::UaStatusCode::Good)
+        it->serviceResult = serviceResult;
+
+    if (--it->pendingParts == 0) {
+        const WriteBatch batch = *it;
+        m_writeBatches.erase(it);
+        handleWriteNodeAttributesFinished(batch.nodesToWrite, batch.results, batch.serviceResult);
+    }
+}
+
 QT_END_NAMESPACE
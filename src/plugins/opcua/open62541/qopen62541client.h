@@ -40,7 +40,9 @@
 #include "qopen62541.h"
 #include <private/qopcuaclientimpl_p.h>
 
+#include <QtCore/qhash.h>
 #include <QtCore/qtimer.h>
+#include <QtCore/qvector.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -51,22 +53,70 @@ class QOpen62541Client : public QOpcUaClientImpl
     Q_OBJECT
 
 public:
-    explicit QOpen62541Client();
+    explicit QOpen62541Client(int sessionCount = 1);
     ~QOpen62541Client();
 
     void connectToEndpoint(const QUrl &url) override;
     void disconnectFromEndpoint() override;
 
     QOpcUaNode *node(const QString &nodeId) override;
+    QOpcUaNode *node(const QOpcUaNodeId &nodeId) override;
 
     QString backend() const override;
 
-private slots:
+    bool readNodeAttributes(const QVector<QOpcUaReadItem> &nodesToRead) override;
+    bool writeNodeAttributes(const QVector<QOpcUaWriteItem> &nodesToWrite) override;
+    bool enableMonitoring(const QVector<QOpcUaNodeHandle> &nodes, QOpcUa::NodeAttributes attr,
+                          const QOpcUaMonitoringParameters &settings) override;
+    bool disableMonitoring(const QVector<QOpcUaNodeHandle> &nodes, QOpcUa::NodeAttributes attr) override;
+    bool setTypedArraysEnabled(bool enabled) override;
+    bool setMaxPendingRequests(int count) override;
+    bool registerNodes(const QVector<QOpcUaNodeHandle> &nodes) override;
+    bool unregisterNodes(const QVector<QOpcUaNodeHandle> &nodes) override;
+    bool browseRecursive(const QString &rootNodeId, QOpcUa::ReferenceTypeId referenceType,
+                         QOpcUa::NodeClasses nodeClassMask, int maxDepth) override;
+
+protected:
+    bool writeCoalesced(const QVector<QOpcUaCoalescedWrite> &writes) override;
 
 private:
     friend class QOpen62541Node;
-    QThread *m_thread;
-    Open62541AsyncBackend *m_backend;
+
+    // A batch request which has been split into one part per session
+    struct ReadBatch {
+        QVector<QOpcUaReadItemResult> results;
+        QVector<QVector<int>> indices; // Session -> result index in the part -> result index in the batch
+        int pendingParts;
+        QOpcUa::UaStatusCode serviceResult;
+    };
+    struct WriteBatch {
+        QVector<QOpcUaWriteItem> nodesToWrite;
+        QVector<QOpcUaWriteItemResult> results;
+        QVector<QVector<int>> indices;
+        int pendingParts;
+        QOpcUa::UaStatusCode serviceResult;
+    };
+
+    int sessionForNode(const UA_NodeId &nodeId) const;
+    int sessionForNode(const QString &nodeId) const;
+    QVector<QVector<QOpcUaNodeHandle>> nodesBySession(const QVector<QOpcUaNodeHandle> &nodes) const;
+    void handleSessionStateChanged(int session, QOpcUaClient::ClientState state, QOpcUaClient::ClientError error);
+    void handleReadPartFinished(int session, quint64 batchId, const QVector<QOpcUaReadItemResult> &results,
+                                QOpcUa::UaStatusCode serviceResult);
+    void handleWritePartFinished(int session, quint64 batchId, const QVector<QOpcUaWriteItemResult> &results,
+                                 QOpcUa::UaStatusCode serviceResult);
+
+    // One backend and thread per session, nodes are assigned to a session by the hash of their node id
+    QVector<QThread *> m_threads;
+    QVector<Open62541AsyncBackend *> m_backends;
+
+    QVector<QOpcUaClient::ClientState> m_sessionStates;
+    QOpcUaClient::ClientState m_state;
+    QOpcUaClient::ClientError m_sessionError;
+
+    quint64 m_nextBatchId;
+    QHash<quint64, ReadBatch> m_readBatches;
+    QHash<quint64, WriteBatch> m_writeBatches;
 };
 
 QT_END_NAMESPACE
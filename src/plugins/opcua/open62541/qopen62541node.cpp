@@ -50,16 +50,35 @@ QOpen62541Node::QOpen62541Node(const UA_NodeId nodeId, QOpen62541Client *client,
     : m_client(client)
     , m_nodeIdString(nodeIdString)
     , m_nodeId(nodeId)
+    , m_session(client->sessionForNode(nodeId))
 {
+    UA_NodeId_init(&m_registeredNodeId);
     m_client->registerNode(this);
+
+    // Connected before QOpcUaNodePrivate, the alias is in place when the user is notified
+    connect(this, &QOpcUaNodeImpl::registerNodeFinished, this,
+            [this](const QString &registeredNodeId, QOpcUa::UaStatusCode statusCode) {
+        if (statusCode == QOpcUa::UaStatusCode::Good)
+            setRegisteredNodeId(registeredNodeId);
+    });
+    // Registered ids are only valid in the session they have been registered in
+    connect(client, &QOpcUaClientImpl::stateAndOrErrorChanged, this,
+            [this](QOpcUaClient::ClientState state, QOpcUaClient::ClientError) {
+        if (state == QOpcUaClient::Disconnected)
+            clearRegisteredNodeId();
+    });
 }
 
 QOpen62541Node::~QOpen62541Node()
 {
-    if (m_client)
+    if (m_client) {
+        if (!m_registeredNodeIdString.isEmpty())
+            unregisterNode();
         m_client->unregisterNode(this);
+    }
 
     UA_NodeId_deleteMembers(&m_nodeId);
+    UA_NodeId_deleteMembers(&m_registeredNodeId);
 }
 
 bool QOpen62541Node::readAttributes(QOpcUa::NodeAttributes attr, const QString &indexRange)
@@ -68,10 +87,10 @@ bool QOpen62541Node::readAttributes(QOpcUa::NodeAttributes attr, const QString &
         return false;
 
     UA_NodeId tempId;
-    UA_NodeId_copy(&m_nodeId, &tempId);
-    return QMetaObject::invokeMethod(m_client->m_backend, "readAttributes",
+    UA_NodeId_copy(&requestNodeId(), &tempId);
+    return QMetaObject::invokeMethod(m_client->m_backends.at(m_session), "readAttributes",
                                      Qt::QueuedConnection,
-                                     Q_ARG(uintptr_t, reinterpret_cast<uintptr_t>(this)),
+                                     Q_ARG(quint64, handle()),
                                      Q_ARG(UA_NodeId, tempId),
                                      Q_ARG(QOpcUa::NodeAttributes, attr),
                                      Q_ARG(QString, indexRange));
@@ -83,10 +102,10 @@ bool QOpen62541Node::enableMonitoring(QOpcUa::NodeAttributes attr, const QOpcUaM
         return false;
 
     UA_NodeId tempId;
-    UA_NodeId_copy(&m_nodeId, &tempId);
-    return QMetaObject::invokeMethod(m_client->m_backend, "enableMonitoring",
+    UA_NodeId_copy(&requestNodeId(), &tempId);
+    return QMetaObject::invokeMethod(m_client->m_backends.at(m_session), "enableMonitoring",
                                      Qt::QueuedConnection,
-                                     Q_ARG(uintptr_t, reinterpret_cast<uintptr_t>(this)),
+                                     Q_ARG(quint64, handle()),
                                      Q_ARG(UA_NodeId, tempId),
                                      Q_ARG(QOpcUa::NodeAttributes, attr),
                                      Q_ARG(QOpcUaMonitoringParameters, settings));
@@ -97,9 +116,9 @@ bool QOpen62541Node::disableMonitoring(QOpcUa::NodeAttributes attr)
     if (!m_client)
         return false;
 
-    return QMetaObject::invokeMethod(m_client->m_backend, "disableMonitoring",
+    return QMetaObject::invokeMethod(m_client->m_backends.at(m_session), "disableMonitoring",
                                      Qt::QueuedConnection,
-                                     Q_ARG(uintptr_t, reinterpret_cast<uintptr_t>(this)),
+                                     Q_ARG(quint64, handle()),
                                      Q_ARG(QOpcUa::NodeAttributes, attr));
 }
 
@@ -108,9 +127,9 @@ bool QOpen62541Node::modifyMonitoring(QOpcUa::NodeAttribute attr, QOpcUaMonitori
     if (!m_client)
         return false;
 
-    return QMetaObject::invokeMethod(m_client->m_backend, "modifyMonitoring",
+    return QMetaObject::invokeMethod(m_client->m_backends.at(m_session), "modifyMonitoring",
                                      Qt::QueuedConnection,
-                                     Q_ARG(uintptr_t, reinterpret_cast<uintptr_t>(this)),
+                                     Q_ARG(quint64, handle()),
                                      Q_ARG(QOpcUa::NodeAttribute, attr),
                                      Q_ARG(QOpcUaMonitoringParameters::Parameter, item),
                                      Q_ARG(QVariant, value));
@@ -118,6 +137,8 @@ bool QOpen62541Node::modifyMonitoring(QOpcUa::NodeAttribute attr, QOpcUaMonitori
 
 QString QOpen62541Node::nodeId() const
 {
+    if (m_nodeIdString.isEmpty())
+        m_nodeIdString = Open62541Utils::nodeIdToQString(m_nodeId);
     return m_nodeIdString;
 }
 
@@ -127,10 +148,10 @@ bool QOpen62541Node::browseChildren(QOpcUa::ReferenceTypeId referenceType, QOpcU
         return false;
 
     UA_NodeId tempId;
-    UA_NodeId_copy(&m_nodeId, &tempId);
-    return QMetaObject::invokeMethod(m_client->m_backend, "browseChildren",
+    UA_NodeId_copy(&requestNodeId(), &tempId);
+    return QMetaObject::invokeMethod(m_client->m_backends.at(m_session), "browseChildren",
                                      Qt::QueuedConnection,
-                                     Q_ARG(uintptr_t, reinterpret_cast<uintptr_t>(this)),
+                                     Q_ARG(quint64, handle()),
                                      Q_ARG(UA_NodeId, tempId),
                                      Q_ARG(QOpcUa::ReferenceTypeId, referenceType),
                                      Q_ARG(QOpcUa::NodeClasses, nodeClassMask));
@@ -142,10 +163,10 @@ bool QOpen62541Node::writeAttribute(QOpcUa::NodeAttribute attribute, const QVari
         return false;
 
     UA_NodeId tempId;
-    UA_NodeId_copy(&m_nodeId, &tempId);
-    return QMetaObject::invokeMethod(m_client->m_backend, "writeAttribute",
+    UA_NodeId_copy(&requestNodeId(), &tempId);
+    return QMetaObject::invokeMethod(m_client->m_backends.at(m_session), "writeAttribute",
                                      Qt::QueuedConnection,
-                                     Q_ARG(uintptr_t, reinterpret_cast<uintptr_t>(this)),
+                                     Q_ARG(quint64, handle()),
                                      Q_ARG(UA_NodeId, tempId),
                                      Q_ARG(QOpcUa::NodeAttribute, attribute),
                                      Q_ARG(QVariant, value),
@@ -159,10 +180,10 @@ bool QOpen62541Node::writeAttributes(const QOpcUaNode::AttributeMap &toWrite, QO
         return false;
 
     UA_NodeId tempId;
-    UA_NodeId_copy(&m_nodeId, &tempId);
-    return QMetaObject::invokeMethod(m_client->m_backend, "writeAttributes",
+    UA_NodeId_copy(&requestNodeId(), &tempId);
+    return QMetaObject::invokeMethod(m_client->m_backends.at(m_session), "writeAttributes",
                                      Qt::QueuedConnection,
-                                     Q_ARG(uintptr_t, reinterpret_cast<uintptr_t>(this)),
+                                     Q_ARG(quint64, handle()),
                                      Q_ARG(UA_NodeId, tempId),
                                      Q_ARG(QOpcUaNode::AttributeMap, toWrite),
                                      Q_ARG(QOpcUa::Types, valueAttributeType));
@@ -174,13 +195,74 @@ bool QOpen62541Node::callMethod(const QString &methodNodeId, const QVector<QOpcU
         return false;
 
     UA_NodeId obj;
-    UA_NodeId_copy(&m_nodeId, &obj);
-    return QMetaObject::invokeMethod(m_client->m_backend, "callMethod",
+    UA_NodeId_copy(&requestNodeId(), &obj);
+    return QMetaObject::invokeMethod(m_client->m_backends.at(m_session), "callMethod",
                                      Qt::QueuedConnection,
-                                     Q_ARG(uintptr_t, reinterpret_cast<uintptr_t>(this)),
+                                     Q_ARG(quint64, handle()),
                                      Q_ARG(UA_NodeId, obj),
                                      Q_ARG(UA_NodeId, Open62541Utils::nodeIdFromQString(methodNodeId)),
                                      Q_ARG(QVector<QOpcUa::TypedVariant>, args));
 }
 
+bool QOpen62541Node::callMethod(const QOpcUaNodeId &methodNodeId, const QVector<QOpcUa::TypedVariant> &args)
+{
+    if (!m_client)
+        return false;
+
+    UA_NodeId obj;
+    UA_NodeId_copy(&requestNodeId(), &obj);
+    return QMetaObject::invokeMethod(m_client->m_backends.at(m_session), "callMethod",
+                                     Qt::QueuedConnection,
+                                     Q_ARG(quint64, handle()),
+                                     Q_ARG(UA_NodeId, obj),
+                                     Q_ARG(UA_NodeId, Open62541Utils::nodeIdFromQOpcUaNodeId(methodNodeId)),
+                                     Q_ARG(QVector<QOpcUa::TypedVariant>, args));
+}
+
+bool QOpen62541Node::registerNode()
+{
+    if (!m_client)
+        return false;
+
+    return QMetaObject::invokeMethod(m_client->m_backends.at(m_session), "registerNodes",
+                                     Qt::QueuedConnection,
+                                     Q_ARG(QVector<QOpcUaNodeHandle>, QVector<QOpcUaNodeHandle>{{handle(), nodeId()}}));
+}
+
+bool QOpen62541Node::unregisterNode()
+{
+    if (!m_client)
+        return false;
+
+    // Requests sent from now on must not use the alias anymore
+    clearRegisteredNodeId();
+    return QMetaObject::invokeMethod(m_client->m_backends.at(m_session), "unregisterNodes",
+                                     Qt::QueuedConnection,
+                                     Q_ARG(QVector<QOpcUaNodeHandle>, QVector<QOpcUaNodeHandle>{{handle(), nodeId()}}));
+}
+
+QString QOpen62541Node::registeredNodeId() const
+{
+    return m_registeredNodeIdString;
+}
+
+const UA_NodeId &QOpen62541Node::requestNodeId() const
+{
+    return UA_NodeId_isNull(&m_registeredNodeId) ? m_nodeId : m_registeredNodeId;
+}
+
+void QOpen62541Node::setRegisteredNodeId(const QString &registeredNodeId)
+{
+    UA_NodeId_deleteMembers(&m_registeredNodeId);
+    m_registeredNodeId = Open62541Utils::nodeIdFromQString(registeredNodeId);
+    m_registeredNodeIdString = UA_NodeId_isNull(&m_registeredNodeId) ? QString() : registeredNodeId;
+}
+
+void QOpen62541Node::clearRegisteredNodeId()
+{
+    UA_NodeId_deleteMembers(&m_registeredNodeId);
+    UA_NodeId_init(&m_registeredNodeId);
+    m_registeredNodeIdString.clear();
+}
+
 QT_END_NAMESPACE
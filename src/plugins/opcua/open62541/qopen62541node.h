@@ -60,11 +60,26 @@ public:
     bool writeAttribute(QOpcUa::NodeAttribute attribute, const QVariant &value, QOpcUa::Types type, const QString &indexRange) override;
     bool writeAttributes(const QOpcUaNode::AttributeMap &toWrite, QOpcUa::Types valueAttributeType) override;
     bool callMethod(const QString &methodNodeId, const QVector<QOpcUa::TypedVariant> &args) override;
+    bool callMethod(const QOpcUaNodeId &methodNodeId, const QVector<QOpcUa::TypedVariant> &args) override;
+
+    bool registerNode() override;
+    bool unregisterNode() override;
+    QString registeredNodeId() const override;
 
 private:
+    friend class QOpen62541Client;
+
+    const UA_NodeId &requestNodeId() const;
+    void setRegisteredNodeId(const QString &registeredNodeId);
+    void clearRegisteredNodeId();
+
     QPointer<QOpen62541Client> m_client;
-    QString m_nodeIdString;
+    mutable QString m_nodeIdString;
     UA_NodeId m_nodeId;
+    // The id assigned by RegisterNodes, used for all requests while it is set
+    UA_NodeId m_registeredNodeId;
+    QString m_registeredNodeIdString;
+    int m_session; // All requests of the node are sent on the same session
 };
 
 QT_END_NAMESPACE
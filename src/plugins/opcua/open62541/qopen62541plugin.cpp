@@ -44,6 +44,8 @@
 
 QT_BEGIN_NAMESPACE
 
+Q_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_OPEN62541, "qt.opcua.plugins.open62541")
+
 static void compileTimeEnforceEnumMappings(void)
 {
     static_assert(static_cast<QOpcUa::NodeClass>(UA_NODECLASS_UNSPECIFIED) == QOpcUa::NodeClass::Undefined,
@@ -68,6 +70,15 @@ QOpcUaClient *QOpen62541Plugin::createClient()
     return new QOpcUaClient(new QOpen62541Client);
 }
 
-Q_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_OPEN62541, "qt.opcua.plugins.open62541")
+QOpcUaClient *QOpen62541Plugin::createClient(const QVariantMap &backendProperties)
+{
+    const int sessionCount = backendProperties.value(QStringLiteral("sessionCount"), 1).toInt();
+    if (sessionCount < 1) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Ignoring invalid session count" << sessionCount;
+        return createClient();
+    }
+
+    return new QOpcUaClient(new QOpen62541Client(sessionCount));
+}
 
 QT_END_NAMESPACE
@@ -46,7 +46,7 @@ class QOpen62541Plugin : public QOpcUaPlugin
 {
     Q_OBJECT
 
-    Q_PLUGIN_METADATA(IID "org.qt-project.qt.opcua.providerfactory/1.0" FILE "open62541-metadata.json")
+    Q_PLUGIN_METADATA(IID "org.qt-project.qt.opcua.providerfactory/1.1" FILE "open62541-metadata.json")
     Q_INTERFACES(QOpcUaPlugin)
 
 public:
@@ -54,6 +54,7 @@ public:
     ~QOpen62541Plugin() override;
 
     QOpcUaClient *createClient() override;
+    QOpcUaClient *createClient(const QVariantMap &backendProperties) override;
 };
 
 QT_END_NAMESPACE
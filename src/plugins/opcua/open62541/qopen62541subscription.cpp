@@ -38,10 +38,12 @@
 #include "qopen62541client.h"
 #include "qopen62541node.h"
 #include "qopen62541subscription.h"
+#include "qopen62541utils.h"
 #include "qopen62541valueconverter.h"
 #include <private/qopcuanode_p.h>
 
 #include <QtCore/qloggingcategory.h>
+#include <QtCore/qset.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -114,24 +116,27 @@ bool QOpen62541Subscription::removeOnServer()
     UA_StatusCode res = UA_STATUSCODE_GOOD;
     if (m_subscriptionId) {
         res = UA_Client_Subscriptions_deleteSingle(m_backend->m_uaclient, m_subscriptionId);
+        m_backend->statistics().subscriptionRemoved(m_subscriptionId);
         m_subscriptionId = 0;
     }
 
     for (auto it : qAsConst(m_itemIdToItemMapping)) {
         QOpcUaMonitoringParameters s;
         s.setStatusCode(m_timeout ? QOpcUa::UaStatusCode::BadTimeout : QOpcUa::UaStatusCode::BadDisconnect);
-        emit m_backend->monitoringEnableDisable(it->handle, it->attr, false, s);
+        for (quint64 handle : qAsConst(it->handles))
+            emit m_backend->monitoringEnableDisable(handle, it->attr, false, s);
     }
 
     qDeleteAll(m_itemIdToItemMapping);
 
     m_itemIdToItemMapping.clear();
     m_handleToItemMapping.clear();
+    m_sharedItems.clear();
 
     return (res == UA_STATUSCODE_GOOD) ? true : false;
 }
 
-void QOpen62541Subscription::modifyMonitoring(uintptr_t handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value)
+void QOpen62541Subscription::modifyMonitoring(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value)
 {
     QOpcUaMonitoringParameters p;
     p.setStatusCode(QOpcUa::UaStatusCode::BadNotImplemented);
@@ -227,24 +232,22 @@ void QOpen62541Subscription::modifyMonitoring(uintptr_t handle, QOpcUa::NodeAttr
     emit m_backend->monitoringStatusChanged(handle, attr, item, p);
 }
 
-bool QOpen62541Subscription::addAttributeMonitoredItem(uintptr_t handle, QOpcUa::NodeAttribute attr, const UA_NodeId &id, QOpcUaMonitoringParameters settings)
+bool QOpen62541Subscription::addAttributeMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr, const UA_NodeId &id, QOpcUaMonitoringParameters settings)
 {
+    const QString key = sharingKey(attr, id, settings);
+    if (attachToSharedItem(handle, attr, key))
+        return true;
+
     UA_MonitoredItemCreateRequest req;
-    UA_MonitoredItemCreateRequest_init(&req);
-    req.itemToMonitor.attributeId = QOpen62541ValueConverter::toUaAttributeId(attr);
-    UA_NodeId_copy(&id, &(req.itemToMonitor.nodeId));
-    if (settings.indexRange().size())
-        req.itemToMonitor.indexRange = UA_STRING_ALLOC(settings.indexRange().toUtf8().data());
-    req.monitoringMode = static_cast<UA_MonitoringMode>(settings.monitoringMode());
-    req.requestedParameters.samplingInterval = qFuzzyCompare(settings.samplingInterval(), 0.0) ? m_interval : settings.samplingInterval();
-    req.requestedParameters.queueSize = settings.queueSize() == 0 ? 1 : settings.queueSize();
-    req.requestedParameters.discardOldest = settings.discardOldest();
-    req.requestedParameters.clientHandle = ++m_clientHandle;
-    if (settings.filter().type() == QVariant::UserType && settings.filter().userType() == QMetaType::type("QOpcUaMonitoringParameters::DataChangeFilter"))
-        req.requestedParameters.filter = createFilter(settings.filter());
+    initCreateRequest(&req, attr, id, settings);
 
-    UA_MonitoredItemCreateResult res = UA_Client_MonitoredItems_createDataChange(m_backend->m_uaclient, m_subscriptionId, UA_TIMESTAMPSTORETURN_BOTH, req, this, monitoredValueHandler, nullptr);
+    UA_MonitoredItemCreateResult res;
+    {
+        QOpcUaStatisticsCollector::ServiceTimer timer(m_backend->statistics(), QOpcUaClientStatistics::Service::CreateMonitoredItems);
+        res = UA_Client_MonitoredItems_createDataChange(m_backend->m_uaclient, m_subscriptionId, UA_TIMESTAMPSTORETURN_BOTH, req, this, monitoredValueHandler, nullptr);
+    }
 
+    const UA_UInt32 clientHandle = req.requestedParameters.clientHandle;
     UA_MonitoredItemCreateRequest_deleteMembers(&req);
 
     if (res.statusCode != UA_STATUSCODE_GOOD) {
@@ -255,28 +258,108 @@ bool QOpen62541Subscription::addAttributeMonitoredItem(uintptr_t handle, QOpcUa:
         return false;
     }
 
-    MonitoredItem *temp = new MonitoredItem(handle, attr, res.monitoredItemId);
-    m_handleToItemMapping[handle][attr] = temp;
-    m_itemIdToItemMapping[res.monitoredItemId] = temp;
+    monitoredItemCreated(handle, attr, settings, res, clientHandle, key);
 
-    QOpcUaMonitoringParameters s = settings;
-    s.setSubscriptionId(m_subscriptionId);
-    s.setPublishingInterval(m_interval);
-    s.setMaxKeepAliveCount(m_maxKeepaliveCount);
-    s.setLifetimeCount(m_lifetimeCount);
-    s.setStatusCode(QOpcUa::UaStatusCode::Good);
-    s.setSamplingInterval(res.revisedSamplingInterval);
-    s.setQueueSize(res.revisedQueueSize);
-    temp->parameters = s;
-    temp->clientHandle = m_clientHandle;
+    return true;
+}
 
-    s.setFilter(QVariant());
-    emit m_backend->monitoringEnableDisable(handle, attr, true, s);
+UA_StatusCode QOpen62541Subscription::addAttributeMonitoredItems(const QVector<ItemToMonitor> &items, const QOpcUaMonitoringParameters &settings)
+{
+    // Items which match an existing shared item or an earlier item of this request don't create a server item.
+    // They are attached after the request, the caller repeats the call if the server rejects its size.
+    QVector<ItemToMonitor> itemsToCreate;
+    QVector<QString> keys;
+    QVector<QPair<QString, ItemToMonitor>> itemsToAttach;
+    QSet<QString> requestedKeys;
+    for (const ItemToMonitor &item : items) {
+        const QString key = sharingKey(item.attr, item.nodeId, settings);
+        if (!key.isEmpty() && (m_sharedItems.contains(key) || requestedKeys.contains(key))) {
+            itemsToAttach.push_back(qMakePair(key, item));
+            continue;
+        }
+        if (!key.isEmpty())
+            requestedKeys.insert(key);
+        itemsToCreate.push_back(item);
+        keys.push_back(key);
+    }
 
-    return true;
+    if (itemsToCreate.isEmpty()) {
+        for (const auto &entry : qAsConst(itemsToAttach))
+            attachToSharedItem(entry.second.handle, entry.second.attr, entry.first);
+        return UA_STATUSCODE_GOOD;
+    }
+
+    const size_t numItems = itemsToCreate.size();
+
+    UA_CreateMonitoredItemsRequest req;
+    UA_CreateMonitoredItemsRequest_init(&req);
+    req.subscriptionId = m_subscriptionId;
+    req.timestampsToReturn = UA_TIMESTAMPSTORETURN_BOTH;
+    req.itemsToCreate = static_cast<UA_MonitoredItemCreateRequest *>(UA_Array_new(numItems, &UA_TYPES[UA_TYPES_MONITOREDITEMCREATEREQUEST]));
+    req.itemsToCreateSize = numItems;
+
+    for (int i = 0; i < itemsToCreate.size(); ++i)
+        initCreateRequest(&req.itemsToCreate[i], itemsToCreate.at(i).attr, itemsToCreate.at(i).nodeId, settings);
+
+    QVector<void *> contexts(itemsToCreate.size(), this);
+    QVector<UA_Client_DataChangeNotificationCallback> callbacks(itemsToCreate.size(), monitoredValueHandler);
+    QVector<UA_Client_DeleteMonitoredItemCallback> deleteCallbacks(itemsToCreate.size(), nullptr);
+
+    UA_CreateMonitoredItemsResponse res;
+    {
+        QOpcUaStatisticsCollector::ServiceTimer timer(m_backend->statistics(), QOpcUaClientStatistics::Service::CreateMonitoredItems);
+        res = UA_Client_MonitoredItems_createDataChanges(m_backend->m_uaclient, req, contexts.data(),
+                                                         callbacks.data(), deleteCallbacks.data());
+    }
+    const UA_StatusCode serviceResult = res.responseHeader.serviceResult;
+
+    // Let the caller retry with a smaller number of items per request
+    if (serviceResult == UA_STATUSCODE_BADTOOMANYOPERATIONS && numItems > 1) {
+        UA_CreateMonitoredItemsRequest_deleteMembers(&req);
+        UA_CreateMonitoredItemsResponse_deleteMembers(&res);
+        return serviceResult;
+    }
+
+    if (serviceResult != UA_STATUSCODE_GOOD)
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not add monitored items to subscription" << m_subscriptionId << ":" << UA_StatusCode_name(serviceResult);
+
+    QHash<QString, UA_StatusCode> failedKeys;
+    for (int i = 0; i < itemsToCreate.size(); ++i) {
+        const ItemToMonitor &item = itemsToCreate.at(i);
+
+        UA_StatusCode status = serviceResult;
+        if (static_cast<size_t>(i) < res.resultsSize)
+            status = res.results[i].statusCode;
+        else if (status == UA_STATUSCODE_GOOD)
+            status = UA_STATUSCODE_BADUNEXPECTEDERROR;
+
+        if (status != UA_STATUSCODE_GOOD) {
+            QOpcUaMonitoringParameters s;
+            s.setStatusCode(static_cast<QOpcUa::UaStatusCode>(status));
+            emit m_backend->monitoringEnableDisable(item.handle, item.attr, true, s);
+            if (!keys.at(i).isEmpty())
+                failedKeys.insert(keys.at(i), status);
+            continue;
+        }
+
+        monitoredItemCreated(item.handle, item.attr, settings, res.results[i], req.itemsToCreate[i].requestedParameters.clientHandle, keys.at(i));
+    }
+
+    for (const auto &entry : qAsConst(itemsToAttach)) {
+        if (attachToSharedItem(entry.second.handle, entry.second.attr, entry.first))
+            continue;
+        QOpcUaMonitoringParameters s;
+        s.setStatusCode(static_cast<QOpcUa::UaStatusCode>(failedKeys.value(entry.first, UA_STATUSCODE_BADUNEXPECTEDERROR)));
+        emit m_backend->monitoringEnableDisable(entry.second.handle, entry.second.attr, true, s);
+    }
+
+    UA_CreateMonitoredItemsRequest_deleteMembers(&req);
+    UA_CreateMonitoredItemsResponse_deleteMembers(&res);
+
+    return serviceResult;
 }
 
-bool QOpen62541Subscription::removeAttributeMonitoredItem(uintptr_t handle, QOpcUa::NodeAttribute attr)
+bool QOpen62541Subscription::removeAttributeMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr)
 {
     MonitoredItem *item = getItemForAttribute(handle, attr);
     if (!item) {
@@ -287,17 +370,19 @@ bool QOpen62541Subscription::removeAttributeMonitoredItem(uintptr_t handle, QOpc
         return false;
     }
 
+    // The server item is only deleted with the last node which uses it
+    if (detachFromSharedItem(handle, attr)) {
+        QOpcUaMonitoringParameters s;
+        s.setStatusCode(QOpcUa::UaStatusCode::Good);
+        emit m_backend->monitoringEnableDisable(handle, attr, false, s);
+        return true;
+    }
+
     UA_StatusCode res = UA_Client_MonitoredItems_deleteSingle(m_backend->m_uaclient, m_subscriptionId, item->monitoredItemId);
     if (res != UA_STATUSCODE_GOOD)
         qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not remove monitored item" << item->monitoredItemId << "from subscription" << m_subscriptionId << ":" << UA_StatusCode_name(res);
 
-    m_itemIdToItemMapping.remove(item->monitoredItemId);
-    auto it = m_handleToItemMapping.find(handle);
-    it->remove(attr);
-    if (it->empty())
-        m_handleToItemMapping.erase(it);
-
-    delete item;
+    forgetMonitoredItem(item);
 
     QOpcUaMonitoringParameters s;
     s.setStatusCode(static_cast<QOpcUa::UaStatusCode>(res));
@@ -306,36 +391,145 @@ bool QOpen62541Subscription::removeAttributeMonitoredItem(uintptr_t handle, QOpc
     return true;
 }
 
+UA_StatusCode QOpen62541Subscription::removeAttributeMonitoredItems(const QVector<QPair<quint64, QOpcUa::NodeAttribute>> &items)
+{
+    // Nodes which share a server item with other nodes only detach from it,
+    // the server item is deleted if all nodes which use it are removed.
+    QHash<MonitoredItem *, QVector<quint64>> releasedHandles;
+
+    for (const auto &entry : items) {
+        MonitoredItem *item = getItemForAttribute(entry.first, entry.second);
+        if (!item) {
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "There is no monitored item for this attribute";
+            QOpcUaMonitoringParameters s;
+            s.setStatusCode(QOpcUa::UaStatusCode::BadMonitoredItemIdInvalid);
+            emit m_backend->monitoringEnableDisable(entry.first, entry.second, false, s);
+            continue;
+        }
+        releasedHandles[item].push_back(entry.first);
+    }
+
+    QVector<MonitoredItem *> monitoredItems;
+    monitoredItems.reserve(releasedHandles.size());
+    for (auto it = releasedHandles.constBegin(); it != releasedHandles.constEnd(); ++it) {
+        if (it.value().size() >= it.key()->handles.size())
+            monitoredItems.push_back(it.key());
+    }
+
+    const auto detachHandles = [&]() {
+        for (auto it = releasedHandles.constBegin(); it != releasedHandles.constEnd(); ++it) {
+            if (it.value().size() >= it.key()->handles.size())
+                continue;
+            for (quint64 handle : it.value()) {
+                detachFromSharedItem(handle, it.key()->attr);
+                QOpcUaMonitoringParameters s;
+                s.setStatusCode(QOpcUa::UaStatusCode::Good);
+                emit m_backend->monitoringEnableDisable(handle, it.key()->attr, false, s);
+            }
+        }
+    };
+
+    if (monitoredItems.isEmpty()) {
+        detachHandles();
+        return UA_STATUSCODE_GOOD;
+    }
+
+    const size_t numItems = monitoredItems.size();
+
+    UA_DeleteMonitoredItemsRequest req;
+    UA_DeleteMonitoredItemsRequest_init(&req);
+    req.subscriptionId = m_subscriptionId;
+    req.monitoredItemIds = static_cast<UA_UInt32 *>(UA_Array_new(numItems, &UA_TYPES[UA_TYPES_UINT32]));
+    req.monitoredItemIdsSize = numItems;
+
+    for (int i = 0; i < monitoredItems.size(); ++i)
+        req.monitoredItemIds[i] = monitoredItems.at(i)->monitoredItemId;
+
+    UA_DeleteMonitoredItemsResponse res = UA_Client_MonitoredItems_delete(m_backend->m_uaclient, req);
+    UA_DeleteMonitoredItemsRequest_deleteMembers(&req);
+
+    const UA_StatusCode serviceResult = res.responseHeader.serviceResult;
+
+    // Let the caller retry with a smaller number of items per request
+    if (serviceResult == UA_STATUSCODE_BADTOOMANYOPERATIONS && numItems > 1) {
+        UA_DeleteMonitoredItemsResponse_deleteMembers(&res);
+        return serviceResult;
+    }
+
+    detachHandles();
+
+    for (int i = 0; i < monitoredItems.size(); ++i) {
+        MonitoredItem *item = monitoredItems.at(i);
+        const UA_StatusCode status = static_cast<size_t>(i) < res.resultsSize ? res.results[i] : serviceResult;
+
+        if (status != UA_STATUSCODE_GOOD)
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not remove monitored item" << item->monitoredItemId << "from subscription" << m_subscriptionId << ":" << UA_StatusCode_name(status);
+
+        const QVector<quint64> handles = item->handles;
+        const QOpcUa::NodeAttribute attr = item->attr;
+        forgetMonitoredItem(item);
+
+        QOpcUaMonitoringParameters s;
+        s.setStatusCode(static_cast<QOpcUa::UaStatusCode>(status));
+        for (quint64 handle : handles)
+            emit m_backend->monitoringEnableDisable(handle, attr, false, s);
+    }
+
+    UA_DeleteMonitoredItemsResponse_deleteMembers(&res);
+
+    return serviceResult;
+}
+
+bool QOpen62541Subscription::hasMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr)
+{
+    return getItemForAttribute(handle, attr) != nullptr;
+}
+
 void QOpen62541Subscription::monitoredValueUpdated(UA_UInt32 monId, UA_DataValue *value)
 {
     auto item = m_itemIdToItemMapping.constFind(monId);
     if (item == m_itemIdToItemMapping.constEnd())
         return;
+    m_backend->statistics().notificationsReceived(m_subscriptionId, 1);
     QOpcUaReadResult res;
+    res.attributeId = item.value()->attr;
+    res.statusCode = QOpcUa::UaStatusCode::Good;
 
     if (!value || value == UA_EMPTY_ARRAY_SENTINEL) {
-        res.statusCode = QOpcUa::UaStatusCode::Good;
-        emit m_backend->attributeUpdated(item.value()->handle, res);
+        deliverUpdate(item.value(), res);
         return;
     }
 
-    res.value = QOpen62541ValueConverter::toQVariant(value->value);
-    res.attributeId = item.value()->attr;
+    // The SDK frees the notification after the callback, lazy decoding takes over the variant
+    if (m_backend->lazyValueDecodingEnabled())
+        res.encodedValue.reset(new QOpen62541EncodedValue(&value->value, m_backend->typedArraysEnabled()));
+    else
+        res.value = QOpen62541ValueConverter::toQVariant(value->value, m_backend->typedArraysEnabled());
     if (value->hasServerTimestamp)
-        res.serverTimestamp = QOpen62541ValueConverter::uaDateTimeToQDateTime(value->serverTimestamp);
+        res.serverTimestamp = value->serverTimestamp;
     if (value->hasSourceTimestamp)
-        res.sourceTimestamp = QOpen62541ValueConverter::uaDateTimeToQDateTime(value->sourceTimestamp);
-    res.statusCode = QOpcUa::UaStatusCode::Good;
-    emit m_backend->attributeUpdated(item.value()->handle, res);
+        res.sourceTimestamp = value->sourceTimestamp;
+    deliverUpdate(item.value(), res);
+}
+
+// Shared items keep the last value for nodes which attach later, the value is shared by all nodes
+void QOpen62541Subscription::deliverUpdate(MonitoredItem *item, const QOpcUaReadResult &value)
+{
+    if (!item->sharingKey.isEmpty()) {
+        item->lastValue = value;
+        item->hasLastValue = true;
+    }
+
+    for (quint64 handle : qAsConst(item->handles))
+        m_backend->queueAttributeUpdate(handle, value);
 }
 
 void QOpen62541Subscription::sendTimeoutNotification()
 {
-    QVector<QPair<uintptr_t, QOpcUa::NodeAttribute>> items;
-    for (auto it : qAsConst(m_handleToItemMapping)) {
-        for (auto item : it) {
-            items.push_back({item->handle, item->attr});
-        }
+    QVector<QPair<quint64, QOpcUa::NodeAttribute>> items;
+    for (auto item : qAsConst(m_itemIdToItemMapping)) {
+        for (quint64 handle : qAsConst(item->handles))
+            items.push_back({handle, item->attr});
     }
     emit timeout(this, items);
     m_timeout = true;
@@ -361,18 +555,119 @@ QOpcUaMonitoringParameters::SubscriptionType QOpen62541Subscription::shared() co
     return m_shared;
 }
 
-QOpen62541Subscription::MonitoredItem *QOpen62541Subscription::getItemForAttribute(uintptr_t handle, QOpcUa::NodeAttribute attr)
+QOpen62541Subscription::MonitoredItem *QOpen62541Subscription::getItemForAttribute(quint64 handle, QOpcUa::NodeAttribute attr)
+{
+    return m_handleToItemMapping.value(handle, attr);
+}
+
+void QOpen62541Subscription::initCreateRequest(UA_MonitoredItemCreateRequest *req, QOpcUa::NodeAttribute attr, const UA_NodeId &id,
+                                               const QOpcUaMonitoringParameters &settings)
+{
+    UA_MonitoredItemCreateRequest_init(req);
+    req->itemToMonitor.attributeId = QOpen62541ValueConverter::toUaAttributeId(attr);
+    UA_NodeId_copy(&id, &(req->itemToMonitor.nodeId));
+    if (settings.indexRange().size())
+        req->itemToMonitor.indexRange = UA_STRING_ALLOC(settings.indexRange().toUtf8().data());
+    req->monitoringMode = static_cast<UA_MonitoringMode>(settings.monitoringMode());
+    req->requestedParameters.samplingInterval = qFuzzyCompare(settings.samplingInterval(), 0.0) ? m_interval : settings.samplingInterval();
+    req->requestedParameters.queueSize = settings.queueSize() == 0 ? 1 : settings.queueSize();
+    req->requestedParameters.discardOldest = settings.discardOldest();
+    req->requestedParameters.clientHandle = ++m_clientHandle;
+    if (settings.filter().type() == QVariant::UserType && settings.filter().userType() == QMetaType::type("QOpcUaMonitoringParameters::DataChangeFilter"))
+        req->requestedParameters.filter = createFilter(settings.filter());
+}
+
+void QOpen62541Subscription::monitoredItemCreated(quint64 handle, QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters &settings,
+                                                  const UA_MonitoredItemCreateResult &res, UA_UInt32 clientHandle, const QString &sharingKey)
+{
+    MonitoredItem *temp = new MonitoredItem(handle, attr, res.monitoredItemId);
+    m_handleToItemMapping.insert(handle, attr, temp);
+    m_itemIdToItemMapping[res.monitoredItemId] = temp;
+    if (!sharingKey.isEmpty()) {
+        temp->sharingKey = sharingKey;
+        m_sharedItems.insert(sharingKey, temp);
+    }
+
+    QOpcUaMonitoringParameters s = settings;
+    s.setSubscriptionId(m_subscriptionId);
+    s.setPublishingInterval(m_interval);
+    s.setMaxKeepAliveCount(m_maxKeepaliveCount);
+    s.setLifetimeCount(m_lifetimeCount);
+    s.setStatusCode(QOpcUa::UaStatusCode::Good);
+    s.setSamplingInterval(res.revisedSamplingInterval);
+    s.setQueueSize(res.revisedQueueSize);
+    temp->parameters = s;
+    temp->clientHandle = clientHandle;
+
+    s.setFilter(QVariant());
+    emit m_backend->monitoringEnableDisable(handle, attr, true, s);
+}
+
+void QOpen62541Subscription::forgetMonitoredItem(MonitoredItem *item)
+{
+    m_itemIdToItemMapping.remove(item->monitoredItemId);
+    for (quint64 handle : qAsConst(item->handles))
+        m_handleToItemMapping.remove(handle, item->attr);
+    if (!item->sharingKey.isEmpty())
+        m_sharedItems.remove(item->sharingKey);
+
+    delete item;
+}
+
+// Items of shared subscriptions are shared if all parameters which affect the delivered values match.
+// Items of exclusive subscriptions are never shared.
+QString QOpen62541Subscription::sharingKey(QOpcUa::NodeAttribute attr, const UA_NodeId &id, const QOpcUaMonitoringParameters &settings) const
+{
+    if (m_shared != QOpcUaMonitoringParameters::SubscriptionType::Shared)
+        return QString();
+
+    QString filter;
+    if (settings.filter().type() == QVariant::UserType && settings.filter().userType() == QMetaType::type("QOpcUaMonitoringParameters::DataChangeFilter")) {
+        const auto dataChangeFilter = settings.filter().value<QOpcUaMonitoringParameters::DataChangeFilter>();
+        filter = QStringLiteral("%1,%2,%3").arg(static_cast<int>(dataChangeFilter.trigger))
+                .arg(static_cast<int>(dataChangeFilter.deadbandType)).arg(dataChangeFilter.deadbandValue, 0, 'g', 17);
+    }
+
+    const double samplingInterval = qFuzzyCompare(settings.samplingInterval(), 0.0) ? m_interval : settings.samplingInterval();
+
+    return QStringLiteral("%1|%2|%3|%4|%5|%6|%7|%8").arg(Open62541Utils::nodeIdToQString(id))
+            .arg(static_cast<int>(attr)).arg(settings.indexRange()).arg(samplingInterval, 0, 'g', 17)
+            .arg(settings.queueSize()).arg(settings.discardOldest()).arg(static_cast<int>(settings.monitoringMode())).arg(filter);
+}
+
+bool QOpen62541Subscription::attachToSharedItem(quint64 handle, QOpcUa::NodeAttribute attr, const QString &sharingKey)
 {
-    auto nodeEntry = m_handleToItemMapping.constFind(handle);
+    if (sharingKey.isEmpty())
+        return false;
+
+    MonitoredItem *item = m_sharedItems.value(sharingKey);
+    if (!item)
+        return false;
+
+    item->handles.push_back(handle);
+    m_handleToItemMapping.insert(handle, attr, item);
+
+    QOpcUaMonitoringParameters s = item->parameters;
+    s.setFilter(QVariant());
+    emit m_backend->monitoringEnableDisable(handle, attr, true, s);
 
-    if (nodeEntry == m_handleToItemMapping.constEnd())
-        return nullptr;
+    // The server only sends the current value when the item is created
+    if (item->hasLastValue)
+        m_backend->queueAttributeUpdate(handle, item->lastValue);
 
-    auto item = nodeEntry->constFind(attr);
-    if (item == nodeEntry->constEnd())
-        return nullptr;
+    return true;
+}
 
-    return item.value();
+// Returns false if the item doesn't exist or if the node is the last one using it
+bool QOpen62541Subscription::detachFromSharedItem(quint64 handle, QOpcUa::NodeAttribute attr)
+{
+    MonitoredItem *item = getItemForAttribute(handle, attr);
+    if (!item || item->handles.size() < 2)
+        return false;
+
+    item->handles.removeOne(handle);
+    m_handleToItemMapping.remove(handle, attr);
+    return true;
 }
 
 UA_ExtensionObject QOpen62541Subscription::createFilter(const QVariant &filterData)
@@ -398,7 +693,7 @@ UA_ExtensionObject QOpen62541Subscription::createFilter(const QVariant &filterDa
     return obj;
 }
 
-bool QOpen62541Subscription::modifySubscriptionParameters(uintptr_t handle, QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters::Parameter &item, const QVariant &value)
+bool QOpen62541Subscription::modifySubscriptionParameters(quint64 handle, QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters::Parameter &item, const QVariant &value)
 {
     QOpcUaMonitoringParameters p;
 
@@ -503,15 +798,17 @@ bool QOpen62541Subscription::modifySubscriptionParameters(uintptr_t handle, QOpc
             p.setPriority(m_priority);
             p.setMaxNotificationsPerPublish(m_maxNotificationsPerPublish);
 
-            for (auto it : qAsConst(m_itemIdToItemMapping))
-                emit m_backend->monitoringStatusChanged(it->handle, it->attr, changed, p);
+            for (auto it : qAsConst(m_itemIdToItemMapping)) {
+                for (quint64 h : qAsConst(it->handles))
+                    emit m_backend->monitoringStatusChanged(h, it->attr, changed, p);
+            }
         }
         return true;
     }
     return false;
 }
 
-bool QOpen62541Subscription::modifyMonitoredItemParameters(uintptr_t handle, QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters::Parameter &item, const QVariant &value)
+bool QOpen62541Subscription::modifyMonitoredItemParameters(quint64 handle, QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters::Parameter &item, const QVariant &value)
 {
     MonitoredItem *monItem = getItemForAttribute(handle, attr);
     QOpcUaMonitoringParameters p = monItem->parameters;
@@ -602,8 +899,15 @@ bool QOpen62541Subscription::modifyMonitoredItemParameters(uintptr_t handle, QOp
                 changed |= QOpcUaMonitoringParameters::Parameter::DiscardOldest;
             }
 
-            emit m_backend->monitoringStatusChanged(handle, attr, changed, p);
+            // All nodes which share the item are affected, the modified item is no longer shared with new nodes
+            for (quint64 h : qAsConst(monItem->handles))
+                emit m_backend->monitoringStatusChanged(h, attr, changed, p);
             monItem->parameters = p;
+            if (!monItem->sharingKey.isEmpty()) {
+                m_sharedItems.remove(monItem->sharingKey);
+                monItem->sharingKey.clear();
+                monItem->hasLastValue = false;
+            }
             UA_ModifyMonitoredItemsRequest_deleteMembers(&req);
             UA_ModifyMonitoredItemsResponse_deleteMembers(&res);
         }
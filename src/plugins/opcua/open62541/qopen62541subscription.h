@@ -39,6 +39,8 @@
 
 #include "qopen62541.h"
 #include <QtOpcUa/qopcuanode.h>
+#include <private/qopcuahandletable_p.h>
+#include <private/qopcuanodeimpl_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -55,28 +57,43 @@ public:
     UA_UInt32 createOnServer();
     bool removeOnServer();
 
-    void modifyMonitoring(uintptr_t handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value);
+    void modifyMonitoring(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value);
 
-    bool addAttributeMonitoredItem(uintptr_t handle, QOpcUa::NodeAttribute attr, const UA_NodeId &id, QOpcUaMonitoringParameters settings);
-    bool removeAttributeMonitoredItem(uintptr_t handle, QOpcUa::NodeAttribute attr);
+    struct ItemToMonitor {
+        quint64 handle;
+        QOpcUa::NodeAttribute attr;
+        UA_NodeId nodeId; // Not owned, copied into the request
+    };
+
+    bool addAttributeMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr, const UA_NodeId &id, QOpcUaMonitoringParameters settings);
+    UA_StatusCode addAttributeMonitoredItems(const QVector<ItemToMonitor> &items, const QOpcUaMonitoringParameters &settings);
+    bool removeAttributeMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr);
+    UA_StatusCode removeAttributeMonitoredItems(const QVector<QPair<quint64, QOpcUa::NodeAttribute>> &items);
+    bool hasMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr);
 
     void monitoredValueUpdated(UA_UInt32 monId, UA_DataValue *value);
     void sendTimeoutNotification();
 
+    // One monitored item on the server. Items of shared subscriptions are shared by all nodes
+    // which request the same node id, attribute and monitoring parameters.
     struct MonitoredItem {
-        uintptr_t handle;
+        QVector<quint64> handles;
         QOpcUa::NodeAttribute attr;
         UA_UInt32 monitoredItemId;
         UA_UInt32 clientHandle;
         QOpcUaMonitoringParameters parameters;
-        MonitoredItem(uintptr_t h, QOpcUa::NodeAttribute a, UA_UInt32 id)
-            : handle(h)
+        QString sharingKey; // Empty if the item is not shared
+        QOpcUaReadResult lastValue; // Sent to nodes which attach to a shared item
+        bool hasLastValue;
+        MonitoredItem(quint64 h, QOpcUa::NodeAttribute a, UA_UInt32 id)
+            : handles({h})
             , attr(a)
             , monitoredItemId(id)
+            , hasLastValue(false)
         {}
         MonitoredItem()
-            : handle(0)
-            , monitoredItemId(0)
+            : monitoredItemId(0)
+            , hasLastValue(false)
         {}
     };
 
@@ -87,14 +104,23 @@ public:
     QOpcUaMonitoringParameters::SubscriptionType shared() const;
 
 signals:
-    void timeout(QOpen62541Subscription *sub, QVector<QPair<uintptr_t, QOpcUa::NodeAttribute>> items);
+    void timeout(QOpen62541Subscription *sub, QVector<QPair<quint64, QOpcUa::NodeAttribute>> items);
 
 private:
-    MonitoredItem *getItemForAttribute(uintptr_t handle, QOpcUa::NodeAttribute attr);
+    MonitoredItem *getItemForAttribute(quint64 handle, QOpcUa::NodeAttribute attr);
+    void initCreateRequest(UA_MonitoredItemCreateRequest *req, QOpcUa::NodeAttribute attr, const UA_NodeId &id,
+                           const QOpcUaMonitoringParameters &settings);
+    void monitoredItemCreated(quint64 handle, QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters &settings,
+                              const UA_MonitoredItemCreateResult &res, UA_UInt32 clientHandle, const QString &sharingKey);
+    void forgetMonitoredItem(MonitoredItem *item);
+    void deliverUpdate(MonitoredItem *item, const QOpcUaReadResult &value);
+    QString sharingKey(QOpcUa::NodeAttribute attr, const UA_NodeId &id, const QOpcUaMonitoringParameters &settings) const;
+    bool attachToSharedItem(quint64 handle, QOpcUa::NodeAttribute attr, const QString &sharingKey);
+    bool detachFromSharedItem(quint64 handle, QOpcUa::NodeAttribute attr);
     UA_ExtensionObject createFilter(const QVariant &filterData);
 
-    bool modifySubscriptionParameters(uintptr_t handle, QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters::Parameter &item, const QVariant &value);
-    bool modifyMonitoredItemParameters(uintptr_t handle, QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters::Parameter &item, const QVariant &value);
+    bool modifySubscriptionParameters(quint64 handle, QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters::Parameter &item, const QVariant &value);
+    bool modifyMonitoredItemParameters(quint64 handle, QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters::Parameter &item, const QVariant &value);
 
     Open62541AsyncBackend *m_backend;
     double m_interval;
@@ -105,8 +131,9 @@ private:
     quint8 m_priority;
     quint32 m_maxNotificationsPerPublish;
 
-    QHash<uintptr_t, QHash<QOpcUa::NodeAttribute, MonitoredItem *>> m_handleToItemMapping; // Handle -> Attribute -> MonitoredItem
+    QOpcUaAttributeMap<MonitoredItem *> m_handleToItemMapping; // Handle -> Attribute -> MonitoredItem
     QHash<UA_UInt32, MonitoredItem *> m_itemIdToItemMapping; // ItemId -> Item for fast lookup on data change
+    QHash<QString, MonitoredItem *> m_sharedItems; // Sharing key -> Item
 
     quint32 m_clientHandle;
     bool m_timeout;
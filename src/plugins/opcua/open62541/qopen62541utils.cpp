@@ -173,4 +173,59 @@ QString Open62541Utils::nodeIdToQString(UA_NodeId id)
     return result;
 }
 
+UA_NodeId Open62541Utils::nodeIdFromQOpcUaNodeId(const QOpcUaNodeId &id)
+{
+    switch (id.identifierType()) {
+    case QOpcUaNodeId::IdentifierType::Numeric:
+        return UA_NODEID_NUMERIC(id.namespaceIndex(), id.numericIdentifier());
+    case QOpcUaNodeId::IdentifierType::String:
+        return UA_NODEID_STRING_ALLOC(id.namespaceIndex(), id.stringIdentifier().toUtf8().constData());
+    case QOpcUaNodeId::IdentifierType::Guid: {
+        const QUuid uuid = id.guidIdentifier();
+        UA_Guid guid;
+        guid.data1 = uuid.data1;
+        guid.data2 = uuid.data2;
+        guid.data3 = uuid.data3;
+        std::memcpy(guid.data4, uuid.data4, sizeof(uuid.data4));
+        return UA_NODEID_GUID(id.namespaceIndex(), guid);
+    }
+    case QOpcUaNodeId::IdentifierType::ByteString: {
+        UA_NodeId uaNodeId;
+        UA_NodeId_init(&uaNodeId);
+        uaNodeId.namespaceIndex = id.namespaceIndex();
+        uaNodeId.identifierType = UA_NODEIDTYPE_BYTESTRING;
+        const QByteArray data = id.byteStringIdentifier();
+        UA_ByteString source;
+        source.length = data.size();
+        source.data = reinterpret_cast<UA_Byte *>(const_cast<char *>(data.constData()));
+        UA_ByteString_copy(&source, &uaNodeId.identifier.byteString);
+        return uaNodeId;
+    }
+    default:
+        return UA_NODEID_NULL;
+    }
+}
+
+QOpcUaNodeId Open62541Utils::nodeIdToQOpcUaNodeId(const UA_NodeId &id)
+{
+    switch (id.identifierType) {
+    case UA_NODEIDTYPE_NUMERIC:
+        return QOpcUaNodeId(id.namespaceIndex, id.identifier.numeric);
+    case UA_NODEIDTYPE_STRING:
+        return QOpcUaNodeId(id.namespaceIndex, QString::fromUtf8(reinterpret_cast<char *>(id.identifier.string.data),
+                                                                 id.identifier.string.length));
+    case UA_NODEIDTYPE_GUID: {
+        const UA_Guid &src = id.identifier.guid;
+        return QOpcUaNodeId(id.namespaceIndex, QUuid(src.data1, src.data2, src.data3, src.data4[0], src.data4[1], src.data4[2],
+                                                     src.data4[3], src.data4[4], src.data4[5], src.data4[6], src.data4[7]));
+    }
+    case UA_NODEIDTYPE_BYTESTRING:
+        return QOpcUaNodeId(id.namespaceIndex, QByteArray(reinterpret_cast<char *>(id.identifier.byteString.data),
+                                                          id.identifier.byteString.length));
+    default:
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Open62541 Utils: Could not convert UA_NodeId to QOpcUaNodeId";
+        return QOpcUaNodeId();
+    }
+}
+
 QT_END_NAMESPACE
@@ -38,6 +38,7 @@
 #define QOPEN62541UTILS_H
 
 #include "qopen62541.h"
+#include <QtOpcUa/qopcuanodeid.h>
 
 #include <QtCore/qstring.h>
 
@@ -46,6 +47,8 @@ QT_BEGIN_NAMESPACE
 namespace Open62541Utils {
     UA_NodeId nodeIdFromQString(const QString &name);
     QString nodeIdToQString(UA_NodeId id);
+    UA_NodeId nodeIdFromQOpcUaNodeId(const QOpcUaNodeId &id);
+    QOpcUaNodeId nodeIdToQOpcUaNodeId(const UA_NodeId &id);
 }
 
 QT_END_NAMESPACE
@@ -37,10 +37,12 @@
 #include "qopen62541.h"
 #include "qopen62541utils.h"
 #include "qopen62541valueconverter.h"
+#include <private/qopcuabackend_p.h>
 
 #include <QtCore/qdatetime.h>
 #include <QtCore/qloggingcategory.h>
 #include <QtCore/quuid.h>
+#include <QtCore/qvector.h>
 
 #include <cstring>
 
@@ -48,6 +50,26 @@ QT_BEGIN_NAMESPACE
 
 Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_OPEN62541)
 
+// The variant is moved, the caller keeps an empty variant which can be freed as usual
+QOpen62541EncodedValue::QOpen62541EncodedValue(UA_Variant *value, bool typedArrays)
+    : m_value(*value)
+    , m_typedArrays(typedArrays)
+{
+    UA_Variant_init(value);
+}
+
+QOpen62541EncodedValue::~QOpen62541EncodedValue()
+{
+    UA_Variant_deleteMembers(&m_value);
+}
+
+QVariant QOpen62541EncodedValue::decode()
+{
+    const QVariant result = QOpen62541ValueConverter::toQVariant(m_value, m_typedArrays);
+    UA_Variant_deleteMembers(&m_value);
+    return result;
+}
+
 namespace QOpen62541ValueConverter {
 
 QOpcUa::Types qvariantTypeToQOpcUaType(QMetaType::Type type)
@@ -95,9 +117,44 @@ QOpcUa::Types qvariantTypeToQOpcUaType(QMetaType::Type type)
 
 UA_Variant toOpen62541Variant(const QVariant &value, QOpcUa::Types type)
 {
+    QOpcUaStatisticsCollector::ConversionTimer conversionTimer;
+
     UA_Variant open62541value;
     UA_Variant_init(&open62541value);
 
+    const QOpcUa::Types typedArrayType = QOpcUaBackend::typedArrayElementType(value.userType());
+    if (typedArrayType != QOpcUa::Undefined) {
+        // A typed array of a different type is converted element by element
+        if (type != QOpcUa::Undefined && type != typedArrayType)
+            return toOpen62541Variant(value.toList(), type);
+
+        const UA_DataType *dt = toDataType(typedArrayType);
+
+        switch (typedArrayType) {
+        case QOpcUa::SByte:
+            return typedArrayFromQVariant<UA_SByte, qint8>(value, dt);
+        case QOpcUa::Byte:
+            return typedArrayFromQVariant<UA_Byte, quint8>(value, dt);
+        case QOpcUa::Int16:
+            return typedArrayFromQVariant<UA_Int16, qint16>(value, dt);
+        case QOpcUa::UInt16:
+            return typedArrayFromQVariant<UA_UInt16, quint16>(value, dt);
+        case QOpcUa::Int32:
+            return typedArrayFromQVariant<UA_Int32, qint32>(value, dt);
+        case QOpcUa::UInt32:
+            return typedArrayFromQVariant<UA_UInt32, quint32>(value, dt);
+        case QOpcUa::Int64:
+            return typedArrayFromQVariant<UA_Int64, qint64>(value, dt);
+        case QOpcUa::UInt64:
+            return typedArrayFromQVariant<UA_UInt64, quint64>(value, dt);
+        case QOpcUa::Float:
+            return typedArrayFromQVariant<UA_Float, float>(value, dt);
+        case QOpcUa::Double:
+            return typedArrayFromQVariant<UA_Double, double>(value, dt);
+        default:
+            break;
+        }
+    }
 
     if (value.type() == QVariant::List && value.toList().size() == 0)
         return open62541value;
@@ -168,13 +225,42 @@ UA_Variant toOpen62541Variant(const QVariant &value, QOpcUa::Types type)
     return open62541value;
 }
 
-QVariant toQVariant(const UA_Variant &value)
+QVariant toQVariant(const UA_Variant &value, bool typedArrays)
 {
+    QOpcUaStatisticsCollector::ConversionTimer conversionTimer;
+
     if (value.type == nullptr) {
         qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Null variant received, unable to convert";
         return QVariant();
     }
 
+    if (typedArrays && !UA_Variant_isScalar(&value) && value.data) {
+        switch (value.type->typeIndex) {
+        case UA_TYPES_SBYTE:
+            return typedArrayToQVariant<qint8, UA_SByte>(value);
+        case UA_TYPES_BYTE:
+            return typedArrayToQVariant<quint8, UA_Byte>(value);
+        case UA_TYPES_INT16:
+            return typedArrayToQVariant<qint16, UA_Int16>(value);
+        case UA_TYPES_UINT16:
+            return typedArrayToQVariant<quint16, UA_UInt16>(value);
+        case UA_TYPES_INT32:
+            return typedArrayToQVariant<qint32, UA_Int32>(value);
+        case UA_TYPES_UINT32:
+            return typedArrayToQVariant<quint32, UA_UInt32>(value);
+        case UA_TYPES_INT64:
+            return typedArrayToQVariant<qint64, UA_Int64>(value);
+        case UA_TYPES_UINT64:
+            return typedArrayToQVariant<quint64, UA_UInt64>(value);
+        case UA_TYPES_FLOAT:
+            return typedArrayToQVariant<float, UA_Float>(value);
+        case UA_TYPES_DOUBLE:
+            return typedArrayToQVariant<double, UA_Double>(value);
+        default:
+            break;
+        }
+    }
+
     switch (value.type->typeIndex) {
     case UA_TYPES_BOOLEAN:
         return arrayToQVariant<bool, UA_Boolean>(value, QMetaType::Bool);
@@ -432,6 +518,17 @@ QVariant arrayToQVariant(const UA_Variant &var, QMetaType::Type type)
     return QVariant(); // Return empty QVariant for empty scalar variant
 }
 
+template<typename TARGETTYPE, typename UATYPE>
+QVariant typedArrayToQVariant(const UA_Variant &var)
+{
+    Q_STATIC_ASSERT(sizeof(TARGETTYPE) == sizeof(UATYPE));
+
+    QVector<TARGETTYPE> result(static_cast<int>(var.arrayLength));
+    if (var.arrayLength > 0)
+        std::memcpy(result.data(), var.data, var.arrayLength * sizeof(UATYPE));
+    return QVariant::fromValue(result);
+}
+
 template<typename TARGETTYPE, typename QTTYPE>
 void scalarFromQVariant(const QVariant &var, TARGETTYPE *ptr)
 {
@@ -580,6 +677,24 @@ UA_Variant arrayFromQVariant(const QVariant &var, const UA_DataType *type)
     return open62541value;
 }
 
+template<typename TARGETTYPE, typename QTTYPE>
+UA_Variant typedArrayFromQVariant(const QVariant &var, const UA_DataType *type)
+{
+    Q_STATIC_ASSERT(sizeof(TARGETTYPE) == sizeof(QTTYPE));
+
+    UA_Variant open62541value;
+    UA_Variant_init(&open62541value);
+
+    const QVector<QTTYPE> vec = var.value<QVector<QTTYPE>>();
+    if (vec.isEmpty())
+        return open62541value;
+
+    TARGETTYPE *arr = static_cast<TARGETTYPE *>(UA_Array_new(vec.size(), type));
+    std::memcpy(arr, vec.constData(), vec.size() * sizeof(TARGETTYPE));
+    UA_Variant_setArray(&open62541value, arr, vec.size(), type);
+    return open62541value;
+}
+
 void createExtensionObject(QByteArray &data, QOpcUaBinaryDataEncoding::TypeEncodingId id, UA_ExtensionObject *ptr)
 {
     UA_ExtensionObject obj;
@@ -41,11 +41,27 @@
 #include <QtOpcUa/qopcuanode.h>
 #include <QtOpcUa/qopcuatype.h>
 #include <private/qopcuabinarydataencoding_p.h>
+#include <private/qopcuaencodedvalue_p.h>
 
 #include <QtCore/qvariant.h>
 
 QT_BEGIN_NAMESPACE
 
+// Takes ownership of the data of a received variant and converts it on first access
+class QOpen62541EncodedValue : public QOpcUaEncodedValue
+{
+public:
+    QOpen62541EncodedValue(UA_Variant *value, bool typedArrays);
+    ~QOpen62541EncodedValue() override;
+
+protected:
+    QVariant decode() override;
+
+private:
+    UA_Variant m_value;
+    bool m_typedArrays;
+};
+
 namespace QOpen62541ValueConverter {
     QOpcUa::Types qvariantTypeToQOpcUaType(QVariant::Type type);
 
@@ -60,7 +76,7 @@ namespace QOpen62541ValueConverter {
     }
 
     UA_Variant toOpen62541Variant(const QVariant&, QOpcUa::Types);
-    QVariant toQVariant(const UA_Variant&);
+    QVariant toQVariant(const UA_Variant&, bool typedArrays = false);
     const UA_DataType *toDataType(QOpcUa::Types valueType);
     QOpcUa::Types qvariantTypeToQOpcUaType(QMetaType::Type type);
 
@@ -76,6 +92,12 @@ namespace QOpen62541ValueConverter {
     template<typename TARGETTYPE, typename QTTYPE>
     UA_Variant arrayFromQVariant(const QVariant &var, const UA_DataType *type);
 
+    template<typename TARGETTYPE, typename UATYPE>
+    QVariant typedArrayToQVariant(const UA_Variant &var);
+
+    template<typename TARGETTYPE, typename QTTYPE>
+    UA_Variant typedArrayFromQVariant(const QVariant &var, const UA_DataType *type);
+
     void createExtensionObject(QByteArray &data, QOpcUaBinaryDataEncoding::TypeEncodingId id, UA_ExtensionObject *ptr);
 
     QDateTime uaDateTimeToQDateTime(UA_DateTime dt);
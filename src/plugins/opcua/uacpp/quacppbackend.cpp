@@ -58,6 +58,8 @@ UACppAsyncBackend::UACppAsyncBackend(QUACppClient *parent)
     : QOpcUaBackend()
     , m_clientImpl(parent)
     , m_minPublishingInterval(0)
+    , m_maxNodesPerRead(defaultMaxOperationsPerRequest())
+    , m_maxNodesPerWrite(defaultMaxOperationsPerRequest())
 {
     QMutexLocker locker(&m_lifecycleMutex);
     if (!m_platformLayerInitialized) {
@@ -121,7 +123,20 @@ void UACppAsyncBackend::connectionStatusChanged(OpcUa_UInt32 clientConnectionId,
     }
 }
 
-void UACppAsyncBackend::browseChildren(uintptr_t handle, const UaNodeId &id, QOpcUa::ReferenceTypeId referenceType, QOpcUa::NodeClasses nodeClassMask)
+static QOpcUaReferenceDescription convertReferenceDescription(const OpcUa_ReferenceDescription &src)
+{
+    QOpcUaReferenceDescription temp;
+    temp.setNodeId(UACppUtils::nodeIdToQString(src.NodeId.NodeId));
+    temp.setRefType(static_cast<QOpcUa::ReferenceTypeId>(UaNodeId(src.ReferenceTypeId).identifierNumeric()));
+    temp.setNodeClass(static_cast<QOpcUa::NodeClass>(src.NodeClass));
+    temp.setBrowseName(QUACppValueConverter::scalarToQVariant<QOpcUa::QQualifiedName, OpcUa_QualifiedName>(
+                           &src.BrowseName, QMetaType::Type::UnknownType).value<QOpcUa::QQualifiedName>());
+    temp.setDisplayName(QUACppValueConverter::scalarToQVariant<QOpcUa::QLocalizedText, OpcUa_LocalizedText>(
+                            &src.DisplayName, QMetaType::Type::UnknownType).value<QOpcUa::QLocalizedText>());
+    return temp;
+}
+
+void UACppAsyncBackend::browseChildren(quint64 handle, const UaNodeId &id, QOpcUa::ReferenceTypeId referenceType, QOpcUa::NodeClasses nodeClassMask)
 {
     UaStatus status;
     ServiceSettings serviceSettings;
@@ -134,11 +149,16 @@ void UACppAsyncBackend::browseChildren(uintptr_t handle, const UaNodeId &id, QOp
 
     QStringList result;
     QVector<QOpcUaReferenceDescription> ret;
-    status = m_nativeSession->browse(serviceSettings, id, browseContext, continuationPoint, referenceDescriptions);
+    {
+        QOpcUaStatisticsCollector::ServiceTimer timer(statistics(), QOpcUaClientStatistics::Service::Browse);
+        status = m_nativeSession->browse(serviceSettings, id, browseContext, continuationPoint, referenceDescriptions);
+    }
     bool initialBrowse = true;
     do {
-        if (!initialBrowse)
+        if (!initialBrowse) {
+            QOpcUaStatisticsCollector::ServiceTimer timer(statistics(), QOpcUaClientStatistics::Service::Browse);
             status = m_nativeSession->browseNext(serviceSettings, OpcUa_False, continuationPoint, referenceDescriptions);
+        }
 
         if (status.isBad()) {
             qCWarning(QT_OPCUA_PLUGINS_UACPP) << "Could not browse children.";
@@ -152,22 +172,80 @@ void UACppAsyncBackend::browseChildren(uintptr_t handle, const UaNodeId &id, QOp
             const UaNodeId id(referenceDescriptions[i].NodeId.NodeId);
             const UaString uastr(id.toXmlString());
             result.append(QString::fromUtf8(uastr.toUtf8(), uastr.size()));
-
-            QOpcUaReferenceDescription temp;
-            temp.setNodeId(UACppUtils::nodeIdToQString(referenceDescriptions[i].NodeId.NodeId));
-            temp.setRefType(static_cast<QOpcUa::ReferenceTypeId>(UaNodeId(referenceDescriptions[i].ReferenceTypeId).identifierNumeric()));
-            temp.setNodeClass(static_cast<QOpcUa::NodeClass>(referenceDescriptions[i].NodeClass));
-            temp.setBrowseName(QUACppValueConverter::scalarToQVariant<QOpcUa::QQualifiedName, OpcUa_QualifiedName>(
-                                   &referenceDescriptions[i].BrowseName, QMetaType::Type::UnknownType).value<QOpcUa::QQualifiedName>());
-            temp.setDisplayName(QUACppValueConverter::scalarToQVariant<QOpcUa::QLocalizedText, OpcUa_LocalizedText>(
-                                    &referenceDescriptions[i].DisplayName, QMetaType::Type::UnknownType).value<QOpcUa::QLocalizedText>());
-            ret.append(temp);
+            ret.append(convertReferenceDescription(referenceDescriptions[i]));
         }
     } while (continuationPoint.length() > 0);
 
     emit browseFinished(handle, ret, static_cast<QOpcUa::UaStatusCode>(status.statusCode()));
 }
 
+void UACppAsyncBackend::browseRecursive(QString rootNodeId, QOpcUa::ReferenceTypeId referenceType, QOpcUa::NodeClasses nodeClassMask, int maxDepth)
+{
+    ServiceSettings serviceSettings;
+    BrowseContext browseContext;
+    browseContext.referenceTypeId = UaNodeId(static_cast<OpcUa_UInt32>(referenceType));
+    browseContext.nodeClassMask = nodeClassMask;
+
+    QOpcUa::UaStatusCode statusCode = QOpcUa::UaStatusCode::Good;
+    QSet<QString> visited;
+    visited.insert(rootNodeId);
+    QQueue<QPair<QString, int>> nodesToBrowse; // Node id and depth below the root node
+    nodesToBrowse.enqueue(qMakePair(rootNodeId, 0));
+
+    // UaSession::browse() only accepts a single node, the results are reported for each node
+    while (!nodesToBrowse.isEmpty()) {
+        const QPair<QString, int> current = nodesToBrowse.dequeue();
+        const bool browseChildren = maxDepth < 0 || current.second + 1 < maxDepth;
+
+        UaByteString continuationPoint;
+        UaReferenceDescriptions referenceDescriptions;
+        QVector<QOpcUaReferenceDescription> ret;
+
+        UaStatus status;
+        {
+            QOpcUaStatisticsCollector::ServiceTimer timer(statistics(), QOpcUaClientStatistics::Service::Browse);
+            status = m_nativeSession->browse(serviceSettings, UACppUtils::nodeIdFromQString(current.first),
+                                             browseContext, continuationPoint, referenceDescriptions);
+        }
+        bool initialBrowse = true;
+        do {
+            if (!initialBrowse) {
+                QOpcUaStatisticsCollector::ServiceTimer timer(statistics(), QOpcUaClientStatistics::Service::Browse);
+                status = m_nativeSession->browseNext(serviceSettings, OpcUa_False, continuationPoint, referenceDescriptions);
+            }
+
+            if (status.isBad()) {
+                qCWarning(QT_OPCUA_PLUGINS_UACPP) << "Could not browse children of" << current.first;
+                if (statusCode == QOpcUa::UaStatusCode::Good)
+                    statusCode = static_cast<QOpcUa::UaStatusCode>(status.statusCode());
+                break;
+            }
+
+            initialBrowse = false;
+
+            for (quint32 i = 0; i < referenceDescriptions.length(); ++i) {
+                QOpcUaReferenceDescription temp = convertReferenceDescription(referenceDescriptions[i]);
+                temp.setParentNodeId(current.first);
+                ret.append(temp);
+
+                // Nodes on other servers can't be browsed with this session
+                const OpcUa_ExpandedNodeId &target = referenceDescriptions[i].NodeId;
+                if (!browseChildren || target.ServerIndex != 0 || !OpcUa_String_IsEmpty(&target.NamespaceUri))
+                    continue;
+                if (!visited.contains(temp.nodeId())) {
+                    visited.insert(temp.nodeId());
+                    nodesToBrowse.enqueue(qMakePair(temp.nodeId(), current.second + 1));
+                }
+            }
+        } while (continuationPoint.length() > 0);
+
+        if (!ret.isEmpty())
+            emit browseRecursiveResultsAvailable(rootNodeId, ret);
+    }
+
+    emit browseRecursiveFinished(rootNodeId, statusCode);
+}
+
 void UACppAsyncBackend::connectToEndpoint(const QUrl &url)
 {
     UaStatus result;
@@ -229,7 +307,7 @@ inline OpcUa_UInt32 toUaAttributeId(QOpcUa::NodeAttribute attr)
     return static_cast<OpcUa_UInt32>(0);
 }
 
-void UACppAsyncBackend::readAttributes(uintptr_t handle, const UaNodeId &id, QOpcUa::NodeAttributes attr, QString indexRange)
+void UACppAsyncBackend::readAttributes(quint64 handle, const UaNodeId &id, QOpcUa::NodeAttributes attr, QString indexRange)
 {
     UaStatus result;
 
@@ -256,27 +334,109 @@ void UACppAsyncBackend::readAttributes(uintptr_t handle, const UaNodeId &id, QOp
         vec.push_back(temp);
     });
 
-    result = m_nativeSession->read(settings,
-                                   0,
-                                   OpcUa_TimestampsToReturn_Both,
-                                   nodeToRead,
-                                   values,
-                                   diagnosticInfos);
+    {
+        QOpcUaStatisticsCollector::ServiceTimer timer(statistics(), QOpcUaClientStatistics::Service::Read);
+        result = m_nativeSession->read(settings,
+                                       0,
+                                       OpcUa_TimestampsToReturn_Both,
+                                       nodeToRead,
+                                       values,
+                                       diagnosticInfos);
+    }
     if (result.isBad()) {
         qCWarning(QT_OPCUA_PLUGINS_UACPP) << "Reading attributes failed:" << result.toString().toUtf8();
     } else {
         for (int i = 0; i < vec.size(); ++i) {
             vec[i].statusCode = static_cast<QOpcUa::UaStatusCode>(values[i].StatusCode);
-            vec[i].value = QUACppValueConverter::toQVariant(values[i].Value);
-            vec[i].serverTimestamp = QUACppValueConverter::toQDateTime(&values[i].ServerTimestamp);
-            vec[i].sourceTimestamp = QUACppValueConverter::toQDateTime(&values[i].SourceTimestamp);
+            vec[i].value = QUACppValueConverter::toQVariant(values[i].Value, typedArraysEnabled());
+            vec[i].serverTimestamp = QUACppValueConverter::toTicks(values[i].ServerTimestamp);
+            vec[i].sourceTimestamp = QUACppValueConverter::toTicks(values[i].SourceTimestamp);
         }
     }
 
     emit attributesRead(handle, vec, static_cast<QOpcUa::UaStatusCode>(result.statusCode()));
 }
 
-void UACppAsyncBackend::writeAttribute(uintptr_t handle, const UaNodeId &id, QOpcUa::NodeAttribute attrId, QVariant value, QOpcUa::Types type, QString indexRange)
+void UACppAsyncBackend::readNodeAttributes(QVector<QOpcUaReadItem> nodesToRead)
+{
+    QVector<UaNodeId> nodeIds;
+    QVector<QOpcUaReadItemResult> results;
+
+    for (const QOpcUaReadItem &item : qAsConst(nodesToRead)) {
+        const UaNodeId id = UACppUtils::nodeIdFromQString(item.nodeId());
+        qt_forEachAttribute(item.attributes(), [&](QOpcUa::NodeAttribute attribute) {
+            nodeIds.push_back(id);
+            QOpcUaReadItemResult temp;
+            temp.setNodeId(item.nodeId());
+            temp.setAttribute(attribute);
+            temp.setIndexRange(item.indexRange());
+            results.push_back(temp);
+        });
+    }
+
+    QOpcUa::UaStatusCode serviceResult = QOpcUa::UaStatusCode::Good;
+
+    // Split the request if it exceeds the number of operations accepted by the server
+    for (int offset = 0; offset < results.size();) {
+        const int chunkSize = qMin(m_maxNodesPerRead, results.size() - offset);
+
+        ServiceSettings settings;
+        UaReadValueIds nodeToRead;
+        UaDataValues values;
+        UaDiagnosticInfos diagnosticInfos;
+
+        nodeToRead.create(chunkSize);
+        for (int i = 0; i < chunkSize; ++i) {
+            const QOpcUaReadItemResult &item = results.at(offset + i);
+            nodeIds.at(offset + i).copyTo(&nodeToRead[i].NodeId);
+            nodeToRead[i].AttributeId = toUaAttributeId(item.attribute());
+            if (item.indexRange().size()) {
+                UaString ir(item.indexRange().toUtf8().constData());
+                ir.copyTo(&nodeToRead[i].IndexRange);
+            }
+        }
+
+        UaStatus result;
+        {
+            QOpcUaStatisticsCollector::ServiceTimer timer(statistics(), QOpcUaClientStatistics::Service::Read);
+            result = m_nativeSession->read(settings,
+                                           0,
+                                           OpcUa_TimestampsToReturn_Both,
+                                           nodeToRead,
+                                           values,
+                                           diagnosticInfos);
+        }
+
+        if (result.statusCode() == OpcUa_BadTooManyOperations && chunkSize > 1) {
+            m_maxNodesPerRead = chunkSize / 2;
+            continue;
+        }
+
+        if (result.isBad()) {
+            qCWarning(QT_OPCUA_PLUGINS_UACPP) << "Reading node attributes failed:" << result.toString().toUtf8();
+            if (serviceResult == QOpcUa::UaStatusCode::Good)
+                serviceResult = static_cast<QOpcUa::UaStatusCode>(result.statusCode());
+        }
+
+        for (int i = 0; i < chunkSize; ++i) {
+            QOpcUaReadItemResult &item = results[offset + i];
+            if (result.isBad() || static_cast<quint32>(i) >= values.length()) {
+                item.setStatusCode(static_cast<QOpcUa::UaStatusCode>(result.isBad() ? result.statusCode() : OpcUa_BadUnexpectedError));
+                continue;
+            }
+            item.setStatusCode(static_cast<QOpcUa::UaStatusCode>(values[i].StatusCode));
+            item.setValue(QUACppValueConverter::toQVariant(values[i].Value, typedArraysEnabled()));
+            item.setRawServerTimestamp(QUACppValueConverter::toTicks(values[i].ServerTimestamp));
+            item.setRawSourceTimestamp(QUACppValueConverter::toTicks(values[i].SourceTimestamp));
+        }
+
+        offset += chunkSize;
+    }
+
+    emit readNodeAttributesFinished(results, serviceResult);
+}
+
+void UACppAsyncBackend::writeAttribute(quint64 handle, const UaNodeId &id, QOpcUa::NodeAttribute attrId, QVariant value, QOpcUa::Types type, QString indexRange)
 {
     if (type == QOpcUa::Types::Undefined && attrId != QOpcUa::NodeAttribute::Value)
         type = attributeIdToTypeId(attrId);
@@ -295,7 +455,10 @@ void UACppAsyncBackend::writeAttribute(uintptr_t handle, const UaNodeId &id, QOp
         UaString ir(indexRange.toUtf8());
         ir.copyTo(&nodesToWrite[0].IndexRange);
     }
-    result = m_nativeSession->write(settings, nodesToWrite, writeResults, diagnosticInfos);
+    {
+        QOpcUaStatisticsCollector::ServiceTimer timer(statistics(), QOpcUaClientStatistics::Service::Write);
+        result = m_nativeSession->write(settings, nodesToWrite, writeResults, diagnosticInfos);
+    }
 
     if (result.isBad())
         qCWarning(QT_OPCUA_PLUGINS_UACPP) << "Writing attribute failed:" << result.toString().toUtf8();
@@ -304,7 +467,7 @@ void UACppAsyncBackend::writeAttribute(uintptr_t handle, const UaNodeId &id, QOp
                               static_cast<QOpcUa::UaStatusCode>(writeResults[0]) : static_cast<QOpcUa::UaStatusCode>(result.statusCode()));
 }
 
-void UACppAsyncBackend::writeAttributes(uintptr_t handle, const UaNodeId &id, QOpcUaNode::AttributeMap toWrite, QOpcUa::Types valueAttributeType)
+void UACppAsyncBackend::writeAttributes(quint64 handle, const UaNodeId &id, QOpcUaNode::AttributeMap toWrite, QOpcUa::Types valueAttributeType)
 {
     if (toWrite.size() == 0) {
         qCWarning(QT_OPCUA_PLUGINS_UACPP, "No values to be written");
@@ -329,7 +492,10 @@ void UACppAsyncBackend::writeAttributes(uintptr_t handle, const UaNodeId &id, QO
         nodesToWrite[index].Value.Value = QUACppValueConverter::toUACppVariant(it.value(), type);
     }
 
-    result = m_nativeSession->write(settings, nodesToWrite, writeResults, diagnosticInfos);
+    {
+        QOpcUaStatisticsCollector::ServiceTimer timer(statistics(), QOpcUaClientStatistics::Service::Write);
+        result = m_nativeSession->write(settings, nodesToWrite, writeResults, diagnosticInfos);
+    }
 
     if (result.isBad())
         qCWarning(QT_OPCUA_PLUGINS_UACPP) << "Writing attribute failed:" << result.toString().toUtf8();
@@ -342,7 +508,75 @@ void UACppAsyncBackend::writeAttributes(uintptr_t handle, const UaNodeId &id, QO
     }
 }
 
-void UACppAsyncBackend::enableMonitoring(uintptr_t handle, const UaNodeId &id, QOpcUa::NodeAttributes attr, const QOpcUaMonitoringParameters &settings)
+void UACppAsyncBackend::writeNodeAttributes(QVector<QOpcUaWriteItem> nodesToWrite)
+{
+    QVector<QOpcUaWriteItemResult> results;
+    results.reserve(nodesToWrite.size());
+
+    for (const QOpcUaWriteItem &item : qAsConst(nodesToWrite)) {
+        QOpcUaWriteItemResult temp;
+        temp.setNodeId(item.nodeId());
+        temp.setAttribute(item.attribute());
+        temp.setIndexRange(item.indexRange());
+        results.push_back(temp);
+    }
+
+    QOpcUa::UaStatusCode serviceResult = QOpcUa::UaStatusCode::Good;
+
+    // Split the request if it exceeds the number of operations accepted by the server
+    for (int offset = 0; offset < nodesToWrite.size();) {
+        const int chunkSize = qMin(m_maxNodesPerWrite, nodesToWrite.size() - offset);
+
+        ServiceSettings settings;
+        UaWriteValues writeValues;
+        UaStatusCodeArray writeResults;
+        UaDiagnosticInfos diagnosticInfos;
+
+        writeValues.create(chunkSize);
+        for (int i = 0; i < chunkSize; ++i) {
+            const QOpcUaWriteItem &item = nodesToWrite.at(offset + i);
+            QOpcUa::Types type = item.type();
+            if (type == QOpcUa::Types::Undefined && item.attribute() != QOpcUa::NodeAttribute::Value)
+                type = attributeIdToTypeId(item.attribute());
+
+            UACppUtils::nodeIdFromQString(item.nodeId()).copyTo(&writeValues[i].NodeId);
+            writeValues[i].AttributeId = QUACppValueConverter::toUaAttributeId(item.attribute());
+            writeValues[i].Value.Value = QUACppValueConverter::toUACppVariant(item.value(), type);
+            if (item.indexRange().size()) {
+                UaString ir(item.indexRange().toUtf8().constData());
+                ir.copyTo(&writeValues[i].IndexRange);
+            }
+        }
+
+        UaStatus result;
+        {
+            QOpcUaStatisticsCollector::ServiceTimer timer(statistics(), QOpcUaClientStatistics::Service::Write);
+            result = m_nativeSession->write(settings, writeValues, writeResults, diagnosticInfos);
+        }
+
+        if (result.statusCode() == OpcUa_BadTooManyOperations && chunkSize > 1) {
+            m_maxNodesPerWrite = chunkSize / 2;
+            continue;
+        }
+
+        if (result.isBad()) {
+            qCWarning(QT_OPCUA_PLUGINS_UACPP) << "Writing node attributes failed:" << result.toString().toUtf8();
+            if (serviceResult == QOpcUa::UaStatusCode::Good)
+                serviceResult = static_cast<QOpcUa::UaStatusCode>(result.statusCode());
+        }
+
+        for (int i = 0; i < chunkSize; ++i) {
+            const OpcUa_StatusCode status = static_cast<quint32>(i) < writeResults.length() ? writeResults[i] : result.statusCode();
+            results[offset + i].setStatusCode(static_cast<QOpcUa::UaStatusCode>(status));
+        }
+
+        offset += chunkSize;
+    }
+
+    emit writeNodeAttributesFinished(nodesToWrite, results, serviceResult);
+}
+
+void UACppAsyncBackend::enableMonitoring(quint64 handle, const UaNodeId &id, QOpcUa::NodeAttributes attr, const QOpcUaMonitoringParameters &settings)
 {
     QUACppSubscription *usedSubscription = nullptr;
 
@@ -391,7 +625,7 @@ void UACppAsyncBackend::enableMonitoring(uintptr_t handle, const UaNodeId &id, Q
         removeSubscription(usedSubscription->subscriptionId()); // No items were added
 }
 
-void UACppAsyncBackend::modifyMonitoring(uintptr_t handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value)
+void UACppAsyncBackend::modifyMonitoring(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value)
 {
     QUACppSubscription *subscription = getSubscriptionForItem(handle, attr);
     if (!subscription) {
@@ -405,7 +639,7 @@ void UACppAsyncBackend::modifyMonitoring(uintptr_t handle, QOpcUa::NodeAttribute
     subscription->modifyMonitoring(handle, attr, item, value);
 }
 
-void UACppAsyncBackend::disableMonitoring(uintptr_t handle, QOpcUa::NodeAttributes attr)
+void UACppAsyncBackend::disableMonitoring(quint64 handle, QOpcUa::NodeAttributes attr)
 {
     qt_forEachAttribute(attr, [&](QOpcUa::NodeAttribute attribute){
         QUACppSubscription *sub = getSubscriptionForItem(handle, attribute);
@@ -417,7 +651,29 @@ void UACppAsyncBackend::disableMonitoring(uintptr_t handle, QOpcUa::NodeAttribut
     });
 }
 
-void UACppAsyncBackend::callMethod(uintptr_t handle, const UaNodeId &objectId, const UaNodeId &methodId, QVector<QOpcUa::TypedVariant> args)
+void UACppAsyncBackend::enableMonitoringForNodes(QVector<QOpcUaNodeHandle> nodes, QOpcUa::NodeAttributes attr, QOpcUaMonitoringParameters settings)
+{
+    for (const QOpcUaNodeHandle &node : qAsConst(nodes)) {
+        const UaNodeId id = UACppUtils::nodeIdFromQString(node.nodeId);
+        if (id.isNull()) {
+            QOpcUaMonitoringParameters s;
+            s.setStatusCode(QOpcUa::UaStatusCode::BadNodeIdInvalid);
+            qt_forEachAttribute(attr, [&](QOpcUa::NodeAttribute attribute){
+                emit monitoringEnableDisable(node.handle, attribute, true, s);
+            });
+            continue;
+        }
+        enableMonitoring(node.handle, id, attr, settings);
+    }
+}
+
+void UACppAsyncBackend::disableMonitoringForNodes(QVector<QOpcUaNodeHandle> nodes, QOpcUa::NodeAttributes attr)
+{
+    for (const QOpcUaNodeHandle &node : qAsConst(nodes))
+        disableMonitoring(node.handle, attr);
+}
+
+void UACppAsyncBackend::callMethod(quint64 handle, const UaNodeId &objectId, const UaNodeId &methodId, QVector<QOpcUa::TypedVariant> args)
 {
     ServiceSettings settings;
     CallIn in;
@@ -433,7 +689,11 @@ void UACppAsyncBackend::callMethod(uintptr_t handle, const UaNodeId &objectId, c
 
     CallOut out;
 
-    UaStatus status = m_nativeSession->call(settings, in, out);
+    UaStatus status;
+    {
+        QOpcUaStatisticsCollector::ServiceTimer timer(statistics(), QOpcUaClientStatistics::Service::Call);
+        status = m_nativeSession->call(settings, in, out);
+    }
     if (status.isBad())
         qCWarning(QT_OPCUA_PLUGINS_UACPP) << "Calling method failed";
 
@@ -445,10 +705,10 @@ void UACppAsyncBackend::callMethod(uintptr_t handle, const UaNodeId &objectId, c
     if (out.outputArguments.length() > 1) {
         QVariantList resultList;
         for (quint32 i = 0; i < out.outputArguments.length(); ++i)
-            resultList.append(QUACppValueConverter::toQVariant(out.outputArguments[i]));
+            resultList.append(QUACppValueConverter::toQVariant(out.outputArguments[i], typedArraysEnabled()));
         result = resultList;
     } else if (out.outputArguments.length() == 1) {
-        result = QUACppValueConverter::toQVariant(out.outputArguments[0]);
+        result = QUACppValueConverter::toQVariant(out.outputArguments[0], typedArraysEnabled());
     }
 
     emit methodCallFinished(handle, UACppUtils::nodeIdToQString(methodId), result, static_cast<QOpcUa::UaStatusCode>(status.statusCode()));
@@ -477,7 +737,7 @@ QUACppSubscription *UACppAsyncBackend::getSubscription(const QOpcUaMonitoringPar
     return sub;
 }
 
-QUACppSubscription *UACppAsyncBackend::getSubscriptionForItem(uintptr_t handle, QOpcUa::NodeAttribute attr)
+QUACppSubscription *UACppAsyncBackend::getSubscriptionForItem(quint64 handle, QOpcUa::NodeAttribute attr)
 {
     auto entriesForHandle = m_attributeMapping.find(handle);
     if (entriesForHandle == m_attributeMapping.end())
@@ -24,6 +24,7 @@
 #include "quacppnode.h"
 #include "quacpputils.h"
 
+#include <private/qopcuabackendthreadpool_p.h>
 #include <private/qopcuaclient_p.h>
 
 #include <QtCore/QLoggingCategory>
@@ -40,18 +41,17 @@ QUACppClient::QUACppClient()
     : QOpcUaClientImpl()
     , m_backend(new UACppAsyncBackend(this))
 {
-    m_thread = new QThread();
+    // All SDK calls of the backend are synchronous and would block other clients on a shared thread
+    m_thread = QOpcUaBackendThreadPool::instance()->acquireThread(QOpcUaBackendThreadPool::ThreadType::Dedicated);
     connectBackendWithClient(m_backend);
     m_backend->moveToThread(m_thread);
-    connect(m_thread, &QThread::finished, m_thread, &QObject::deleteLater);
-    connect(m_thread, &QThread::finished, m_backend, &QObject::deleteLater);
-    m_thread->start();
 }
 
 QUACppClient::~QUACppClient()
 {
-    if (m_thread->isRunning())
-        m_thread->quit();
+    // The backend is deleted in its thread, which may be shared with other clients
+    m_backend->deleteLater();
+    QOpcUaBackendThreadPool::instance()->releaseThread(m_thread);
 }
 
 void QUACppClient::connectToEndpoint(const QUrl &url)
@@ -77,4 +77,48 @@ QString QUACppClient::backend() const
     return QStringLiteral("uacpp");
 }
 
+bool QUACppClient::readNodeAttributes(const QVector<QOpcUaReadItem> &nodesToRead)
+{
+    return QMetaObject::invokeMethod(m_backend, "readNodeAttributes", Qt::QueuedConnection,
+                                     Q_ARG(QVector<QOpcUaReadItem>, nodesToRead));
+}
+
+bool QUACppClient::writeNodeAttributes(const QVector<QOpcUaWriteItem> &nodesToWrite)
+{
+    return QMetaObject::invokeMethod(m_backend, "writeNodeAttributes", Qt::QueuedConnection,
+                                     Q_ARG(QVector<QOpcUaWriteItem>, nodesToWrite));
+}
+
+bool QUACppClient::enableMonitoring(const QVector<QOpcUaNodeHandle> &nodes, QOpcUa::NodeAttributes attr,
+                                    const QOpcUaMonitoringParameters &settings)
+{
+    return QMetaObject::invokeMethod(m_backend, "enableMonitoringForNodes", Qt::QueuedConnection,
+                                     Q_ARG(QVector<QOpcUaNodeHandle>, nodes),
+                                     Q_ARG(QOpcUa::NodeAttributes, attr),
+                                     Q_ARG(QOpcUaMonitoringParameters, settings));
+}
+
+bool QUACppClient::disableMonitoring(const QVector<QOpcUaNodeHandle> &nodes, QOpcUa::NodeAttributes attr)
+{
+    return QMetaObject::invokeMethod(m_backend, "disableMonitoringForNodes", Qt::QueuedConnection,
+                                     Q_ARG(QVector<QOpcUaNodeHandle>, nodes),
+                                     Q_ARG(QOpcUa::NodeAttributes, attr));
+}
+
+bool QUACppClient::setTypedArraysEnabled(bool enabled)
+{
+    return QMetaObject::invokeMethod(m_backend, "setTypedArraysEnabled", Qt::QueuedConnection,
+                                     Q_ARG(bool, enabled));
+}
+
+bool QUACppClient::browseRecursive(const QString &rootNodeId, QOpcUa::ReferenceTypeId referenceType,
+                                   QOpcUa::NodeClasses nodeClassMask, int maxDepth)
+{
+    return QMetaObject::invokeMethod(m_backend, "browseRecursive", Qt::QueuedConnection,
+                                     Q_ARG(QString, rootNodeId),
+                                     Q_ARG(QOpcUa::ReferenceTypeId, referenceType),
+                                     Q_ARG(QOpcUa::NodeClasses, nodeClassMask),
+                                     Q_ARG(int, maxDepth));
+}
+
 QT_END_NAMESPACE
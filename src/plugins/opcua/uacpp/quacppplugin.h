@@ -32,7 +32,7 @@ class QUACppPlugin : public QOpcUaPlugin
 {
     Q_OBJECT
 
-    Q_PLUGIN_METADATA(IID "org.qt-project.qt.opcua.providerfactory/1.0" FILE "uacpp-metadata.json")
+    Q_PLUGIN_METADATA(IID "org.qt-project.qt.opcua.providerfactory/1.1" FILE "uacpp-metadata.json")
     Q_INTERFACES(QOpcUaPlugin)
 
 public:
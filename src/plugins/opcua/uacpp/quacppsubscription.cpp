@@ -80,16 +80,18 @@ bool QUACppSubscription::removeOnServer()
     UaStatus result;
     ServiceSettings settings;
 
+    const quint32 subscriptionId = m_nativeSubscription->subscriptionId();
     result = m_backend->m_nativeSession->deleteSubscription(settings, &m_nativeSubscription);
     if (result.isBad()) {
         qCWarning(QT_OPCUA_PLUGINS_UACPP) << "Failed to delete subscription:";
         return false;
     }
+    m_backend->statistics().subscriptionRemoved(subscriptionId);
     m_nativeSubscription = nullptr;
     return true;
 }
 
-bool QUACppSubscription::addAttributeMonitoredItem(uintptr_t handle, QOpcUa::NodeAttribute attr, const UaNodeId &id, QOpcUaMonitoringParameters parameters)
+bool QUACppSubscription::addAttributeMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr, const UaNodeId &id, QOpcUaMonitoringParameters parameters)
 {
     qCDebug(QT_OPCUA_PLUGINS_UACPP) << "Adding monitored Item: " << handle << ":" << attr;
     static quint32 monitorId = 100;
@@ -114,8 +116,11 @@ bool QUACppSubscription::addAttributeMonitoredItem(uintptr_t handle, QOpcUa::Nod
     if (parameters.filter().type() == QVariant::UserType && parameters.filter().userType() == QMetaType::type("QOpcUaMonitoringParameters::DataChangeFilter"))
         createRequests[0].RequestedParameters.Filter = createFilter(parameters.filter());
 
-    result = m_nativeSubscription->createMonitoredItems(settings, OpcUa_TimestampsToReturn_Both,
-                                                        createRequests, createResults);
+    {
+        QOpcUaStatisticsCollector::ServiceTimer timer(m_backend->statistics(), QOpcUaClientStatistics::Service::CreateMonitoredItems);
+        result = m_nativeSubscription->createMonitoredItems(settings, OpcUa_TimestampsToReturn_Both,
+                                                            createRequests, createResults);
+    }
 
     OpcUa_MonitoredItemCreateRequest_Clear(&createRequests[0]); // The C++ destructor does not free the members of the requests
 
@@ -148,7 +153,7 @@ bool QUACppSubscription::addAttributeMonitoredItem(uintptr_t handle, QOpcUa::Nod
     return true;
 }
 
-void QUACppSubscription::modifyMonitoring(uintptr_t handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value)
+void QUACppSubscription::modifyMonitoring(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value)
 {
     QOpcUaMonitoringParameters p;
     p.setStatusCode(QOpcUa::UaStatusCode::BadNotImplemented);
@@ -228,11 +233,11 @@ void QUACppSubscription::modifyMonitoring(uintptr_t handle, QOpcUa::NodeAttribut
     emit m_backend->monitoringStatusChanged(handle, attr, item, p);
 }
 
-bool QUACppSubscription::removeAttributeMonitoredItem(uintptr_t handle, QOpcUa::NodeAttribute attr)
+bool QUACppSubscription::removeAttributeMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr)
 {
     qCDebug(QT_OPCUA_PLUGINS_UACPP) << "Removing monitored Item: " << handle << ":" << attr;
 
-    const QPair<uintptr_t, QOpcUa::NodeAttribute> pair(handle, attr);
+    const QPair<quint64, QOpcUa::NodeAttribute> pair(handle, attr);
     if (!m_monitoredItems.contains(pair)) {
         qCWarning(QT_OPCUA_PLUGINS_UACPP) << "Trying to remove unknown monitored item:" << handle << ":" << attr;
         return false;
@@ -296,21 +301,35 @@ void QUACppSubscription::dataChange(OpcUa_UInt32 clientSubscriptionHandle, const
     Q_UNUSED(diagnosticInfos);
     qCDebug(QT_OPCUA_PLUGINS_UACPP) << "Data Change on:" << clientSubscriptionHandle << ":" << m_nativeSubscription->subscriptionId();
 
+    // The publish requests are handled by the SDK, only the responses with data changes are counted
+    m_backend->statistics().requestCompleted(QOpcUaClientStatistics::Service::Publish);
+    m_backend->statistics().notificationsReceived(m_nativeSubscription->subscriptionId(), dataNotifications.length());
+
+    QVector<QOpcUaAttributeUpdate> updates;
+    updates.reserve(dataNotifications.length());
+
     for (quint32 i = 0; i < dataNotifications.length(); ++i) {
         const quint32 monitorId = dataNotifications[i].ClientHandle;
-        const QVariant var = QUACppValueConverter::toQVariant(dataNotifications[i].Value.Value);
-        if (!m_monitoredIds.contains(monitorId))
+        auto item = m_monitoredIds.constFind(monitorId);
+        if (item == m_monitoredIds.constEnd())
             continue;
 
-        QOpcUaReadResult temp;
-        temp.value = var;
-        temp.serverTimestamp = QUACppValueConverter::toQDateTime(&dataNotifications[i].Value.ServerTimestamp);
-        temp.sourceTimestamp = QUACppValueConverter::toQDateTime(&dataNotifications[i].Value.SourceTimestamp);
-        temp.attributeId = m_monitoredIds[monitorId].second;
-        temp.statusCode = QOpcUa::UaStatusCode::Good;
-
-        emit m_backend->attributeUpdated(m_monitoredIds[monitorId].first, temp);
+        QOpcUaAttributeUpdate update;
+        update.handle = item->first;
+        update.value.value = QUACppValueConverter::toQVariant(dataNotifications[i].Value.Value, m_backend->typedArraysEnabled());
+        update.value.serverTimestamp = QUACppValueConverter::toTicks(dataNotifications[i].Value.ServerTimestamp);
+        update.value.sourceTimestamp = QUACppValueConverter::toTicks(dataNotifications[i].Value.SourceTimestamp);
+        update.value.attributeId = item->second;
+        update.value.statusCode = QOpcUa::UaStatusCode::Good;
+        if (!m_backend->passesClientSideFilter(update.handle, update.value))
+            continue;
+        m_backend->recordHistory(update.handle, update.value);
+        updates.push_back(update);
     }
+
+    // All notifications of a publish response are delivered to the client thread in one batch
+    if (!updates.isEmpty())
+        emit m_backend->attributesUpdated(updates);
 }
 
 void QUACppSubscription::newEvents(OpcUa_UInt32 clientSubscriptionHandle, UaEventFieldLists &eventFieldList)
@@ -352,7 +371,7 @@ OpcUa_ExtensionObject QUACppSubscription::createFilter(const QVariant &filterDat
     return obj;
 }
 
-bool QUACppSubscription::modifySubscriptionParameters(uintptr_t handle, QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters::Parameter &item, const QVariant &value)
+bool QUACppSubscription::modifySubscriptionParameters(quint64 handle, QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters::Parameter &item, const QVariant &value)
 {
     QOpcUaMonitoringParameters p;
     SubscriptionSettings settings;
@@ -441,10 +460,10 @@ bool QUACppSubscription::modifySubscriptionParameters(uintptr_t handle, QOpcUa::
     return false;
 }
 
-bool QUACppSubscription::modifyMonitoredItemParameters(uintptr_t handle, QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters::Parameter &item, const QVariant &value)
+bool QUACppSubscription::modifyMonitoredItemParameters(quint64 handle, QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters::Parameter &item, const QVariant &value)
 {
     // Get hold of OpcUa_MonitoredItemCreateResult
-    const QPair<uintptr_t, QOpcUa::NodeAttribute> key(handle, attr);
+    const QPair<quint64, QOpcUa::NodeAttribute> key(handle, attr);
     if (!m_monitoredItems.contains(key)) {
         qCWarning(QT_OPCUA_PLUGINS_UACPP) << "Did not find monitored item";
         return false;
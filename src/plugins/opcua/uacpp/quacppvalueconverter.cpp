@@ -22,11 +22,15 @@
 #include "quacppvalueconverter.h"
 #include "quacpputils.h"
 
+#include <private/qopcuabackend_p.h>
 #include <private/qopcuabinarydataencoding_p.h>
 
 #include <QtCore/QDateTime>
 #include <QtCore/QLoggingCategory>
 #include <QtCore/QUuid>
+#include <QtCore/QVector>
+
+#include <cstring>
 
 #include <uabase/uastring.h>
 #include <uabase/ualocalizedtext.h>
@@ -339,6 +343,18 @@ QVariant arrayToQVariant(const OpcUa_Variant &var, QMetaType::Type type)
     return scalarToQVariant<TARGETTYPE, UATYPE>(temp, type);
 }
 
+template<typename TARGETTYPE, typename UATYPE>
+QVariant typedArrayToQVariant(const OpcUa_Variant &var)
+{
+    Q_STATIC_ASSERT(sizeof(TARGETTYPE) == sizeof(UATYPE));
+
+    const int length = qMax(var.Value.Array.Length, 0);
+    QVector<TARGETTYPE> result(length);
+    if (length > 0)
+        std::memcpy(result.data(), var.Value.Array.Value.Array, length * sizeof(UATYPE));
+    return QVariant::fromValue(result);
+}
+
 // We need specializations for OpcUa_Guid, OpcUa_QualifiedName, OpcUa_NodeId, OpcUa_LocalizedText
 // and OpcUA_ExtensionObject as the scalar versions contain pointers to data, all the others
 // contain the data itself. Hence, there is a difference between the array and scalar version
@@ -604,6 +620,29 @@ OpcUa_Variant arrayFromQVariant(const QVariant &var, const OpcUa_BuiltInType typ
     return opcuavariant;
 }
 
+template<typename TARGETTYPE, typename QTTYPE>
+OpcUa_Variant typedArrayFromQVariant(const QVariant &var, const OpcUa_BuiltInType type)
+{
+    Q_STATIC_ASSERT(sizeof(TARGETTYPE) == sizeof(QTTYPE));
+
+    OpcUa_Variant opcuavariant;
+    OpcUa_Variant_Initialize(&opcuavariant);
+
+    const QVector<QTTYPE> vec = var.value<QVector<QTTYPE>>();
+    if (vec.isEmpty())
+        return opcuavariant;
+
+    opcuavariant.Datatype = type;
+    opcuavariant.ArrayType = OpcUa_True;
+    opcuavariant.Value.Array.Length = vec.size();
+    // Use malloc() instead of new because the OPC UA stack uses free() internally when clearing the data
+    TARGETTYPE *arr = static_cast<TARGETTYPE *>(malloc(vec.size() * sizeof(TARGETTYPE)));
+    std::memcpy(arr, vec.constData(), vec.size() * sizeof(TARGETTYPE));
+    opcuavariant.Value.Array.Value.Array = arr;
+
+    return opcuavariant;
+}
+
 // We need specializations for OpcUa_Guid, OpcUa_QualifiedName, OpcUa_NodeId, OpcUa_LocalizedText
 // and OpcUa_ExtensionObject as the scalar versions contain pointers to data, all the others
 // contain the data itself. Hence, there is a difference between the array and scalar version
@@ -702,8 +741,37 @@ OpcUa_Variant arrayFromQVariant<OpcUa_ExtensionObject, QOpcUa::QXValue>(const QV
     return arrayFromQVariantPointer<OpcUa_ExtensionObject, QOpcUa::QXValue>(var, type);
 }
 
-QVariant toQVariant(const OpcUa_Variant &value)
-{
+QVariant toQVariant(const OpcUa_Variant &value, bool typedArrays)
+{
+    QOpcUaStatisticsCollector::ConversionTimer conversionTimer;
+
+    if (typedArrays && value.ArrayType == OpcUa_VariantArrayType_Array) {
+        switch (value.Datatype) {
+        case OpcUa_BuiltInType::OpcUaType_SByte:
+            return typedArrayToQVariant<qint8, OpcUa_SByte>(value);
+        case OpcUa_BuiltInType::OpcUaType_Byte:
+            return typedArrayToQVariant<quint8, OpcUa_Byte>(value);
+        case OpcUa_BuiltInType::OpcUaType_Int16:
+            return typedArrayToQVariant<qint16, OpcUa_Int16>(value);
+        case OpcUa_BuiltInType::OpcUaType_UInt16:
+            return typedArrayToQVariant<quint16, OpcUa_UInt16>(value);
+        case OpcUa_BuiltInType::OpcUaType_Int32:
+            return typedArrayToQVariant<qint32, OpcUa_Int32>(value);
+        case OpcUa_BuiltInType::OpcUaType_UInt32:
+            return typedArrayToQVariant<quint32, OpcUa_UInt32>(value);
+        case OpcUa_BuiltInType::OpcUaType_Int64:
+            return typedArrayToQVariant<qint64, OpcUa_Int64>(value);
+        case OpcUa_BuiltInType::OpcUaType_UInt64:
+            return typedArrayToQVariant<quint64, OpcUa_UInt64>(value);
+        case OpcUa_BuiltInType::OpcUaType_Float:
+            return typedArrayToQVariant<float, OpcUa_Float>(value);
+        case OpcUa_BuiltInType::OpcUaType_Double:
+            return typedArrayToQVariant<double, OpcUa_Double>(value);
+        default:
+            break;
+        }
+    }
+
     switch (value.Datatype) {
     case OpcUa_BuiltInType::OpcUaType_Boolean:
         return arrayToQVariant<bool, OpcUa_Boolean>(value, QMetaType::Bool);
@@ -815,9 +883,45 @@ QVariant toQVariant(const OpcUa_Variant &value)
 
 OpcUa_Variant toUACppVariant(const QVariant &value, QOpcUa::Types type)
 {
+    QOpcUaStatisticsCollector::ConversionTimer conversionTimer;
+
     OpcUa_Variant uacppvalue;
     OpcUa_Variant_Initialize(&uacppvalue);
 
+    const QOpcUa::Types typedArrayType = QOpcUaBackend::typedArrayElementType(value.userType());
+    if (typedArrayType != QOpcUa::Undefined) {
+        // A typed array of a different type is converted element by element
+        if (type != QOpcUa::Undefined && type != typedArrayType)
+            return toUACppVariant(value.toList(), type);
+
+        const OpcUa_BuiltInType dt = toDataType(typedArrayType);
+
+        switch (typedArrayType) {
+        case QOpcUa::SByte:
+            return typedArrayFromQVariant<OpcUa_SByte, qint8>(value, dt);
+        case QOpcUa::Byte:
+            return typedArrayFromQVariant<OpcUa_Byte, quint8>(value, dt);
+        case QOpcUa::Int16:
+            return typedArrayFromQVariant<OpcUa_Int16, qint16>(value, dt);
+        case QOpcUa::UInt16:
+            return typedArrayFromQVariant<OpcUa_UInt16, quint16>(value, dt);
+        case QOpcUa::Int32:
+            return typedArrayFromQVariant<OpcUa_Int32, qint32>(value, dt);
+        case QOpcUa::UInt32:
+            return typedArrayFromQVariant<OpcUa_UInt32, quint32>(value, dt);
+        case QOpcUa::Int64:
+            return typedArrayFromQVariant<OpcUa_Int64, qint64>(value, dt);
+        case QOpcUa::UInt64:
+            return typedArrayFromQVariant<OpcUa_UInt64, quint64>(value, dt);
+        case QOpcUa::Float:
+            return typedArrayFromQVariant<OpcUa_Float, float>(value, dt);
+        case QOpcUa::Double:
+            return typedArrayFromQVariant<OpcUa_Double, double>(value, dt);
+        default:
+            break;
+        }
+    }
+
     if (value.type() == QVariant::List && value.toList().size() == 0)
         return uacppvalue;
 
@@ -895,6 +999,12 @@ QDateTime toQDateTime(const OpcUa_DateTime *dt)
     return uaEpochStart.addMSecs(temp).toLocalTime();
 }
 
+// OpcUa_DateTime stores the 100 ns intervals since 1601-01-01 UTC as two 32 bit words
+qint64 toTicks(const OpcUa_DateTime &dt)
+{
+    return static_cast<qint64>((static_cast<quint64>(dt.dwHighDateTime) << 32) | dt.dwLowDateTime);
+}
+
 }
 
 QT_END_NAMESPACE
@@ -39,8 +39,15 @@
 #include <QtOpcUa/QOpcUaProvider>
 
 #include <QtCore/QCoreApplication>
+#include <QtCore/QDir>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
 #include <QtCore/QProcess>
 #include <QtCore/QScopedPointer>
+#include <QtCore/QSet>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QTemporaryDir>
 #include <QtCore/QThread>
 #include <QtCore/QTimer>
 
@@ -190,6 +197,10 @@ private slots:
     void writeMultipleAttributes();
     defineDataMethod(readEmptyArrayVariable_data)
     void readEmptyArrayVariable();
+    defineDataMethod(readNodeAttributes_data)
+    void readNodeAttributes();
+    defineDataMethod(writeNodeAttributes_data)
+    void writeNodeAttributes();
 
     defineDataMethod(getRootNode_data)
     void getRootNode();
@@ -208,6 +219,12 @@ private slots:
     void dataChangeSubscriptionInvalidNode();
     defineDataMethod(dataChangeSubscriptionSharing_data)
     void dataChangeSubscriptionSharing();
+    defineDataMethod(monitoredItemSharing_data)
+    void monitoredItemSharing();
+    defineDataMethod(bulkMonitoring_data)
+    void bulkMonitoring();
+    defineDataMethod(dataChangeBatch_data)
+    void dataChangeBatch();
     defineDataMethod(methodCall_data)
     void methodCall();
     defineDataMethod(methodCallInvalid_data)
@@ -216,9 +233,19 @@ private slots:
     void malformedNodeString();
     defineDataMethod(nodeIdGeneration_data)
     void nodeIdGeneration();
+    void nodeIdValueType();
+    void timestampTicks();
+    defineDataMethod(nodeIdOverloads_data)
+    void nodeIdOverloads();
 
     defineDataMethod(multipleClients_data)
     void multipleClients();
+    defineDataMethod(multipleSessions_data)
+    void multipleSessions();
+    defineDataMethod(statistics_data)
+    void statistics();
+    defineDataMethod(tracing_data)
+    void tracing();
     defineDataMethod(nodeClass_data)
     void nodeClass();
     defineDataMethod(writeArray_data)
@@ -229,12 +256,36 @@ private slots:
     void writeScalar();
     defineDataMethod(readScalar_data)
     void readScalar();
+    defineDataMethod(typedArrays_data)
+    void typedArrays();
+    defineDataMethod(lazyValueDecoding_data)
+    void lazyValueDecoding();
+    defineDataMethod(pipelinedRequests_data)
+    void pipelinedRequests();
+    defineDataMethod(browseRecursive_data)
+    void browseRecursive();
+    defineDataMethod(addressSpaceCache_data)
+    void addressSpaceCache();
+    defineDataMethod(historyBuffer_data)
+    void historyBuffer();
+    defineDataMethod(clientSideFilter_data)
+    void clientSideFilter();
+    defineDataMethod(conflatingDispatcher_data)
+    void conflatingDispatcher();
+    defineDataMethod(writeCoalescing_data)
+    void writeCoalescing();
+    defineDataMethod(writeCoalescingDisconnect_data)
+    void writeCoalescingDisconnect();
     defineDataMethod(indexRange_data)
     void indexRange();
     defineDataMethod(invalidIndexRange_data)
     void invalidIndexRange();
     defineDataMethod(subscriptionIndexRange_data)
     void subscriptionIndexRange();
+    defineDataMethod(arrayDelta_data)
+    void arrayDelta();
+    defineDataMethod(registerNodes_data)
+    void registerNodes();
     defineDataMethod(subscriptionDataChangeFilter_data)
     void subscriptionDataChangeFilter();
     defineDataMethod(modifyPublishingMode_data)
@@ -527,6 +578,93 @@ void Tst_QOpcUaClient::readEmptyArrayVariable()
     QVERIFY(node->attribute(QOpcUa::NodeAttribute::Value).toList().isEmpty());
 }
 
+void Tst_QOpcUaClient::readNodeAttributes()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    QVector<QOpcUaReadItem> request;
+    request.push_back(QOpcUaReadItem(QStringLiteral("ns=0;i=84"), QOpcUa::NodeAttribute::DisplayName));
+    request.push_back(QOpcUaReadItem(QStringLiteral("ns=2;s=Demo.Static.Scalar.String"),
+                                     QOpcUa::NodeAttribute::BrowseName | QOpcUa::NodeAttribute::Value));
+    request.push_back(QOpcUaReadItem(QStringLiteral("ns=0;s=doesnotexist")));
+
+    QSignalSpy readSpy(opcuaClient, &QOpcUaClient::readNodeAttributesFinished);
+    QVERIFY(opcuaClient->readNodeAttributes(request));
+
+    readSpy.wait();
+    QCOMPARE(readSpy.size(), 1);
+    QCOMPARE(readSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+    const QVector<QOpcUaReadItemResult> results = readSpy.at(0).at(0).value<QVector<QOpcUaReadItemResult>>();
+    QCOMPARE(results.size(), 4);
+
+    QCOMPARE(results.at(0).nodeId(), QStringLiteral("ns=0;i=84"));
+    QCOMPARE(results.at(0).attribute(), QOpcUa::NodeAttribute::DisplayName);
+    QCOMPARE(results.at(0).statusCode(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(results.at(0).value().value<QOpcUa::QLocalizedText>().text, QStringLiteral("Root"));
+
+    QCOMPARE(results.at(1).nodeId(), QStringLiteral("ns=2;s=Demo.Static.Scalar.String"));
+    QCOMPARE(results.at(1).attribute(), QOpcUa::NodeAttribute::BrowseName);
+    QCOMPARE(results.at(1).statusCode(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(results.at(2).attribute(), QOpcUa::NodeAttribute::Value);
+    QCOMPARE(results.at(2).statusCode(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(results.at(2).value().type(), QVariant::String);
+    QVERIFY(results.at(2).sourceTimestamp().isValid());
+    QVERIFY(results.at(2).serverTimestamp().isValid());
+    QCOMPARE(QOpcUa::dateTimeFromTicks(results.at(2).rawSourceTimestamp()), results.at(2).sourceTimestamp());
+    QCOMPARE(QOpcUa::dateTimeFromTicks(results.at(2).rawServerTimestamp()), results.at(2).serverTimestamp());
+
+    QCOMPARE(results.at(3).nodeId(), QStringLiteral("ns=0;s=doesnotexist"));
+    QCOMPARE(results.at(3).attribute(), QOpcUa::NodeAttribute::Value);
+    QCOMPARE(results.at(3).statusCode(), QOpcUa::UaStatusCode::BadNodeIdUnknown);
+
+    QCOMPARE(opcuaClient->readNodeAttributes(QVector<QOpcUaReadItem>()), false);
+}
+
+void Tst_QOpcUaClient::writeNodeAttributes()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    QScopedPointer<QOpcUaNode> doubleNode(opcuaClient->node("ns=2;s=Demo.Static.Scalar.Double"));
+    QVERIFY(doubleNode != 0);
+
+    QVector<QOpcUaWriteItem> request;
+    request.push_back(QOpcUaWriteItem(QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"), QOpcUa::NodeAttribute::Value,
+                                      42.0, QOpcUa::Types::Double));
+    request.push_back(QOpcUaWriteItem(QStringLiteral("ns=2;s=Demo.Static.Scalar.Int32"), QOpcUa::NodeAttribute::Value,
+                                      std::numeric_limits<qint32>::min(), QOpcUa::Types::Int32));
+    request.push_back(QOpcUaWriteItem(QStringLiteral("ns=2;s=Demo.Static.Scalar.QualifiedName"), QOpcUa::NodeAttribute::DisplayName,
+                                      QVariant::fromValue(QOpcUa::QLocalizedText(QStringLiteral("en"), QStringLiteral("NewDisplayName")))));
+    request.push_back(QOpcUaWriteItem(QStringLiteral("ns=0;s=doesnotexist"), QOpcUa::NodeAttribute::Value, 10, QOpcUa::Types::Int32));
+
+    QSignalSpy writeSpy(opcuaClient, &QOpcUaClient::writeNodeAttributesFinished);
+    QSignalSpy nodeWriteSpy(doubleNode.data(), &QOpcUaNode::attributeWritten);
+    QVERIFY(opcuaClient->writeNodeAttributes(request));
+
+    writeSpy.wait();
+    QCOMPARE(writeSpy.size(), 1);
+    QCOMPARE(writeSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+    const QVector<QOpcUaWriteItemResult> results = writeSpy.at(0).at(0).value<QVector<QOpcUaWriteItemResult>>();
+    QCOMPARE(results.size(), 4);
+    QCOMPARE(results.at(0).nodeId(), QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"));
+    QCOMPARE(results.at(0).statusCode(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(results.at(1).statusCode(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(results.at(2).attribute(), QOpcUa::NodeAttribute::DisplayName);
+    QCOMPARE(results.at(2).statusCode(), QOpcUa::UaStatusCode::BadUserAccessDenied);
+    QCOMPARE(results.at(3).statusCode(), QOpcUa::UaStatusCode::BadNodeIdUnknown);
+
+    // The cache of existing node objects is updated
+    QCOMPARE(nodeWriteSpy.size(), 1);
+    QCOMPARE(nodeWriteSpy.at(0).at(0).value<QOpcUa::NodeAttribute>(), QOpcUa::NodeAttribute::Value);
+    QCOMPARE(nodeWriteSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(doubleNode->attribute(QOpcUa::NodeAttribute::Value).toDouble(), 42.0);
+
+    QCOMPARE(opcuaClient->writeNodeAttributes(QVector<QOpcUaWriteItem>()), false);
+}
+
 void Tst_QOpcUaClient::getRootNode()
 {
     QFETCH(QOpcUaClient *, opcuaClient);
@@ -811,6 +949,177 @@ void Tst_QOpcUaClient::dataChangeSubscriptionSharing()
     QVERIFY(attrs.size() == 0);
 }
 
+void Tst_QOpcUaClient::monitoredItemSharing()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    QScopedPointer<QOpcUaNode> first(opcuaClient->node(readWriteNode));
+    QVERIFY(first != 0);
+    QScopedPointer<QOpcUaNode> second(opcuaClient->node(readWriteNode));
+    QVERIFY(second != 0);
+    WRITE_VALUE_ATTRIBUTE(first, QVariant(double(0)), QOpcUa::Types::Double);
+
+    QSignalSpy firstEnabledSpy(first.data(), &QOpcUaNode::enableMonitoringFinished);
+    QSignalSpy firstUpdatedSpy(first.data(), &QOpcUaNode::attributeUpdated);
+    first->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+    firstEnabledSpy.wait();
+    QCOMPARE(firstEnabledSpy.size(), 1);
+    QCOMPARE(first->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::Good);
+    QTRY_VERIFY(!firstUpdatedSpy.isEmpty());
+
+    const quint64 createRequests = opcuaClient->statistics().requestCount(QOpcUaClientStatistics::Service::CreateMonitoredItems);
+
+    // The second node attaches to the monitored item of the first node and receives the current value
+    QSignalSpy secondEnabledSpy(second.data(), &QOpcUaNode::enableMonitoringFinished);
+    QSignalSpy secondUpdatedSpy(second.data(), &QOpcUaNode::attributeUpdated);
+    second->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+    secondEnabledSpy.wait();
+    QCOMPARE(secondEnabledSpy.size(), 1);
+    QCOMPARE(second->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(second->monitoringStatus(QOpcUa::NodeAttribute::Value).subscriptionId(),
+             first->monitoringStatus(QOpcUa::NodeAttribute::Value).subscriptionId());
+    QTRY_COMPARE(second->attribute(QOpcUa::NodeAttribute::Value), QVariant(double(0)));
+
+    if (opcuaClient->backend() == QLatin1String("open62541"))
+        QCOMPARE(opcuaClient->statistics().requestCount(QOpcUaClientStatistics::Service::CreateMonitoredItems), createRequests);
+
+    WRITE_VALUE_ATTRIBUTE(first, QVariant(double(42)), QOpcUa::Types::Double);
+    QTRY_COMPARE(first->attribute(QOpcUa::NodeAttribute::Value), QVariant(double(42)));
+    QTRY_COMPARE(second->attribute(QOpcUa::NodeAttribute::Value), QVariant(double(42)));
+
+    // The monitored item is kept for the second node
+    QSignalSpy firstDisabledSpy(first.data(), &QOpcUaNode::disableMonitoringFinished);
+    first->disableMonitoring(QOpcUa::NodeAttribute::Value);
+    firstDisabledSpy.wait();
+    QCOMPARE(firstDisabledSpy.size(), 1);
+    QCOMPARE(first->monitoringStatus(QOpcUa::NodeAttribute::Value).subscriptionId(), 0u);
+
+    firstUpdatedSpy.clear();
+    WRITE_VALUE_ATTRIBUTE(second, QVariant(double(23)), QOpcUa::Types::Double);
+    QTRY_COMPARE(second->attribute(QOpcUa::NodeAttribute::Value), QVariant(double(23)));
+    QVERIFY(firstUpdatedSpy.isEmpty());
+
+    QSignalSpy secondDisabledSpy(second.data(), &QOpcUaNode::disableMonitoringFinished);
+    second->disableMonitoring(QOpcUa::NodeAttribute::Value);
+    secondDisabledSpy.wait();
+    QCOMPARE(secondDisabledSpy.size(), 1);
+    QCOMPARE(second->monitoringStatus(QOpcUa::NodeAttribute::Value).subscriptionId(), 0u);
+}
+
+void Tst_QOpcUaClient::bulkMonitoring()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    const QStringList nodeIds = {QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"),
+                                 QStringLiteral("ns=2;s=Demo.Static.Scalar.Int32"),
+                                 QStringLiteral("ns=2;s=Demo.Static.Scalar.String"),
+                                 QStringLiteral("ns=0;i=84")}; // The root node has no value attribute
+
+    QVector<QSharedPointer<QOpcUaNode>> nodeOwners;
+    QVector<QOpcUaNode *> nodes;
+    QVector<QSharedPointer<QSignalSpy>> enabledSpies;
+    QVector<QSharedPointer<QSignalSpy>> disabledSpies;
+    for (const QString &id : nodeIds) {
+        QOpcUaNode *node = opcuaClient->node(id);
+        QVERIFY(node != 0);
+        nodeOwners.push_back(QSharedPointer<QOpcUaNode>(node));
+        nodes.push_back(node);
+        enabledSpies.push_back(QSharedPointer<QSignalSpy>::create(node, &QOpcUaNode::enableMonitoringFinished));
+        disabledSpies.push_back(QSharedPointer<QSignalSpy>::create(node, &QOpcUaNode::disableMonitoringFinished));
+    }
+    QVERIFY(opcuaClient->enableMonitoring(nodes, QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100)));
+
+    for (int i = 0; i < nodes.size(); ++i) {
+        QTRY_COMPARE(enabledSpies.at(i)->size(), 1);
+        QCOMPARE(enabledSpies.at(i)->at(0).at(0).value<QOpcUa::NodeAttribute>(), QOpcUa::NodeAttribute::Value);
+    }
+
+    const quint32 subscriptionId = nodes.first()->monitoringStatus(QOpcUa::NodeAttribute::Value).subscriptionId();
+    QVERIFY(subscriptionId != 0);
+    for (int i = 0; i < nodes.size() - 1; ++i) {
+        QCOMPARE(nodes.at(i)->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::Good);
+        QCOMPARE(nodes.at(i)->monitoringStatus(QOpcUa::NodeAttribute::Value).subscriptionId(), subscriptionId);
+    }
+    QCOMPARE(nodes.last()->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::BadAttributeIdInvalid);
+
+    // A second request for the same attribute is rejected per node
+    QVERIFY(opcuaClient->enableMonitoring(nodes.mid(0, 1), QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100)));
+    QTRY_COMPARE(enabledSpies.at(0)->size(), 2);
+    QCOMPARE(enabledSpies.at(0)->at(1).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadEntryExists);
+
+    QVERIFY(opcuaClient->disableMonitoring(nodes, QOpcUa::NodeAttribute::Value));
+
+    for (int i = 0; i < nodes.size() - 1; ++i) {
+        QTRY_COMPARE(disabledSpies.at(i)->size(), 1);
+        QCOMPARE(disabledSpies.at(i)->at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+        QCOMPARE(nodes.at(i)->monitoringStatus(QOpcUa::NodeAttribute::Value).subscriptionId(), 0u);
+    }
+    QCOMPARE(disabledSpies.last()->size(), 0);
+
+    // A node passed twice is only monitored once
+    QVERIFY(opcuaClient->enableMonitoring({nodes.at(0), nodes.at(0)}, QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100)));
+    QTRY_COMPARE(enabledSpies.at(0)->size(), 4);
+    const QOpcUa::UaStatusCode firstResult = enabledSpies.at(0)->at(2).at(1).value<QOpcUa::UaStatusCode>();
+    const QOpcUa::UaStatusCode secondResult = enabledSpies.at(0)->at(3).at(1).value<QOpcUa::UaStatusCode>();
+    QVERIFY((firstResult == QOpcUa::UaStatusCode::Good && secondResult == QOpcUa::UaStatusCode::BadEntryExists)
+            || (firstResult == QOpcUa::UaStatusCode::BadEntryExists && secondResult == QOpcUa::UaStatusCode::Good));
+    QCOMPARE(nodes.at(0)->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::Good);
+
+    QVERIFY(opcuaClient->disableMonitoring(nodes.mid(0, 1), QOpcUa::NodeAttribute::Value));
+    QTRY_COMPARE(disabledSpies.at(0)->size(), 2);
+    QCOMPARE(disabledSpies.at(0)->at(1).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+    QCOMPARE(opcuaClient->enableMonitoring(QVector<QOpcUaNode *>(), QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100)), false);
+}
+
+void Tst_QOpcUaClient::dataChangeBatch()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    QScopedPointer<QOpcUaNode> doubleNode(opcuaClient->node("ns=2;s=Demo.Static.Scalar.Double"));
+    QVERIFY(doubleNode != 0);
+    QScopedPointer<QOpcUaNode> stringNode(opcuaClient->node("ns=2;s=Demo.Static.Scalar.String"));
+    QVERIFY(stringNode != 0);
+
+    QSignalSpy batchSpy(opcuaClient, &QOpcUaClient::dataChangeBatch);
+    QSignalSpy doubleEnabledSpy(doubleNode.data(), &QOpcUaNode::enableMonitoringFinished);
+    QSignalSpy stringEnabledSpy(stringNode.data(), &QOpcUaNode::enableMonitoringFinished);
+
+    QVERIFY(opcuaClient->enableMonitoring({doubleNode.data(), stringNode.data()}, QOpcUa::NodeAttribute::Value,
+                                          QOpcUaMonitoringParameters(100)));
+    QTRY_COMPARE(doubleEnabledSpy.size(), 1);
+    QTRY_COMPARE(stringEnabledSpy.size(), 1);
+
+    // The initial values of both nodes are delivered in the batch signal and the node caches are updated
+    QHash<QString, QOpcUaReadItemResult> received;
+    QTRY_VERIFY2([&]() {
+        for (const auto &batch : qAsConst(batchSpy)) {
+            for (const QOpcUaReadItemResult &change : batch.at(0).value<QVector<QOpcUaReadItemResult>>())
+                received.insert(change.nodeId(), change);
+        }
+        return received.size() == 2;
+    }(), "Initial values have not been received");
+
+    const QOpcUaReadItemResult doubleChange = received.value(doubleNode->nodeId());
+    QCOMPARE(doubleChange.attribute(), QOpcUa::NodeAttribute::Value);
+    QCOMPARE(doubleChange.statusCode(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(doubleChange.value().type(), QVariant::Double);
+    QCOMPARE(doubleNode->attribute(QOpcUa::NodeAttribute::Value), doubleChange.value());
+
+    const QOpcUaReadItemResult stringChange = received.value(stringNode->nodeId());
+    QCOMPARE(stringChange.value().type(), QVariant::String);
+    QCOMPARE(stringNode->attribute(QOpcUa::NodeAttribute::Value), stringChange.value());
+
+    QSignalSpy doubleDisabledSpy(doubleNode.data(), &QOpcUaNode::disableMonitoringFinished);
+    QSignalSpy stringDisabledSpy(stringNode.data(), &QOpcUaNode::disableMonitoringFinished);
+    QVERIFY(opcuaClient->disableMonitoring({doubleNode.data(), stringNode.data()}, QOpcUa::NodeAttribute::Value));
+    QTRY_COMPARE(doubleDisabledSpy.size(), 1);
+    QTRY_COMPARE(stringDisabledSpy.size(), 1);
+}
+
 void Tst_QOpcUaClient::methodCall()
 {
     QFETCH(QOpcUaClient *, opcuaClient);
@@ -910,6 +1219,99 @@ void Tst_QOpcUaClient::nodeIdGeneration()
     QCOMPARE(nodeId, QStringLiteral("ns=1;b=UXQgZnR3IQ=="));
 }
 
+void Tst_QOpcUaClient::timestampTicks()
+{
+    // 100 ns intervals between 1601-01-01 and the Unix epoch
+    const qint64 unixEpoch = Q_INT64_C(116444736000000000);
+    const QDateTime epoch(QDate(1970, 1, 1), QTime(0, 0), Qt::UTC);
+    QCOMPARE(QOpcUa::ticksFromDateTime(epoch), unixEpoch);
+    QCOMPARE(QOpcUa::dateTimeFromTicks(unixEpoch), epoch);
+    QCOMPARE(QOpcUa::dateTimeFromTicks(unixEpoch + 12345 * 10000 + 6789), epoch.addMSecs(12345));
+
+    QVERIFY(QOpcUa::dateTimeFromTicks(0).isNull());
+    QCOMPARE(QOpcUa::ticksFromDateTime(QDateTime()), Q_INT64_C(0));
+
+    QOpcUaReadItemResult result;
+    QCOMPARE(result.rawSourceTimestamp(), Q_INT64_C(0));
+    QVERIFY(!result.sourceTimestamp().isValid());
+    result.setRawSourceTimestamp(unixEpoch + 10);
+    QCOMPARE(result.rawSourceTimestamp(), unixEpoch + 10);
+    QCOMPARE(result.sourceTimestamp(), epoch);
+    result.setServerTimestamp(epoch.addSecs(1));
+    QCOMPARE(result.rawServerTimestamp(), unixEpoch + 10000000);
+}
+
+void Tst_QOpcUaClient::nodeIdValueType()
+{
+    const QOpcUaNodeId numeric(1, 10);
+    QCOMPARE(numeric.identifierType(), QOpcUaNodeId::IdentifierType::Numeric);
+    QCOMPARE(numeric.namespaceIndex(), quint16(1));
+    QCOMPARE(numeric.numericIdentifier(), quint32(10));
+    QCOMPARE(numeric.toString(), QStringLiteral("ns=1;i=10"));
+    QCOMPARE(QOpcUaNodeId::fromString(QStringLiteral("ns=1;i=10")), numeric);
+
+    const QOpcUaNodeId string(1, QStringLiteral("TestString"));
+    QCOMPARE(string.stringIdentifier(), QStringLiteral("TestString"));
+    QCOMPARE(string.toString(), QStringLiteral("ns=1;s=TestString"));
+    QCOMPARE(QOpcUaNodeId::fromString(QStringLiteral("ns=1;s=TestString")), string);
+
+    const QOpcUaNodeId guid(1, QUuid("08081e75-8e5e-319b-954f-f3a7613dc29b"));
+    QCOMPARE(guid.toString(), QStringLiteral("ns=1;g=08081e75-8e5e-319b-954f-f3a7613dc29b"));
+    QCOMPARE(QOpcUaNodeId::fromString(guid.toString()), guid);
+
+    const QOpcUaNodeId byteString(1, QByteArray::fromBase64("UXQgZnR3IQ=="));
+    QCOMPARE(byteString.toString(), QStringLiteral("ns=1;b=UXQgZnR3IQ=="));
+    QCOMPARE(QOpcUaNodeId::fromString(byteString.toString()), byteString);
+
+    QVERIFY(numeric != QOpcUaNodeId(2, 10));
+    QVERIFY(numeric != QOpcUaNodeId(1, QStringLiteral("10")));
+    QCOMPARE(qHash(numeric), qHash(QOpcUaNodeId(1, 10)));
+
+    QVERIFY(QOpcUaNodeId().isNull());
+    QVERIFY(QOpcUaNodeId().toString().isEmpty());
+    QVERIFY(QOpcUaNodeId::fromString(QStringLiteral("ns=1;x=10")).isNull());
+    QVERIFY(QOpcUaNodeId::fromString(QStringLiteral("ns=1;i=abc")).isNull());
+    QVERIFY(QOpcUaNodeId::fromString(QStringLiteral("i=10")).isNull());
+}
+
+void Tst_QOpcUaClient::nodeIdOverloads()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    QScopedPointer<QOpcUaNode> node(opcuaClient->node(QOpcUaNodeId(2, QStringLiteral("Demo.Static.Scalar.Double"))));
+    QVERIFY(node != 0);
+    QCOMPARE(node->nodeId(), QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"));
+    READ_MANDATORY_VARIABLE_NODE(node);
+
+    QScopedPointer<QOpcUaNode> rootNode(opcuaClient->node(QOpcUaNodeId(0, 84)));
+    QVERIFY(rootNode != 0);
+    QCOMPARE(rootNode->nodeId(), QStringLiteral("ns=0;i=84"));
+
+    QSignalSpy browseSpy(rootNode.data(), &QOpcUaNode::browseFinished);
+    QVERIFY(rootNode->browseChildren(QOpcUa::ReferenceTypeId::Organizes, QOpcUa::NodeClass::Object));
+    browseSpy.wait();
+    QCOMPARE(browseSpy.size(), 1);
+    const auto children = browseSpy.at(0).at(0).value<QVector<QOpcUaReferenceDescription>>();
+    QVERIFY(children.size() > 0);
+    for (const QOpcUaReferenceDescription &child : children)
+        QCOMPARE(child.targetNodeId().toString(), child.nodeId());
+
+    QScopedPointer<QOpcUaNode> objectNode(opcuaClient->node(QOpcUaNodeId(3, QStringLiteral("TestFolder"))));
+    QVERIFY(objectNode != 0);
+    QSignalSpy methodSpy(objectNode.data(), &QOpcUaNode::methodCallFinished);
+    QVector<QOpcUa::TypedVariant> args;
+    for (int i = 0; i < 2; i++)
+        args.push_back(QOpcUa::TypedVariant(double(4), QOpcUa::Double));
+    QVERIFY(objectNode->callMethod(QOpcUaNodeId(3, QStringLiteral("Test.Method.Multiply")), args));
+    methodSpy.wait();
+    QCOMPARE(methodSpy.size(), 1);
+    QCOMPARE(methodSpy.at(0).at(0).value<QString>(), QStringLiteral("ns=3;s=Test.Method.Multiply"));
+    QCOMPARE(methodSpy.at(0).at(1).value<double>(), 16.0);
+
+    QVERIFY(opcuaClient->node(QOpcUaNodeId()) == nullptr);
+}
+
 void Tst_QOpcUaClient::multipleClients()
 {
     QFETCH(QOpcUaClient *, opcuaClient);
@@ -939,6 +1341,228 @@ void Tst_QOpcUaClient::multipleClients()
     QTRY_VERIFY2(b->state() == QOpcUaClient::Disconnected, "Could not disconnect from server");
 }
 
+void Tst_QOpcUaClient::multipleSessions()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    // Backends without support for several sessions ignore the property
+    QVariantMap properties;
+    properties.insert(QStringLiteral("sessionCount"), 4);
+    QScopedPointer<QOpcUaClient> client(m_opcUa.createClient(opcuaClient->backend(), properties));
+    QVERIFY(client != nullptr);
+
+    // The state of the sessions is aggregated, the client is connected once all sessions are
+    QSignalSpy connectedSpy(client.data(), &QOpcUaClient::connected);
+    QSignalSpy disconnectedSpy(client.data(), &QOpcUaClient::disconnected);
+    client->connectToEndpoint(m_endpoint);
+    QTRY_VERIFY2(client->state() == QOpcUaClient::Connected, "Could not connect to server");
+    QTest::qWait(500);
+    QCOMPARE(connectedSpy.size(), 1);
+    QCOMPARE(disconnectedSpy.size(), 0);
+    QCOMPARE(client->error(), QOpcUaClient::NoError);
+
+    const QStringList scalarTypes = {"Boolean", "Byte", "SByte", "Double", "Float", "Int16",
+                                     "Int32", "Int64", "UInt16", "UInt32", "UInt64", "String"};
+
+    // A batch spread across the sessions is merged in the order of the request
+    QVector<QOpcUaReadItem> request;
+    for (const QString &type : scalarTypes) {
+        request.push_back(QOpcUaReadItem(QStringLiteral("ns=2;s=Demo.Static.Scalar.") + type,
+                                         QOpcUa::NodeAttribute::BrowseName | QOpcUa::NodeAttribute::Value));
+    }
+
+    QSignalSpy readSpy(client.data(), &QOpcUaClient::readNodeAttributesFinished);
+    QVERIFY(client->readNodeAttributes(request));
+    readSpy.wait();
+    QCOMPARE(readSpy.size(), 1);
+    QCOMPARE(readSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+    const QVector<QOpcUaReadItemResult> results = readSpy.at(0).at(0).value<QVector<QOpcUaReadItemResult>>();
+    QCOMPARE(results.size(), 2 * scalarTypes.size());
+    for (int i = 0; i < results.size(); ++i) {
+        QCOMPARE(results.at(i).nodeId(), request.at(i / 2).nodeId());
+        QCOMPARE(results.at(i).attribute(), i % 2 ? QOpcUa::NodeAttribute::Value : QOpcUa::NodeAttribute::BrowseName);
+        QCOMPARE(results.at(i).statusCode(), QOpcUa::UaStatusCode::Good);
+    }
+
+    QVector<QOpcUaWriteItem> writeRequest;
+    writeRequest.push_back(QOpcUaWriteItem(QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"), QOpcUa::NodeAttribute::Value,
+                                           23.0, QOpcUa::Types::Double));
+    writeRequest.push_back(QOpcUaWriteItem(readWriteNode, QOpcUa::NodeAttribute::Value, 42.0, QOpcUa::Types::Double));
+    writeRequest.push_back(QOpcUaWriteItem(QStringLiteral("ns=0;s=doesnotexist"), QOpcUa::NodeAttribute::Value, 10, QOpcUa::Types::Int32));
+
+    QSignalSpy writeSpy(client.data(), &QOpcUaClient::writeNodeAttributesFinished);
+    QVERIFY(client->writeNodeAttributes(writeRequest));
+    writeSpy.wait();
+    QCOMPARE(writeSpy.size(), 1);
+    const QVector<QOpcUaWriteItemResult> writeResults = writeSpy.at(0).at(0).value<QVector<QOpcUaWriteItemResult>>();
+    QCOMPARE(writeResults.size(), 3);
+    for (int i = 0; i < writeResults.size(); ++i)
+        QCOMPARE(writeResults.at(i).nodeId(), writeRequest.at(i).nodeId());
+    QCOMPARE(writeResults.at(0).statusCode(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(writeResults.at(1).statusCode(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(writeResults.at(2).statusCode(), QOpcUa::UaStatusCode::BadNodeIdUnknown);
+
+    // Nodes and their monitored items work independent of the session they use
+    for (const QString &type : scalarTypes) {
+        QScopedPointer<QOpcUaNode> node(client->node(QStringLiteral("ns=2;s=Demo.Static.Scalar.") + type));
+        QVERIFY(node != 0);
+        READ_MANDATORY_VARIABLE_NODE(node);
+
+        QSignalSpy monitoringEnabledSpy(node.data(), &QOpcUaNode::enableMonitoringFinished);
+        node->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+        monitoringEnabledSpy.wait();
+        QCOMPARE(monitoringEnabledSpy.size(), 1);
+        QCOMPARE(node->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::Good);
+
+        QSignalSpy monitoringDisabledSpy(node.data(), &QOpcUaNode::disableMonitoringFinished);
+        QVERIFY(node->disableMonitoring(QOpcUa::NodeAttribute::Value));
+        monitoringDisabledSpy.wait();
+        QCOMPARE(monitoringDisabledSpy.size(), 1);
+    }
+
+    client->disconnectFromEndpoint();
+    QTRY_VERIFY2(client->state() == QOpcUaClient::Disconnected, "Could not disconnect from server");
+    QTest::qWait(500);
+    QCOMPARE(disconnectedSpy.size(), 1);
+    QCOMPARE(connectedSpy.size(), 1);
+}
+
+void Tst_QOpcUaClient::statistics()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    QScopedPointer<QOpcUaNode> node(opcuaClient->node(readWriteNode));
+    QVERIFY(node != 0);
+    READ_MANDATORY_VARIABLE_NODE(node);
+    WRITE_VALUE_ATTRIBUTE(node, QVariant(double(0)), QOpcUa::Types::Double);
+
+    QScopedPointer<QOpcUaNode> folder(opcuaClient->node("ns=3;s=TestFolder"));
+    QVERIFY(folder != 0);
+    QSignalSpy browseSpy(folder.data(), &QOpcUaNode::browseFinished);
+    QVERIFY(folder->browseChildren());
+    browseSpy.wait();
+    QCOMPARE(browseSpy.size(), 1);
+
+    QVector<QOpcUa::TypedVariant> args;
+    args.push_back(QOpcUa::TypedVariant(double(4), QOpcUa::Double));
+    args.push_back(QOpcUa::TypedVariant(double(3), QOpcUa::Double));
+    QSignalSpy methodSpy(folder.data(), &QOpcUaNode::methodCallFinished);
+    QVERIFY(folder->callMethod("ns=3;s=Test.Method.Multiply", args));
+    methodSpy.wait();
+    QCOMPARE(methodSpy.size(), 1);
+
+    QSignalSpy monitoringEnabledSpy(node.data(), &QOpcUaNode::enableMonitoringFinished);
+    QSignalSpy dataChangeSpy(node.data(), &QOpcUaNode::attributeUpdated);
+    node->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+    monitoringEnabledSpy.wait();
+    QCOMPARE(monitoringEnabledSpy.size(), 1);
+    const quint32 subscriptionId = node->monitoringStatus(QOpcUa::NodeAttribute::Value).subscriptionId();
+    QVERIFY(subscriptionId != 0);
+    QTRY_VERIFY(dataChangeSpy.size() >= 1);
+
+    // All requests of this client have been answered
+    const QOpcUaClientStatistics stats = opcuaClient->statistics();
+    QCOMPARE(stats.inFlightRequests(), 0);
+
+    const QVector<QOpcUaClientStatistics::Service> services = {QOpcUaClientStatistics::Service::Read,
+                                                                QOpcUaClientStatistics::Service::Write,
+                                                                QOpcUaClientStatistics::Service::Browse,
+                                                                QOpcUaClientStatistics::Service::Call,
+                                                                QOpcUaClientStatistics::Service::CreateMonitoredItems};
+    for (QOpcUaClientStatistics::Service service : services) {
+        QVERIFY(stats.requestCount(service) >= 1);
+        QCOMPARE(stats.inFlightRequests(service), 0);
+
+        const QVector<quint64> histogram = stats.latencyHistogram(service);
+        QCOMPARE(histogram.size(), QOpcUaClientStatistics::latencyBucketLimits().size() + 1);
+        quint64 sum = 0;
+        for (quint64 count : histogram)
+            sum += count;
+        QCOMPARE(sum, stats.requestCount(service));
+        QVERIFY(stats.averageLatency(service) >= 0);
+    }
+
+    // The shared clients have a single session
+    const QOpcUaClientStatistics::SubscriptionKey subscription(0, subscriptionId);
+    QVERIFY(stats.notificationCounts().value(subscription) >= 1);
+    QVERIFY(stats.conversionCount() > 0);
+    QVERIFY(stats.pendingEvents() >= 0);
+
+    // The rates only depend on the two snapshots, not on other calls of statistics() in between
+    WRITE_VALUE_ATTRIBUTE(node, QVariant(double(1)), QOpcUa::Types::Double);
+    QTRY_VERIFY(opcuaClient->statistics().notificationCounts().value(subscription) > stats.notificationCounts().value(subscription));
+    const QOpcUaClientStatistics later = opcuaClient->statistics();
+    const double rate = later.notificationRates(stats).value(subscription);
+    QVERIFY(rate > 0);
+    opcuaClient->statistics();
+    QCOMPARE(later.notificationRates(stats).value(subscription), rate);
+    QCOMPARE(stats.notificationRates(stats).value(subscription), 0.0);
+
+    QSignalSpy monitoringDisabledSpy(node.data(), &QOpcUaNode::disableMonitoringFinished);
+    QVERIFY(node->disableMonitoring(QOpcUa::NodeAttribute::Value));
+    monitoringDisabledSpy.wait();
+    QCOMPARE(monitoringDisabledSpy.size(), 1);
+}
+
+void Tst_QOpcUaClient::tracing()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    // The delivery of results is only traced for clients created while tracing is enabled
+    const bool wasEnabled = QOpcUaProvider::isTracingEnabled();
+    QOpcUaProvider::setTracingEnabled(true);
+    QScopedPointer<QOpcUaClient> client(m_opcUa.createClient(opcuaClient->backend()));
+    QVERIFY(client != nullptr);
+    client->connectToEndpoint(m_endpoint);
+    QTRY_VERIFY2(client->state() == QOpcUaClient::Connected, "Could not connect to server");
+
+    QScopedPointer<QOpcUaNode> node(client->node(readWriteNode));
+    QVERIFY(node != 0);
+    READ_MANDATORY_VARIABLE_NODE(node);
+
+    client->disconnectFromEndpoint();
+    QTRY_VERIFY2(client->state() == QOpcUaClient::Disconnected, "Could not disconnect from server");
+    QOpcUaProvider::setTracingEnabled(wasEnabled);
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString fileName = dir.filePath(QStringLiteral("trace.json"));
+    QVERIFY(QOpcUaProvider::writeTrace(fileName));
+
+    QFile file(fileName);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    QJsonParseError error;
+    const QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &error);
+    QCOMPARE(error.error, QJsonParseError::NoError);
+
+    bool hasReadBegin = false;
+    bool hasReadEnd = false;
+    QSet<double> flowStarts;
+    QSet<double> flowEnds;
+    const QJsonArray events = doc.object().value(QStringLiteral("traceEvents")).toArray();
+    for (const QJsonValue &value : events) {
+        const QJsonObject event = value.toObject();
+        const QString phase = event.value(QStringLiteral("ph")).toString();
+        if (event.value(QStringLiteral("name")).toString() == QLatin1String("Read")) {
+            hasReadBegin |= phase == QLatin1String("B") || phase == QLatin1String("b");
+            hasReadEnd |= phase == QLatin1String("E") || phase == QLatin1String("e");
+        }
+        if (event.value(QStringLiteral("name")).toString() == QLatin1String("attributesRead")) {
+            if (phase == QLatin1String("s"))
+                flowStarts.insert(event.value(QStringLiteral("id")).toDouble());
+            else if (phase == QLatin1String("f"))
+                flowEnds.insert(event.value(QStringLiteral("id")).toDouble());
+        }
+    }
+
+    QVERIFY(hasReadBegin);
+    QVERIFY(hasReadEnd);
+    // The result of the read has been handed over from the backend thread to the client thread
+    QVERIFY(flowStarts.intersects(flowEnds));
+}
+
 void Tst_QOpcUaClient::nodeClass()
 {
     QFETCH(QOpcUaClient *, opcuaClient);
@@ -1829,6 +2453,545 @@ void Tst_QOpcUaClient::readScalar()
     QCOMPARE(xmlElementScalar.toString(), xmlElements[0]);
 }
 
+void Tst_QOpcUaClient::typedArrays()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    // The clients are shared between the tests, make sure the default representation is restored
+    struct TypedArraysGuard {
+        QOpcUaClient *client;
+        ~TypedArraysGuard() { client->setTypedArraysEnabled(false); }
+    } guard{opcuaClient};
+
+    QVERIFY(!opcuaClient->typedArraysEnabled());
+    opcuaClient->setTypedArraysEnabled(true);
+    QVERIFY(opcuaClient->typedArraysEnabled());
+
+    // Same values as in writeArray()
+    const QVector<double> doubleValues = {23.5, 23.6, 23.7};
+    QScopedPointer<QOpcUaNode> doubleArrayNode(opcuaClient->node("ns=2;s=Demo.Static.Arrays.Double"));
+    QVERIFY(doubleArrayNode != 0);
+    WRITE_VALUE_ATTRIBUTE(doubleArrayNode, QVariant::fromValue(doubleValues), QOpcUa::Undefined);
+    READ_MANDATORY_VARIABLE_NODE(doubleArrayNode);
+    QVariant doubleArray = doubleArrayNode->attribute(QOpcUa::NodeAttribute::Value);
+    QCOMPARE(doubleArray.userType(), qMetaTypeId<QVector<double>>());
+    QCOMPARE(doubleArray.value<QVector<double>>(), doubleValues);
+
+    const QVector<qint32> int32Values = {std::numeric_limits<qint32>::min(), std::numeric_limits<qint32>::max(), 10};
+    QScopedPointer<QOpcUaNode> int32ArrayNode(opcuaClient->node("ns=2;s=Demo.Static.Arrays.Int32"));
+    QVERIFY(int32ArrayNode != 0);
+    WRITE_VALUE_ATTRIBUTE(int32ArrayNode, QVariant::fromValue(int32Values), QOpcUa::Int32);
+    READ_MANDATORY_VARIABLE_NODE(int32ArrayNode);
+    QVariant int32Array = int32ArrayNode->attribute(QOpcUa::NodeAttribute::Value);
+    QCOMPARE(int32Array.userType(), qMetaTypeId<QVector<qint32>>());
+    QCOMPARE(int32Array.value<QVector<qint32>>(), int32Values);
+
+    // Non-numeric arrays keep the QVariantList representation
+    QScopedPointer<QOpcUaNode> booleanArrayNode(opcuaClient->node("ns=2;s=Demo.Static.Arrays.Boolean"));
+    QVERIFY(booleanArrayNode != 0);
+    READ_MANDATORY_VARIABLE_NODE(booleanArrayNode);
+    QCOMPARE(booleanArrayNode->attribute(QOpcUa::NodeAttribute::Value).type(), QVariant::List);
+
+    opcuaClient->setTypedArraysEnabled(false);
+    READ_MANDATORY_VARIABLE_NODE(doubleArrayNode);
+    QCOMPARE(doubleArrayNode->attribute(QOpcUa::NodeAttribute::Value).type(), QVariant::List);
+}
+
+void Tst_QOpcUaClient::lazyValueDecoding()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    // The clients are shared between the tests, make sure values are decoded eagerly again afterwards
+    struct LazyDecodingGuard {
+        QOpcUaClient *client;
+        ~LazyDecodingGuard() { client->setLazyValueDecodingEnabled(false); }
+    } guard{opcuaClient};
+
+    QVERIFY(!opcuaClient->lazyValueDecodingEnabled());
+    opcuaClient->setLazyValueDecodingEnabled(true);
+    QVERIFY(opcuaClient->lazyValueDecodingEnabled());
+
+    // Values must be the same as with eager decoding for all backends
+    const QVariantList doubleValues = {23.5, 23.6, 23.7};
+    QScopedPointer<QOpcUaNode> doubleArrayNode(opcuaClient->node("ns=2;s=Demo.Static.Arrays.Double"));
+    QVERIFY(doubleArrayNode != 0);
+    WRITE_VALUE_ATTRIBUTE(doubleArrayNode, doubleValues, QOpcUa::Double);
+    READ_MANDATORY_VARIABLE_NODE(doubleArrayNode);
+    QCOMPARE(doubleArrayNode->attribute(QOpcUa::NodeAttribute::Value).toList(), doubleValues);
+    QCOMPARE(doubleArrayNode->attribute(QOpcUa::NodeAttribute::Value).toList(), doubleValues);
+
+    QVector<QOpcUaReadItem> request;
+    request.push_back(QOpcUaReadItem(QStringLiteral("ns=2;s=Demo.Static.Arrays.Double")));
+    QSignalSpy readSpy(opcuaClient, &QOpcUaClient::readNodeAttributesFinished);
+    QVERIFY(opcuaClient->readNodeAttributes(request));
+    readSpy.wait();
+    QCOMPARE(readSpy.size(), 1);
+    const QVector<QOpcUaReadItemResult> results = readSpy.at(0).at(0).value<QVector<QOpcUaReadItemResult>>();
+    QCOMPARE(results.size(), 1);
+    QCOMPARE(results.at(0).statusCode(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(results.at(0).value().toList(), doubleValues);
+
+    QScopedPointer<QOpcUaNode> node(opcuaClient->node(readWriteNode));
+    QVERIFY(node != 0);
+    WRITE_VALUE_ATTRIBUTE(node, QVariant(double(0)), QOpcUa::Types::Double);
+
+    QSignalSpy dataChangeSpy(node.data(), &QOpcUaNode::attributeUpdated);
+    QSignalSpy monitoringEnabledSpy(node.data(), &QOpcUaNode::enableMonitoringFinished);
+    node->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+    monitoringEnabledSpy.wait();
+    QCOMPARE(monitoringEnabledSpy.size(), 1);
+    QCOMPARE(node->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::Good);
+
+    WRITE_VALUE_ATTRIBUTE(node, QVariant(double(42)), QOpcUa::Types::Double);
+    QTRY_VERIFY(!dataChangeSpy.isEmpty() && dataChangeSpy.last().at(1) == double(42));
+    QCOMPARE(node->attribute(QOpcUa::NodeAttribute::Value), QVariant(double(42)));
+
+    QSignalSpy monitoringDisabledSpy(node.data(), &QOpcUaNode::disableMonitoringFinished);
+    node->disableMonitoring(QOpcUa::NodeAttribute::Value);
+    monitoringDisabledSpy.wait();
+    QCOMPARE(monitoringDisabledSpy.size(), 1);
+}
+
+void Tst_QOpcUaClient::pipelinedRequests()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    // The clients are shared between the tests, make sure the default limit is restored
+    struct PendingRequestsGuard {
+        QOpcUaClient *client;
+        int limit;
+        ~PendingRequestsGuard() { client->setMaxPendingRequests(limit); }
+    } guard{opcuaClient, opcuaClient->maxPendingRequests()};
+
+    opcuaClient->setMaxPendingRequests(0);
+    QCOMPARE(opcuaClient->maxPendingRequests(), 1);
+    opcuaClient->setMaxPendingRequests(2);
+    QCOMPARE(opcuaClient->maxPendingRequests(), 2);
+
+    QScopedPointer<QOpcUaNode> folder(opcuaClient->node("ns=1;s=Large.Folder"));
+    QVERIFY(folder != 0);
+    QSignalSpy browseSpy(folder.data(), &QOpcUaNode::browseFinished);
+    QVERIFY(folder->browseChildren(QOpcUa::ReferenceTypeId::HierarchicalReferences, QOpcUa::NodeClass::Object));
+
+    // More requests than the pipeline depth, the remaining requests are queued until a response arrives
+    const int numNodes = 10;
+    QVector<QSharedPointer<QOpcUaNode>> nodes;
+    QVector<QSharedPointer<QSignalSpy>> readSpies;
+    for (int i = 0; i < numNodes; ++i) {
+        QSharedPointer<QOpcUaNode> node(opcuaClient->node(QStringLiteral("ns=2;s=Demo.Static.Scalar.Double")));
+        QVERIFY(node != 0);
+        readSpies.push_back(QSharedPointer<QSignalSpy>(new QSignalSpy(node.data(), &QOpcUaNode::attributeRead)));
+        QVERIFY(node->readAttributes(QOpcUa::NodeAttribute::Value | QOpcUa::NodeAttribute::BrowseName));
+        nodes.push_back(node);
+    }
+
+    for (int i = 0; i < numNodes; ++i) {
+        if (readSpies.at(i)->isEmpty())
+            readSpies.at(i)->wait();
+        QCOMPARE(readSpies.at(i)->size(), 1);
+        QCOMPARE(nodes.at(i)->attributeError(QOpcUa::NodeAttribute::Value), QOpcUa::UaStatusCode::Good);
+        QCOMPARE(nodes.at(i)->attributeError(QOpcUa::NodeAttribute::BrowseName), QOpcUa::UaStatusCode::Good);
+    }
+
+    if (browseSpy.isEmpty())
+        browseSpy.wait();
+    QCOMPARE(browseSpy.size(), 1);
+    QCOMPARE(browseSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(browseSpy.at(0).at(0).value<QVector<QOpcUaReferenceDescription>>().size(), 100);
+}
+
+void Tst_QOpcUaClient::browseRecursive()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    const QString rootNodeId = QStringLiteral("ns=1;s=Large.Folder");
+
+    QVERIFY(!opcuaClient->browseRecursive(QString()));
+    QVERIFY(!opcuaClient->browseRecursive(rootNodeId, QOpcUa::ReferenceTypeId::HierarchicalReferences,
+                                          QOpcUa::NodeClass::Undefined, 0));
+
+    // The objects in the folder have no hierarchical children, the result must not depend on the depth limit
+    for (int maxDepth : {1, -1}) {
+        QSignalSpy resultsSpy(opcuaClient, &QOpcUaClient::browseRecursiveResultsAvailable);
+        QSignalSpy finishedSpy(opcuaClient, &QOpcUaClient::browseRecursiveFinished);
+
+        QVERIFY(opcuaClient->browseRecursive(rootNodeId, QOpcUa::ReferenceTypeId::HierarchicalReferences,
+                                             QOpcUa::NodeClass::Object, maxDepth));
+        finishedSpy.wait();
+        QCOMPARE(finishedSpy.size(), 1);
+        QCOMPARE(finishedSpy.at(0).at(0).toString(), rootNodeId);
+        QCOMPARE(finishedSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+        QSet<QString> nodeIds;
+        for (const QList<QVariant> &results : qAsConst(resultsSpy)) {
+            QCOMPARE(results.at(0).toString(), rootNodeId);
+            const auto references = results.at(1).value<QVector<QOpcUaReferenceDescription>>();
+            for (const QOpcUaReferenceDescription &reference : references) {
+                QCOMPARE(reference.parentNodeId(), rootNodeId);
+                QCOMPARE(reference.nodeClass(), QOpcUa::NodeClass::Object);
+                nodeIds.insert(reference.nodeId());
+            }
+        }
+        QCOMPARE(nodeIds.size(), 100);
+    }
+}
+
+void Tst_QOpcUaClient::addressSpaceCache()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    QTemporaryDir cacheDir;
+    QVERIFY(cacheDir.isValid());
+
+    // The clients are shared between the tests, make sure the cache is disabled afterwards
+    struct CacheGuard {
+        QOpcUaClient *client;
+        ~CacheGuard() { client->setAddressSpaceCacheDirectory(QString()); }
+    } guard{opcuaClient};
+
+    opcuaClient->setAddressSpaceCacheDirectory(cacheDir.path());
+    QCOMPARE(opcuaClient->addressSpaceCacheDirectory(), cacheDir.path());
+
+    const QOpcUa::NodeAttributes staticAttributes = QOpcUa::NodeAttribute::NodeClass | QOpcUa::NodeAttribute::BrowseName |
+            QOpcUa::NodeAttribute::DisplayName;
+    QOpcUa::QQualifiedName browseName;
+
+    for (bool reused : {false, true}) {
+        QSignalSpy readySpy(opcuaClient, &QOpcUaClient::addressSpaceCacheReady);
+        OpcuaConnector connector(opcuaClient, m_endpoint);
+
+        if (readySpy.isEmpty())
+            readySpy.wait();
+        QCOMPARE(readySpy.size(), 1);
+        QCOMPARE(readySpy.at(0).at(0).toBool(), reused);
+
+        QScopedPointer<QOpcUaNode> folder(opcuaClient->node("ns=1;s=Large.Folder"));
+        QVERIFY(folder != 0);
+        QSignalSpy browseSpy(folder.data(), &QOpcUaNode::browseFinished);
+        QVERIFY(folder->browseChildren(QOpcUa::ReferenceTypeId::HierarchicalReferences, QOpcUa::NodeClass::Object));
+        browseSpy.wait();
+        QCOMPARE(browseSpy.size(), 1);
+        QCOMPARE(browseSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+        const auto references = browseSpy.at(0).at(0).value<QVector<QOpcUaReferenceDescription>>();
+        QCOMPARE(references.size(), 100);
+        for (const QOpcUaReferenceDescription &reference : references)
+            QCOMPARE(reference.nodeClass(), QOpcUa::NodeClass::Object);
+
+        QScopedPointer<QOpcUaNode> node(opcuaClient->node("ns=3;s=TestFolder"));
+        QVERIFY(node != 0);
+        QSignalSpy readSpy(node.data(), &QOpcUaNode::attributeRead);
+        QVERIFY(node->readAttributes(staticAttributes));
+        readSpy.wait();
+        QCOMPARE(readSpy.size(), 1);
+        QCOMPARE(node->attributeError(QOpcUa::NodeAttribute::BrowseName), QOpcUa::UaStatusCode::Good);
+        QCOMPARE(node->attribute(QOpcUa::NodeAttribute::NodeClass).value<QOpcUa::NodeClass>(), QOpcUa::NodeClass::Object);
+
+        if (!reused) {
+            browseName = node->attribute(QOpcUa::NodeAttribute::BrowseName).value<QOpcUa::QQualifiedName>();
+        } else {
+            // Values from the cache don't have timestamps
+            const auto cachedName = node->attribute(QOpcUa::NodeAttribute::BrowseName).value<QOpcUa::QQualifiedName>();
+            QCOMPARE(cachedName.name, browseName.name);
+            QCOMPARE(cachedName.namespaceIndex, browseName.namespaceIndex);
+            QVERIFY(!node->serverTimestamp(QOpcUa::NodeAttribute::BrowseName).isValid());
+        }
+    }
+
+    // The cache file has been written on disconnect
+    QCOMPARE(QDir(cacheDir.path()).entryList(QStringList() << QStringLiteral("*.cache"), QDir::Files).size(), 1);
+}
+
+void Tst_QOpcUaClient::historyBuffer()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    QScopedPointer<QOpcUaNode> node(opcuaClient->node(readWriteNode));
+    QVERIFY(node != 0);
+    WRITE_VALUE_ATTRIBUTE(node, QVariant(double(0)), QOpcUa::Types::Double);
+
+    QCOMPARE(node->historyCapacity(QOpcUa::NodeAttribute::Value), 0);
+    QVERIFY(node->history(QOpcUa::NodeAttribute::Value).isEmpty());
+
+    node->setHistoryCapacity(QOpcUa::NodeAttribute::Value, 10);
+    QCOMPARE(node->historyCapacity(QOpcUa::NodeAttribute::Value), 10);
+
+    QSignalSpy dataChangeSpy(node.data(), &QOpcUaNode::attributeUpdated);
+    QSignalSpy monitoringEnabledSpy(node.data(), &QOpcUaNode::enableMonitoringFinished);
+    node->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+    monitoringEnabledSpy.wait();
+    QCOMPARE(monitoringEnabledSpy.size(), 1);
+    QCOMPARE(node->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::Good);
+    QTRY_VERIFY(dataChangeSpy.size() >= 1);
+
+    for (double value : {1.0, 2.0}) {
+        dataChangeSpy.clear();
+        WRITE_VALUE_ATTRIBUTE(node, QVariant(value), QOpcUa::Types::Double);
+        QTRY_COMPARE(node->attribute(QOpcUa::NodeAttribute::Value).toDouble(), value);
+    }
+
+    // The initial value and both changes, oldest first
+    QVector<QOpcUaReadItemResult> history = node->history(QOpcUa::NodeAttribute::Value);
+    QCOMPARE(history.size(), 3);
+    for (int i = 0; i < history.size(); ++i) {
+        QCOMPARE(history.at(i).value().toDouble(), double(i));
+        QCOMPARE(history.at(i).attribute(), QOpcUa::NodeAttribute::Value);
+        QCOMPARE(history.at(i).statusCode(), QOpcUa::UaStatusCode::Good);
+        QCOMPARE(history.at(i).nodeId(), node->nodeId());
+        QVERIFY(history.at(i).serverTimestamp().isValid());
+    }
+    QVERIFY(node->history(QOpcUa::NodeAttribute::Value).isEmpty());
+
+    // Values are discarded while the buffer is full
+    node->setHistoryCapacity(QOpcUa::NodeAttribute::Value, 1);
+    for (double value : {3.0, 4.0}) {
+        WRITE_VALUE_ATTRIBUTE(node, QVariant(value), QOpcUa::Types::Double);
+        QTRY_COMPARE(node->attribute(QOpcUa::NodeAttribute::Value).toDouble(), value);
+    }
+    history = node->history(QOpcUa::NodeAttribute::Value);
+    QCOMPARE(history.size(), 1);
+    QCOMPARE(history.at(0).value().toDouble(), 3.0);
+
+    node->setHistoryCapacity(QOpcUa::NodeAttribute::Value, 0);
+    QCOMPARE(node->historyCapacity(QOpcUa::NodeAttribute::Value), 0);
+
+    QSignalSpy monitoringDisabledSpy(node.data(), &QOpcUaNode::disableMonitoringFinished);
+    QVERIFY(node->disableMonitoring(QOpcUa::NodeAttribute::Value));
+    monitoringDisabledSpy.wait();
+    QCOMPARE(monitoringDisabledSpy.size(), 1);
+}
+
+void Tst_QOpcUaClient::clientSideFilter()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    QScopedPointer<QOpcUaNode> node(opcuaClient->node(readWriteNode));
+    QVERIFY(node != 0);
+    WRITE_VALUE_ATTRIBUTE(node, QVariant(double(0)), QOpcUa::Types::Double);
+
+    QOpcUaMonitoringParameters::DataChangeFilter filter;
+    filter.deadbandType = QOpcUaMonitoringParameters::DataChangeFilter::DeadbandType::Absolute;
+    filter.deadbandValue = 5;
+    node->setClientSideFilter(QOpcUa::NodeAttribute::Value, filter);
+    QCOMPARE(node->suppressedValueCount(QOpcUa::NodeAttribute::Value), quint64(0));
+
+    QSignalSpy dataChangeSpy(node.data(), &QOpcUaNode::attributeUpdated);
+    QSignalSpy monitoringEnabledSpy(node.data(), &QOpcUaNode::enableMonitoringFinished);
+    node->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+    monitoringEnabledSpy.wait();
+    QCOMPARE(monitoringEnabledSpy.size(), 1);
+    QCOMPARE(node->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::Good);
+    QTRY_COMPARE(dataChangeSpy.size(), 1);
+    QCOMPARE(dataChangeSpy.at(0).at(1), QVariant(double(0)));
+
+    // Within the deadband of the last delivered value
+    const quint64 suppressedBefore = opcuaClient->statistics().suppressedValues();
+    WRITE_VALUE_ATTRIBUTE(node, QVariant(double(2)), QOpcUa::Types::Double);
+    QTRY_COMPARE(node->suppressedValueCount(QOpcUa::NodeAttribute::Value), quint64(1));
+    QVERIFY(opcuaClient->statistics().suppressedValues() > suppressedBefore);
+
+    WRITE_VALUE_ATTRIBUTE(node, QVariant(double(10)), QOpcUa::Types::Double);
+    QTRY_COMPARE(dataChangeSpy.size(), 2);
+    QCOMPARE(dataChangeSpy.at(1).at(1), QVariant(double(10)));
+
+    // The filter is evaluated against 10, 7 is suppressed as well
+    WRITE_VALUE_ATTRIBUTE(node, QVariant(double(7)), QOpcUa::Types::Double);
+    QTRY_COMPARE(node->suppressedValueCount(QOpcUa::NodeAttribute::Value), quint64(2));
+
+    node->removeClientSideFilter(QOpcUa::NodeAttribute::Value);
+    QCOMPARE(node->suppressedValueCount(QOpcUa::NodeAttribute::Value), quint64(0));
+    WRITE_VALUE_ATTRIBUTE(node, QVariant(double(8)), QOpcUa::Types::Double);
+    QTRY_COMPARE(dataChangeSpy.size(), 3);
+    QCOMPARE(dataChangeSpy.at(2).at(1), QVariant(double(8)));
+
+    // The newest value within the minimum interval is delivered when the interval has expired
+    filter.deadbandType = QOpcUaMonitoringParameters::DataChangeFilter::DeadbandType::None;
+    filter.deadbandValue = 0;
+    node->setClientSideFilter(QOpcUa::NodeAttribute::Value, filter, 1500);
+    WRITE_VALUE_ATTRIBUTE(node, QVariant(double(20)), QOpcUa::Types::Double);
+    QTRY_COMPARE(dataChangeSpy.size(), 4);
+    QCOMPARE(dataChangeSpy.at(3).at(1), QVariant(double(20)));
+
+    // Each value is sampled by the server, 21 and 22 are replaced by the following value
+    for (double value : {21.0, 22.0, 23.0}) {
+        WRITE_VALUE_ATTRIBUTE(node, QVariant(value), QOpcUa::Types::Double);
+        QTest::qWait(200);
+    }
+    QCOMPARE(dataChangeSpy.size(), 4);
+    QTRY_COMPARE(dataChangeSpy.size(), 5);
+    QCOMPARE(dataChangeSpy.at(4).at(1), QVariant(double(23)));
+    QCOMPARE(node->attribute(QOpcUa::NodeAttribute::Value), QVariant(double(23)));
+    QCOMPARE(node->suppressedValueCount(QOpcUa::NodeAttribute::Value), quint64(2));
+    node->removeClientSideFilter(QOpcUa::NodeAttribute::Value);
+
+    QSignalSpy monitoringDisabledSpy(node.data(), &QOpcUaNode::disableMonitoringFinished);
+    node->disableMonitoring(QOpcUa::NodeAttribute::Value);
+    monitoringDisabledSpy.wait();
+    QCOMPARE(monitoringDisabledSpy.size(), 1);
+}
+
+void Tst_QOpcUaClient::conflatingDispatcher()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    // The clients are shared between the tests, make sure updates are dispatched immediately afterwards
+    struct DispatchIntervalGuard {
+        QOpcUaClient *client;
+        ~DispatchIntervalGuard() { client->setDispatchInterval(0); }
+    } guard{opcuaClient};
+
+    QCOMPARE(opcuaClient->dispatchInterval(), 0);
+    opcuaClient->setDispatchInterval(-1);
+    QCOMPARE(opcuaClient->dispatchInterval(), 0);
+    opcuaClient->setDispatchInterval(250);
+    QCOMPARE(opcuaClient->dispatchInterval(), 250);
+
+    QScopedPointer<QOpcUaNode> node(opcuaClient->node(readWriteNode));
+    QVERIFY(node != 0);
+    WRITE_VALUE_ATTRIBUTE(node, QVariant(double(0)), QOpcUa::Types::Double);
+
+    QSignalSpy batchSpy(opcuaClient, &QOpcUaClient::dataChangeBatch);
+    QSignalSpy dataChangeSpy(node.data(), &QOpcUaNode::attributeUpdated);
+    QSignalSpy monitoringEnabledSpy(node.data(), &QOpcUaNode::enableMonitoringFinished);
+    node->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(50));
+    monitoringEnabledSpy.wait();
+    QCOMPARE(monitoringEnabledSpy.size(), 1);
+    QCOMPARE(node->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::Good);
+
+    for (int i = 1; i <= 5; ++i)
+        WRITE_VALUE_ATTRIBUTE(node, QVariant(double(i)), QOpcUa::Types::Double);
+    QTRY_VERIFY(!dataChangeSpy.isEmpty() && dataChangeSpy.last().at(1) == double(5));
+
+    // Each attribute is contained at most once per batch
+    for (const auto &batch : qAsConst(batchSpy)) {
+        const QVector<QOpcUaReadItemResult> changes = batch.at(0).value<QVector<QOpcUaReadItemResult>>();
+        QSet<QPair<QString, int>> keys;
+        for (const QOpcUaReadItemResult &change : changes) {
+            const QPair<QString, int> key(change.nodeId(), static_cast<int>(change.attribute()));
+            QVERIFY(!keys.contains(key));
+            keys.insert(key);
+        }
+    }
+    QCOMPARE(dataChangeSpy.size(), batchSpy.size());
+
+    // Pending updates are dispatched immediately when the interval is reset
+    opcuaClient->setDispatchInterval(0);
+    WRITE_VALUE_ATTRIBUTE(node, QVariant(double(6)), QOpcUa::Types::Double);
+    QTRY_COMPARE(node->attribute(QOpcUa::NodeAttribute::Value), QVariant(double(6)));
+
+    QSignalSpy monitoringDisabledSpy(node.data(), &QOpcUaNode::disableMonitoringFinished);
+    node->disableMonitoring(QOpcUa::NodeAttribute::Value);
+    monitoringDisabledSpy.wait();
+    QCOMPARE(monitoringDisabledSpy.size(), 1);
+}
+
+void Tst_QOpcUaClient::writeCoalescing()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    // The clients are shared between the tests, make sure writes are sent immediately afterwards
+    struct WriteCoalescingGuard {
+        QOpcUaClient *client;
+        ~WriteCoalescingGuard() { client->setWriteCoalescingInterval(0); }
+    } guard{opcuaClient};
+
+    QCOMPARE(opcuaClient->writeCoalescingInterval(), 0);
+    opcuaClient->setWriteCoalescingInterval(-1);
+    QCOMPARE(opcuaClient->writeCoalescingInterval(), 0);
+    opcuaClient->setWriteCoalescingInterval(200);
+    QCOMPARE(opcuaClient->writeCoalescingInterval(), 200);
+
+    QScopedPointer<QOpcUaNode> node(opcuaClient->node(readWriteNode));
+    QVERIFY(node != 0);
+    QScopedPointer<QOpcUaNode> doubleNode(opcuaClient->node("ns=2;s=Demo.Static.Scalar.Double"));
+    QVERIFY(doubleNode != 0);
+
+    QSignalSpy writeSpy(node.data(), &QOpcUaNode::attributeWritten);
+    QSignalSpy doubleWriteSpy(doubleNode.data(), &QOpcUaNode::attributeWritten);
+    // Replaced writes must not show up in the cached status of the attribute
+    QVector<QOpcUa::UaStatusCode> errorsAfterReplacedWrite;
+    connect(node.data(), &QOpcUaNode::attributeWritten, this,
+            [&](QOpcUa::NodeAttribute attr, QOpcUa::UaStatusCode statusCode) {
+        if (statusCode == QOpcUa::UaStatusCode::GoodEntryReplaced)
+            errorsAfterReplacedWrite.push_back(node->attributeError(attr));
+    });
+    const quint64 coalescedBefore = opcuaClient->statistics().coalescedWrites();
+    const quint64 writeRequests = opcuaClient->statistics().requestCount(QOpcUaClientStatistics::Service::Write);
+
+    // Only the newest value of the burst is written, the others are reported as replaced
+    for (int i = 1; i <= 5; ++i)
+        QVERIFY(node->writeAttribute(QOpcUa::NodeAttribute::Value, double(i), QOpcUa::Types::Double));
+    QVERIFY(doubleNode->writeAttribute(QOpcUa::NodeAttribute::Value, 23.0, QOpcUa::Types::Double));
+
+    QTRY_COMPARE(writeSpy.size(), 5);
+    QTRY_COMPARE(doubleWriteSpy.size(), 1);
+    for (int i = 0; i < 4; ++i)
+        QCOMPARE(writeSpy.at(i).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::GoodEntryReplaced);
+    QCOMPARE(writeSpy.at(4).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(doubleWriteSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(node->attribute(QOpcUa::NodeAttribute::Value), QVariant(double(5)));
+    QCOMPARE(node->attributeError(QOpcUa::NodeAttribute::Value), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(errorsAfterReplacedWrite.size(), 4);
+    QVERIFY(!errorsAfterReplacedWrite.contains(QOpcUa::UaStatusCode::GoodEntryReplaced));
+    QCOMPARE(doubleNode->attribute(QOpcUa::NodeAttribute::Value), QVariant(double(23)));
+    QCOMPARE(opcuaClient->statistics().coalescedWrites(), coalescedBefore + 4);
+
+    // Writes to different nodes in the same window share one request
+    if (opcuaClient->backend() == QLatin1String("open62541"))
+        QCOMPARE(opcuaClient->statistics().requestCount(QOpcUaClientStatistics::Service::Write), writeRequests + 1);
+
+    // Pending writes are sent immediately when the window is reset
+    QVERIFY(node->writeAttribute(QOpcUa::NodeAttribute::Value, double(6), QOpcUa::Types::Double));
+    opcuaClient->setWriteCoalescingInterval(0);
+    QTRY_COMPARE(writeSpy.size(), 6);
+    QCOMPARE(node->attribute(QOpcUa::NodeAttribute::Value), QVariant(double(6)));
+
+    WRITE_VALUE_ATTRIBUTE(node, QVariant(double(0)), QOpcUa::Types::Double);
+}
+
+void Tst_QOpcUaClient::writeCoalescingDisconnect()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    // A client of its own, the window is left open when the client is destroyed
+    QScopedPointer<QOpcUaClient> client(m_opcUa.createClient(opcuaClient->backend()));
+    QVERIFY(client != nullptr);
+    client->connectToEndpoint(m_endpoint);
+    QTRY_VERIFY2(client->state() == QOpcUaClient::Connected, "Could not connect to server");
+    client->setWriteCoalescingInterval(60000);
+
+    QScopedPointer<QOpcUaNode> node(client->node(readWriteNode));
+    QVERIFY(node != 0);
+    QSignalSpy writeSpy(node.data(), &QOpcUaNode::attributeWritten);
+
+    // The pending writes are sent before the connection is closed, each of them is completed
+    QVERIFY(node->writeAttribute(QOpcUa::NodeAttribute::Value, double(1), QOpcUa::Types::Double));
+    QVERIFY(node->writeAttribute(QOpcUa::NodeAttribute::Value, double(2), QOpcUa::Types::Double));
+    QCOMPARE(writeSpy.size(), 0);
+    client->disconnectFromEndpoint();
+    QTRY_COMPARE(writeSpy.size(), 2);
+    QCOMPARE(writeSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::GoodEntryReplaced);
+    QVERIFY(writeSpy.at(1).at(1).value<QOpcUa::UaStatusCode>() != QOpcUa::UaStatusCode::GoodEntryReplaced);
+    QTRY_VERIFY2(client->state() == QOpcUaClient::Disconnected, "Could not disconnect from server");
+    QCOMPARE(writeSpy.size(), 2);
+
+    // Writes which are still pending when the client is destroyed fail
+    client->connectToEndpoint(m_endpoint);
+    QTRY_VERIFY2(client->state() == QOpcUaClient::Connected, "Could not connect to server");
+    QVERIFY(node->writeAttribute(QOpcUa::NodeAttribute::Value, double(3), QOpcUa::Types::Double));
+    QCOMPARE(writeSpy.size(), 2);
+    client.reset();
+    QCOMPARE(writeSpy.size(), 3);
+    QCOMPARE(writeSpy.at(2).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadDisconnect);
+}
+
 void Tst_QOpcUaClient::indexRange()
 {
     QFETCH(QOpcUaClient *, opcuaClient);
@@ -1933,6 +3096,159 @@ void Tst_QOpcUaClient::subscriptionIndexRange()
     QCOMPARE(monitoringDisabledSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
 }
 
+void Tst_QOpcUaClient::arrayDelta()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    // Typed arrays are compared directly, growing arrays report the new elements in the last range
+    QVector<double> previous(1000, 1.0);
+    QVector<double> current = previous;
+    current[10] = 2.0;
+    current[11] = 2.0;
+    current[500] = 2.0;
+    current.append(3.0);
+    const QOpcUaArrayDelta typedDelta(QVariant::fromValue(previous), QVariant::fromValue(current));
+    QVERIFY(typedDelta.isValid());
+    QCOMPARE(typedDelta.length(), 1001);
+    QCOMPARE(typedDelta.previousLength(), 1000);
+    QCOMPARE(typedDelta.ranges(), QVector<QOpcUaArrayDelta::Range>({{10, 11}, {500, 500}, {1000, 1000}}));
+    QCOMPARE(typedDelta.indexRange(0), QStringLiteral("10:11"));
+    QCOMPARE(typedDelta.indexRange(1), QStringLiteral("500"));
+    QVERIFY(typedDelta.applyTo(previous));
+    QCOMPARE(previous, current);
+    QVERIFY(QOpcUaArrayDelta(QVariant::fromValue(current), QVariant::fromValue(current)).isEmpty());
+    QVERIFY(!QOpcUaArrayDelta(QVariant(), QVariant(1.0)).isValid());
+
+    QScopedPointer<QOpcUaNode> integerArrayNode(opcuaClient->node("ns=2;s=Demo.Static.Arrays.Int32"));
+    QVERIFY(integerArrayNode != 0);
+
+    QVariantList l;
+    for (int i = 0; i < 10; ++i)
+        l.append(i);
+    WRITE_VALUE_ATTRIBUTE(integerArrayNode, l, QOpcUa::Types::Int32);
+
+    QVERIFY(!integerArrayNode->arrayDeltaEnabled(QOpcUa::NodeAttribute::Value));
+    integerArrayNode->setArrayDeltaEnabled(QOpcUa::NodeAttribute::Value, true);
+    QVERIFY(integerArrayNode->arrayDeltaEnabled(QOpcUa::NodeAttribute::Value));
+
+    QSignalSpy monitoringEnabledSpy(integerArrayNode.data(), &QOpcUaNode::enableMonitoringFinished);
+    QSignalSpy deltaSpy(integerArrayNode.data(), &QOpcUaNode::arrayDeltaUpdated);
+    integerArrayNode->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+    monitoringEnabledSpy.wait();
+    QCOMPARE(monitoringEnabledSpy.size(), 1);
+    QCOMPARE(monitoringEnabledSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+    // The buffer holds the value cached by the write, only the changed element is reported
+    QVector<qint32> buffer;
+    for (int i = 0; i < 10; ++i)
+        buffer.append(i);
+    integerArrayNode->writeAttributeRange(QOpcUa::NodeAttribute::Value, 42, QStringLiteral("3"), QOpcUa::Types::Int32);
+    QTRY_VERIFY(!deltaSpy.isEmpty()
+                && deltaSpy.last().at(1).value<QOpcUaArrayDelta>().ranges() == QVector<QOpcUaArrayDelta::Range>({{3, 3}}));
+    QCOMPARE(deltaSpy.last().at(0).value<QOpcUa::NodeAttribute>(), QOpcUa::NodeAttribute::Value);
+    QCOMPARE(deltaSpy.last().at(1).value<QOpcUaArrayDelta>().indexRange(0), QStringLiteral("3"));
+
+    for (const auto &args : qAsConst(deltaSpy))
+        QVERIFY(args.at(1).value<QOpcUaArrayDelta>().applyTo(buffer));
+    QCOMPARE(buffer.size(), 10);
+    QCOMPARE(buffer.at(3), 42);
+    QCOMPARE(buffer.at(4), 4);
+
+    QSignalSpy monitoringDisabledSpy(integerArrayNode.data(), &QOpcUaNode::disableMonitoringFinished);
+    integerArrayNode->disableMonitoring(QOpcUa::NodeAttribute::Value);
+    monitoringDisabledSpy.wait();
+    QCOMPARE(monitoringDisabledSpy.size(), 1);
+}
+
+void Tst_QOpcUaClient::registerNodes()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    QScopedPointer<QOpcUaNode> doubleNode(opcuaClient->node("ns=2;s=Demo.Static.Scalar.Double"));
+    QVERIFY(doubleNode != 0);
+    QVERIFY(!doubleNode->isRegistered());
+    QVERIFY(!doubleNode->unregisterNode());
+
+    QSignalSpy registerSpy(doubleNode.data(), &QOpcUaNode::registerNodeFinished);
+    if (!doubleNode->registerNode())
+        QSKIP("RegisterNodes is not supported by this backend");
+    registerSpy.wait();
+    QCOMPARE(registerSpy.size(), 1);
+    QCOMPARE(registerSpy.at(0).at(0).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    QVERIFY(doubleNode->isRegistered());
+
+    // The original node id is still reported while the registered id is used for the requests
+    QCOMPARE(doubleNode->nodeId(), QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"));
+    WRITE_VALUE_ATTRIBUTE(doubleNode, 23.5, QOpcUa::Types::Double);
+    READ_MANDATORY_VARIABLE_NODE(doubleNode);
+    QCOMPARE(doubleNode->attribute(QOpcUa::NodeAttribute::Value).toDouble(), 23.5);
+    QCOMPARE(doubleNode->attribute(QOpcUa::NodeAttribute::NodeId).toString(), QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"));
+
+    QSignalSpy monitoringEnabledSpy(doubleNode.data(), &QOpcUaNode::enableMonitoringFinished);
+    QSignalSpy dataChangeSpy(doubleNode.data(), &QOpcUaNode::attributeUpdated);
+    doubleNode->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+    monitoringEnabledSpy.wait();
+    QCOMPARE(monitoringEnabledSpy.size(), 1);
+    QCOMPARE(monitoringEnabledSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    QTRY_VERIFY(!dataChangeSpy.isEmpty());
+    QCOMPARE(dataChangeSpy.last().at(1).toDouble(), 23.5);
+
+    QSignalSpy monitoringDisabledSpy(doubleNode.data(), &QOpcUaNode::disableMonitoringFinished);
+    doubleNode->disableMonitoring(QOpcUa::NodeAttribute::Value);
+    monitoringDisabledSpy.wait();
+    QCOMPARE(monitoringDisabledSpy.size(), 1);
+
+    QSignalSpy unregisterSpy(doubleNode.data(), &QOpcUaNode::unregisterNodeFinished);
+    QVERIFY(doubleNode->unregisterNode());
+    QVERIFY(!doubleNode->isRegistered());
+    unregisterSpy.wait();
+    QCOMPARE(unregisterSpy.size(), 1);
+    QCOMPARE(unregisterSpy.at(0).at(0).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+    // Bulk registration
+    QScopedPointer<QOpcUaNode> integerNode(opcuaClient->node("ns=2;s=Demo.Static.Scalar.Int32"));
+    QVERIFY(integerNode != 0);
+    const QVector<QOpcUaNode *> nodes = {doubleNode.data(), integerNode.data()};
+
+    QSignalSpy integerRegisterSpy(integerNode.data(), &QOpcUaNode::registerNodeFinished);
+    registerSpy.clear();
+    QVERIFY(opcuaClient->registerNodes(nodes));
+    QTRY_VERIFY(registerSpy.size() == 1 && integerRegisterSpy.size() == 1);
+    QCOMPARE(registerSpy.at(0).at(0).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(integerRegisterSpy.at(0).at(0).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    QVERIFY(doubleNode->isRegistered());
+    QVERIFY(integerNode->isRegistered());
+
+    WRITE_VALUE_ATTRIBUTE(integerNode, 42, QOpcUa::Types::Int32);
+    READ_MANDATORY_VARIABLE_NODE(integerNode);
+    QCOMPARE(integerNode->attribute(QOpcUa::NodeAttribute::Value).toInt(), 42);
+
+    // Batch requests resolve the registered id and report the original node id
+    QVector<QOpcUaReadItem> request;
+    request.push_back(QOpcUaReadItem(QStringLiteral("ns=2;s=Demo.Static.Scalar.Int32")));
+    QSignalSpy readSpy(opcuaClient, &QOpcUaClient::readNodeAttributesFinished);
+    QVERIFY(opcuaClient->readNodeAttributes(request));
+    readSpy.wait();
+    QCOMPARE(readSpy.size(), 1);
+    const QVector<QOpcUaReadItemResult> results = readSpy.at(0).at(0).value<QVector<QOpcUaReadItemResult>>();
+    QCOMPARE(results.size(), 1);
+    QCOMPARE(results.at(0).statusCode(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(results.at(0).nodeId(), QStringLiteral("ns=2;s=Demo.Static.Scalar.Int32"));
+    QCOMPARE(results.at(0).value().toInt(), 42);
+
+    QSignalSpy integerUnregisterSpy(integerNode.data(), &QOpcUaNode::unregisterNodeFinished);
+    unregisterSpy.clear();
+    QVERIFY(opcuaClient->unregisterNodes(nodes));
+    QVERIFY(!doubleNode->isRegistered());
+    QVERIFY(!integerNode->isRegistered());
+    QTRY_VERIFY(unregisterSpy.size() == 1 && integerUnregisterSpy.size() == 1);
+    QCOMPARE(unregisterSpy.at(0).at(0).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(integerUnregisterSpy.at(0).at(0).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    QVERIFY(!opcuaClient->unregisterNodes(nodes));
+}
+
 void Tst_QOpcUaClient::subscriptionDataChangeFilter()
 {
     QFETCH(QOpcUaClient *, opcuaClient);
@@ -0,0 +1,166 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+// Benchmarks for the array delta of large monitored arrays. A data change of a 100k element array
+// in which a single element has changed is compared with the cached value and applied to a buffer.
+// The benchmarks don't need a server.
+
+#include <QtOpcUa/QOpcUaArrayDelta>
+
+#include <QtCore/QCoreApplication>
+
+#include <QtTest/QtTest>
+
+const int arrayLength = 100000;
+const int changedIndex = arrayLength / 2;
+
+class Tst_BenchArrayDelta: public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void computeDelta_data();
+    void computeDelta();
+    void applyDelta_data();
+    void applyDelta();
+    void compareFullArray_data();
+    void compareFullArray();
+
+private:
+    void addRows();
+};
+
+// The previous and the current value don't share their data like two consecutive data changes
+void Tst_BenchArrayDelta::addRows()
+{
+    QTest::addColumn<QVariant>("previous");
+    QTest::addColumn<QVariant>("current");
+
+    QVector<double> typed(arrayLength);
+    for (int i = 0; i < arrayLength; ++i)
+        typed[i] = i;
+    QVector<double> typedChanged = typed;
+    typedChanged[changedIndex] = -1;
+    QTest::newRow("typed") << QVariant::fromValue(typed) << QVariant::fromValue(typedChanged);
+
+    QVariantList list;
+    list.reserve(arrayLength);
+    for (int i = 0; i < arrayLength; ++i)
+        list.append(double(i));
+    QVariantList listChanged = list;
+    listChanged[changedIndex] = double(-1);
+    QTest::newRow("list") << QVariant(list) << QVariant(listChanged);
+}
+
+void Tst_BenchArrayDelta::computeDelta_data()
+{
+    addRows();
+}
+
+// Comparison of a data change with the cached value as done for QOpcUaNode::arrayDeltaUpdated()
+void Tst_BenchArrayDelta::computeDelta()
+{
+    QFETCH(QVariant, previous);
+    QFETCH(QVariant, current);
+
+    QOpcUaArrayDelta delta;
+    QBENCHMARK {
+        delta = QOpcUaArrayDelta(previous, current);
+    }
+
+    QCOMPARE(delta.ranges(), QVector<QOpcUaArrayDelta::Range>({{changedIndex, changedIndex}}));
+}
+
+void Tst_BenchArrayDelta::applyDelta_data()
+{
+    addRows();
+}
+
+// Only the changed element is copied to the buffer of the consumer
+void Tst_BenchArrayDelta::applyDelta()
+{
+    QFETCH(QVariant, previous);
+    QFETCH(QVariant, current);
+
+    const QOpcUaArrayDelta delta(previous, current);
+    QVector<double> buffer(arrayLength);
+    QVERIFY(delta.applyTo(buffer));
+
+    QBENCHMARK {
+        delta.applyTo(buffer);
+    }
+
+    QCOMPARE(buffer.at(changedIndex), -1.0);
+}
+
+void Tst_BenchArrayDelta::compareFullArray_data()
+{
+    addRows();
+}
+
+// Baseline: a consumer of attributeUpdated() converts the whole value and compares it with its own copy
+void Tst_BenchArrayDelta::compareFullArray()
+{
+    QFETCH(QVariant, current);
+
+    QVector<double> buffer(arrayLength);
+    for (int i = 0; i < arrayLength; ++i)
+        buffer[i] = i;
+    int changed = 0;
+
+    QBENCHMARK {
+        changed = 0;
+        QVector<double> values;
+        if (current.type() == QVariant::List) {
+            const QVariantList list = current.toList();
+            values.reserve(list.size());
+            for (const QVariant &v : list)
+                values.append(v.toDouble());
+        } else {
+            values = current.value<QVector<double>>();
+        }
+        for (int i = 0; i < values.size(); ++i) {
+            if (values.at(i) != buffer.at(i))
+                ++changed;
+        }
+    }
+
+    QCOMPARE(changed, 1);
+}
+
+QTEST_MAIN(Tst_BenchArrayDelta)
+
+#include "tst_bench_arraydelta.moc"
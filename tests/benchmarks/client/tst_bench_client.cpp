@@ -0,0 +1,552 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+// Benchmarks for the client paths which are used by applications.
+// Each benchmark runs once for every available backend against the open62541 test server.
+// Use the QtTest output options to get machine readable results which can be compared over time,
+// for example "tst_bench_client -o results.xml,xml" or "tst_bench_client -csv".
+
+#include <QtOpcUa/QOpcUaClient>
+#include <QtOpcUa/QOpcUaNode>
+#include <QtOpcUa/QOpcUaProvider>
+#include <QtOpcUa/QOpcUaReadItem>
+#include <QtOpcUa/QOpcUaWriteItem>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QProcess>
+#include <QtCore/QQueue>
+#include <QtCore/QScopedPointer>
+
+#include <QtTest/QSignalSpy>
+#include <QtTest/QtTest>
+
+#include <limits>
+
+#if defined(__GLIBC__)
+// The allocation benchmark counts the bytes requested from malloc() by all threads.
+// The allocation functions of glibc are replaced and forward to the internal implementation.
+#define BENCH_HAS_ALLOCATION_COUNTER
+
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+}
+
+static QBasicAtomicInt countAllocations = Q_BASIC_ATOMIC_INITIALIZER(0);
+static QBasicAtomicInteger<quint64> allocatedBytes = Q_BASIC_ATOMIC_INITIALIZER(0);
+
+static inline void countAllocation(size_t size)
+{
+    if (countAllocations.loadAcquire())
+        allocatedBytes.fetchAndAddRelaxed(size);
+}
+
+extern "C" void *malloc(size_t size)
+{
+    countAllocation(size);
+    return __libc_malloc(size);
+}
+
+extern "C" void *calloc(size_t count, size_t size)
+{
+    countAllocation(count * size);
+    return __libc_calloc(count, size);
+}
+
+extern "C" void *realloc(void *ptr, size_t size)
+{
+    countAllocation(size);
+    return __libc_realloc(ptr, size);
+}
+#endif
+
+const int benchVariableCount = 100; // Bench.Value.* and Bench.Write.* in the test server
+const int benchTreeSize = 100 + 100 * 1000; // Objects below Bench.Tree
+const int notificationMeasurementDuration = 3000; // ms
+
+static QString benchValueNode(int i)
+{
+    return QStringLiteral("ns=3;s=Bench.Value.%1").arg(i);
+}
+
+static QString benchWriteNode(int i)
+{
+    return QStringLiteral("ns=3;s=Bench.Write.%1").arg(i);
+}
+
+class Tst_BenchClient: public QObject
+{
+    Q_OBJECT
+
+public:
+    Tst_BenchClient();
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void cleanup();
+
+    void readLatency_data();
+    void readLatency();
+    void writeThroughput_data();
+    void writeThroughput();
+    void createMonitoredItems_data();
+    void createMonitoredItems();
+    void notificationRate_data();
+    void notificationRate();
+    void browseTree_data();
+    void browseTree();
+    void bytesAllocatedPerNotification_data();
+    void bytesAllocatedPerNotification();
+
+private:
+    QString envOrDefault(const char *env, QString def)
+    {
+        return qEnvironmentVariableIsSet(env) ? qgetenv(env).constData() : def;
+    }
+
+    void addBackendRows(const QVector<int> &counts = QVector<int>());
+    QOpcUaClient *connectedClient(const QString &backend);
+    QVector<QOpcUaNode *> createNodes(QOpcUaClient *client, int count);
+    bool setMonitoring(QOpcUaClient *client, const QVector<QOpcUaNode *> &nodes, bool enable);
+
+    QString m_endpoint;
+    QOpcUaProvider m_opcUa;
+    QStringList m_backends;
+    QProcess m_serverProcess;
+    QScopedPointer<QOpcUaClient> m_client;
+    QVector<QOpcUaNode *> m_nodes;
+};
+
+Tst_BenchClient::Tst_BenchClient()
+{
+    m_backends = QOpcUaProvider::availableBackends();
+}
+
+void Tst_BenchClient::initTestCase()
+{
+    if (qEnvironmentVariableIsEmpty("OPCUA_HOST") && qEnvironmentVariableIsEmpty("OPCUA_PORT")) {
+        const QString testServerPath = qApp->applicationDirPath()
+#ifdef Q_OS_WIN
+                                     + QLatin1String("/..")
+#endif
+                                     + QLatin1String("/../../open62541-testserver/open62541-testserver")
+#ifdef Q_OS_WIN
+                                     + QLatin1String(".exe")
+#endif
+                ;
+        if (!QFile::exists(testServerPath)) {
+            qDebug() << "Server Path:" << testServerPath;
+            QSKIP("all benchmarks rely on an open62541-based test-server");
+        }
+
+        m_serverProcess.start(testServerPath, QStringList() << QLatin1String("--benchmark"));
+        QVERIFY2(m_serverProcess.waitForStarted(), qPrintable(m_serverProcess.errorString()));
+    }
+    QString host = envOrDefault("OPCUA_HOST", "localhost");
+    QString port = envOrDefault("OPCUA_PORT", "43344");
+    m_endpoint = QString("opc.tcp://%1:%2").arg(host).arg(port);
+    qDebug() << "Using endpoint:" << m_endpoint;
+
+    // Creating the benchmark address space takes a while, wait until the server accepts connections
+    QElapsedTimer startup;
+    startup.start();
+    for (;;) {
+        QScopedPointer<QOpcUaClient> client(connectedClient(m_backends.first()));
+        if (client) {
+            client->disconnectFromEndpoint();
+            QTRY_VERIFY(client->state() == QOpcUaClient::Disconnected);
+            break;
+        }
+        QVERIFY2(startup.elapsed() < 60000, "The test server did not start");
+        QTest::qWait(500);
+    }
+}
+
+void Tst_BenchClient::cleanupTestCase()
+{
+    if (m_serverProcess.state() == QProcess::Running) {
+        m_serverProcess.kill();
+        m_serverProcess.waitForFinished(2000);
+    }
+}
+
+void Tst_BenchClient::cleanup()
+{
+    qDeleteAll(m_nodes);
+    m_nodes.clear();
+
+    if (m_client) {
+        m_client->disconnectFromEndpoint();
+        QTRY_VERIFY(m_client->state() == QOpcUaClient::Disconnected);
+        m_client.reset();
+    }
+}
+
+void Tst_BenchClient::addBackendRows(const QVector<int> &counts)
+{
+    QTest::addColumn<QString>("backend");
+    QTest::addColumn<int>("count");
+
+    for (const QString &backend : qAsConst(m_backends)) {
+        if (counts.isEmpty()) {
+            QTest::newRow(backend.toLatin1().constData()) << backend << 0;
+            continue;
+        }
+        for (int count : counts) {
+            const QByteArray name = QStringLiteral("%1 %2").arg(backend).arg(count).toLatin1();
+            QTest::newRow(name.constData()) << backend << count;
+        }
+    }
+}
+
+QOpcUaClient *Tst_BenchClient::connectedClient(const QString &backend)
+{
+    QScopedPointer<QOpcUaClient> client(m_opcUa.createClient(backend));
+    if (!client)
+        return nullptr;
+
+    QSignalSpy connectSpy(client.data(), &QOpcUaClient::stateChanged);
+    client->connectToEndpoint(QUrl(m_endpoint));
+    while (client->state() == QOpcUaClient::Connecting || connectSpy.isEmpty()) {
+        if (!connectSpy.wait(10000))
+            break;
+    }
+
+    if (client->state() != QOpcUaClient::Connected)
+        return nullptr;
+
+    return client.take();
+}
+
+QVector<QOpcUaNode *> Tst_BenchClient::createNodes(QOpcUaClient *client, int count)
+{
+    QVector<QOpcUaNode *> nodes;
+    for (int i = 0; i < count; ++i)
+        nodes.push_back(client->node(benchValueNode(i % benchVariableCount)));
+    m_nodes += nodes;
+    return nodes;
+}
+
+bool Tst_BenchClient::setMonitoring(QOpcUaClient *client, const QVector<QOpcUaNode *> &nodes, bool enable)
+{
+    int finished = 0;
+    bool success = true;
+    QVector<QMetaObject::Connection> connections;
+
+    for (QOpcUaNode *node : nodes) {
+        const auto handler = [&](QOpcUa::NodeAttribute, QOpcUa::UaStatusCode statusCode) {
+            ++finished;
+            success &= statusCode == QOpcUa::UaStatusCode::Good;
+        };
+        if (enable)
+            connections.push_back(QObject::connect(node, &QOpcUaNode::enableMonitoringFinished, handler));
+        else
+            connections.push_back(QObject::connect(node, &QOpcUaNode::disableMonitoringFinished, handler));
+    }
+
+    if (enable)
+        success &= client->enableMonitoring(nodes, QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(10));
+    else
+        success &= client->disableMonitoring(nodes, QOpcUa::NodeAttribute::Value);
+
+    QElapsedTimer timeout;
+    timeout.start();
+    while (success && finished < nodes.size() && timeout.elapsed() < 60000)
+        QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents, 100);
+
+    for (const QMetaObject::Connection &c : qAsConst(connections))
+        QObject::disconnect(c);
+
+    return success && finished == nodes.size();
+}
+
+void Tst_BenchClient::readLatency_data()
+{
+    addBackendRows({1, benchVariableCount});
+}
+
+// Time from the read request to the result for one node or a batch of nodes in one request
+void Tst_BenchClient::readLatency()
+{
+    QFETCH(QString, backend);
+    QFETCH(int, count);
+
+    m_client.reset(connectedClient(backend));
+    QVERIFY2(m_client, "Could not connect to server");
+
+    if (count == 1) {
+        QScopedPointer<QOpcUaNode> node(m_client->node(benchWriteNode(0)));
+        QVERIFY(node);
+        QSignalSpy readSpy(node.data(), &QOpcUaNode::attributeRead);
+
+        QBENCHMARK {
+            readSpy.clear();
+            node->readAttributes(QOpcUa::NodeAttribute::Value);
+            QVERIFY(readSpy.wait());
+        }
+        QCOMPARE(node->attributeError(QOpcUa::NodeAttribute::Value), QOpcUa::UaStatusCode::Good);
+    } else {
+        QVector<QOpcUaReadItem> items;
+        for (int i = 0; i < count; ++i)
+            items.push_back(QOpcUaReadItem(benchWriteNode(i)));
+        QSignalSpy readSpy(m_client.data(), &QOpcUaClient::readNodeAttributesFinished);
+
+        QBENCHMARK {
+            readSpy.clear();
+            m_client->readNodeAttributes(items);
+            QVERIFY(readSpy.wait());
+        }
+        QCOMPARE(readSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    }
+}
+
+void Tst_BenchClient::writeThroughput_data()
+{
+    addBackendRows({1, benchVariableCount});
+}
+
+// Time to write benchVariableCount values, either one request per value without waiting
+// for the previous result or in batches of count values per request
+void Tst_BenchClient::writeThroughput()
+{
+    QFETCH(QString, backend);
+    QFETCH(int, count);
+
+    m_client.reset(connectedClient(backend));
+    QVERIFY2(m_client, "Could not connect to server");
+
+    double value = 0;
+
+    if (count == 1) {
+        QVector<QOpcUaNode *> nodes;
+        for (int i = 0; i < benchVariableCount; ++i)
+            nodes.push_back(m_client->node(benchWriteNode(i)));
+        m_nodes += nodes;
+
+        int written = 0;
+        for (QOpcUaNode *node : qAsConst(nodes))
+            QObject::connect(node, &QOpcUaNode::attributeWritten, [&written]() { ++written; });
+
+        QBENCHMARK {
+            written = 0;
+            value += 1;
+            for (QOpcUaNode *node : qAsConst(nodes))
+                node->writeAttribute(QOpcUa::NodeAttribute::Value, value, QOpcUa::Types::Double);
+            QTRY_COMPARE_WITH_TIMEOUT(written, benchVariableCount, 30000);
+        }
+    } else {
+        QSignalSpy writeSpy(m_client.data(), &QOpcUaClient::writeNodeAttributesFinished);
+
+        QBENCHMARK {
+            writeSpy.clear();
+            value += 1;
+            for (int offset = 0; offset < benchVariableCount; offset += count) {
+                QVector<QOpcUaWriteItem> items;
+                for (int i = offset; i < qMin(offset + count, benchVariableCount); ++i)
+                    items.push_back(QOpcUaWriteItem(benchWriteNode(i), QOpcUa::NodeAttribute::Value, value, QOpcUa::Types::Double));
+                m_client->writeNodeAttributes(items);
+            }
+            QTRY_COMPARE_WITH_TIMEOUT(writeSpy.size(), (benchVariableCount + count - 1) / count, 30000);
+        }
+        QCOMPARE(writeSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    }
+}
+
+void Tst_BenchClient::createMonitoredItems_data()
+{
+    addBackendRows({10, 100, 1000});
+}
+
+// Time until all monitored items have been created on the server and the results have been delivered
+void Tst_BenchClient::createMonitoredItems()
+{
+    QFETCH(QString, backend);
+    QFETCH(int, count);
+
+    m_client.reset(connectedClient(backend));
+    QVERIFY2(m_client, "Could not connect to server");
+
+    const QVector<QOpcUaNode *> nodes = createNodes(m_client.data(), count);
+
+    // Removing the items is not part of the measurement, the best of a few rounds is reported
+    qint64 best = std::numeric_limits<qint64>::max();
+    for (int round = 0; round < 3; ++round) {
+        QElapsedTimer timer;
+        timer.start();
+        QVERIFY(setMonitoring(m_client.data(), nodes, true));
+        best = qMin(best, timer.elapsed());
+
+        QVERIFY(setMonitoring(m_client.data(), nodes, false));
+    }
+
+    QTest::setBenchmarkResult(best, QTest::WalltimeMilliseconds);
+}
+
+void Tst_BenchClient::notificationRate_data()
+{
+    addBackendRows({1, benchVariableCount});
+}
+
+// Data change notifications per second delivered to QOpcUaNode::attributeUpdated while count values
+// change every 10 ms on the server. The result is reported as number of events per second.
+void Tst_BenchClient::notificationRate()
+{
+    QFETCH(QString, backend);
+    QFETCH(int, count);
+
+    m_client.reset(connectedClient(backend));
+    QVERIFY2(m_client, "Could not connect to server");
+
+    const QVector<QOpcUaNode *> nodes = createNodes(m_client.data(), count);
+    int notifications = 0;
+    for (QOpcUaNode *node : nodes)
+        QObject::connect(node, &QOpcUaNode::attributeUpdated, [&notifications]() { ++notifications; });
+
+    QVERIFY(setMonitoring(m_client.data(), nodes, true));
+
+    // Let the initial data change notifications settle
+    QTest::qWait(1000);
+
+    notifications = 0;
+    QElapsedTimer timer;
+    timer.start();
+    QTest::qWait(notificationMeasurementDuration);
+    const double rate = notifications * 1000.0 / timer.elapsed();
+
+    QVERIFY(notifications > 0);
+    QTest::setBenchmarkResult(rate, QTest::Events);
+
+    QVERIFY(setMonitoring(m_client.data(), nodes, false));
+}
+
+void Tst_BenchClient::browseTree_data()
+{
+    addBackendRows();
+}
+
+// Time to browse all objects below Bench.Tree level by level
+void Tst_BenchClient::browseTree()
+{
+    QFETCH(QString, backend);
+
+    m_client.reset(connectedClient(backend));
+    QVERIFY2(m_client, "Could not connect to server");
+
+    int visited = 0;
+
+    QBENCHMARK_ONCE {
+        visited = 0;
+        QQueue<QString> pending;
+        pending.enqueue(QStringLiteral("ns=3;s=Bench.Tree"));
+
+        while (!pending.isEmpty()) {
+            QScopedPointer<QOpcUaNode> node(m_client->node(pending.dequeue()));
+            QVERIFY(node);
+            QSignalSpy browseSpy(node.data(), &QOpcUaNode::browseFinished);
+            QVERIFY(node->browseChildren(QOpcUa::ReferenceTypeId::Organizes, QOpcUa::NodeClass::Object));
+            QVERIFY(browseSpy.wait(60000));
+            QCOMPARE(browseSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+            const auto children = browseSpy.at(0).at(0).value<QVector<QOpcUaReferenceDescription>>();
+            for (const QOpcUaReferenceDescription &child : children)
+                pending.enqueue(child.nodeId());
+            visited += children.size();
+        }
+    }
+
+    if (visited == 0)
+        QSKIP("The server has no benchmark address space, start the test server with --benchmark");
+    QCOMPARE(visited, benchTreeSize);
+}
+
+void Tst_BenchClient::bytesAllocatedPerNotification_data()
+{
+    addBackendRows({benchVariableCount});
+}
+
+// Bytes allocated in the whole process per data change notification delivered to QOpcUaNode::attributeUpdated
+void Tst_BenchClient::bytesAllocatedPerNotification()
+{
+#ifndef BENCH_HAS_ALLOCATION_COUNTER
+    QSKIP("Counting allocations is only supported with glibc");
+#else
+    QFETCH(QString, backend);
+    QFETCH(int, count);
+
+    m_client.reset(connectedClient(backend));
+    QVERIFY2(m_client, "Could not connect to server");
+
+    const QVector<QOpcUaNode *> nodes = createNodes(m_client.data(), count);
+    int notifications = 0;
+    for (QOpcUaNode *node : nodes)
+        QObject::connect(node, &QOpcUaNode::attributeUpdated, [&notifications]() { ++notifications; });
+
+    QVERIFY(setMonitoring(m_client.data(), nodes, true));
+    QTest::qWait(1000);
+
+    notifications = 0;
+    allocatedBytes.store(0);
+    countAllocations.storeRelease(1);
+    QTest::qWait(notificationMeasurementDuration);
+    countAllocations.storeRelease(0);
+    const quint64 bytes = allocatedBytes.loadAcquire();
+
+    QVERIFY(notifications > 0);
+    QTest::setBenchmarkResult(double(bytes) / notifications, QTest::BytesAllocated);
+
+    QVERIFY(setMonitoring(m_client.data(), nodes, false));
+#endif
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QTEST_SET_MAIN_SOURCE_PATH
+
+    if (QOpcUaProvider::availableBackends().empty()) {
+        qDebug("No OPCUA backends found, skipping benchmarks.");
+        return EXIT_SUCCESS;
+    }
+
+    Tst_BenchClient tc;
+    return QTest::qExec(&tc, argc, argv);
+}
+
+#include "tst_bench_client.moc"
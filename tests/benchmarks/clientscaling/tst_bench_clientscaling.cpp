@@ -0,0 +1,322 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+// Measures the cost of many connected clients in one process, for example a data collector
+// which talks to hundreds of PLCs. Every client monitors one value and stays idle otherwise.
+// The clients are spread across several test servers because each server accepts a limited
+// number of sessions. The backend threads of the open62541 backend are shared by default, run
+// with QT_OPCUA_BACKEND_THREADS=0 to compare against one thread per client.
+// Backends sharing a thread take turns, so the request latency is measured as well.
+
+#include <QtOpcUa/QOpcUaClient>
+#include <QtOpcUa/QOpcUaNode>
+#include <QtOpcUa/QOpcUaProvider>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QProcess>
+
+#include <QtTest/QSignalSpy>
+#include <QtTest/QtTest>
+
+#include <algorithm>
+
+#if defined(Q_OS_UNIX)
+#include <sys/resource.h>
+#endif
+
+const QString monitoredNode = QStringLiteral("ns=2;s=Demo.Static.Scalar.Double");
+const int serverCount = 20;
+const int sessionsPerServer = 50;
+const quint16 firstServerPort = 43400;
+const int measurementDuration = 5000; // ms
+const int readsPerClient = 20;
+
+struct ProcessStatistics
+{
+    qint64 residentBytes = -1;
+    int threads = -1;
+    qint64 contextSwitches = -1;
+};
+
+static ProcessStatistics processStatistics()
+{
+    ProcessStatistics stats;
+
+#if defined(Q_OS_LINUX)
+    QFile status(QStringLiteral("/proc/self/status"));
+    if (status.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        for (const QByteArray &line : status.readAll().split('\n')) {
+            const QList<QByteArray> fields = line.simplified().split(' ');
+            if (fields.size() >= 2 && fields.at(0) == "VmRSS:")
+                stats.residentBytes = fields.at(1).toLongLong() * 1024;
+            else if (fields.size() >= 2 && fields.at(0) == "Threads:")
+                stats.threads = fields.at(1).toInt();
+        }
+    }
+#endif
+
+#if defined(Q_OS_UNIX)
+    // Voluntary and involuntary context switches of all threads of the process
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+        stats.contextSwitches = usage.ru_nvcsw + usage.ru_nivcsw;
+#endif
+
+    return stats;
+}
+
+class Tst_BenchClientScaling: public QObject
+{
+    Q_OBJECT
+
+public:
+    Tst_BenchClientScaling();
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void idleClients_data();
+    void idleClients();
+
+private:
+    QString envOrDefault(const char *env, QString def)
+    {
+        return qEnvironmentVariableIsSet(env) ? qgetenv(env).constData() : def;
+    }
+
+    QStringList m_endpoints;
+    QOpcUaProvider m_opcUa;
+    QStringList m_backends;
+    QVector<QProcess *> m_serverProcesses;
+};
+
+Tst_BenchClientScaling::Tst_BenchClientScaling()
+{
+    m_backends = QOpcUaProvider::availableBackends();
+}
+
+void Tst_BenchClientScaling::initTestCase()
+{
+#if !defined(Q_OS_UNIX)
+    QSKIP("the context switch counter is only available on Unix");
+#endif
+
+    if (!qEnvironmentVariableIsEmpty("OPCUA_HOST") || !qEnvironmentVariableIsEmpty("OPCUA_PORT")) {
+        // An external server must accept the sessions of all clients
+        QString host = envOrDefault("OPCUA_HOST", "localhost");
+        QString port = envOrDefault("OPCUA_PORT", "43344");
+        m_endpoints.append(QString("opc.tcp://%1:%2").arg(host).arg(port));
+        qDebug() << "Using endpoint:" << m_endpoints.first();
+        return;
+    }
+
+    const QString testServerPath = qApp->applicationDirPath()
+#ifdef Q_OS_WIN
+                                 + QLatin1String("/..")
+#endif
+                                 + QLatin1String("/../../open62541-testserver/open62541-testserver")
+#ifdef Q_OS_WIN
+                                 + QLatin1String(".exe")
+#endif
+            ;
+    if (!QFile::exists(testServerPath)) {
+        qDebug() << "Server Path:" << testServerPath;
+        QSKIP("all benchmarks rely on an open62541-based test-server");
+    }
+
+    for (int i = 0; i < serverCount; ++i) {
+        const quint16 port = firstServerPort + i;
+        QProcess *process = new QProcess(this);
+        process->start(testServerPath, QStringList() << QLatin1String("--port") << QString::number(port));
+        QVERIFY2(process->waitForStarted(), qPrintable(process->errorString()));
+        m_serverProcesses.append(process);
+        m_endpoints.append(QString("opc.tcp://localhost:%1").arg(port));
+    }
+    // Let the servers come up
+    QTest::qSleep(2000);
+    qDebug() << "Using" << m_endpoints.size() << "test servers starting at port" << firstServerPort;
+}
+
+void Tst_BenchClientScaling::cleanupTestCase()
+{
+    for (QProcess *process : qAsConst(m_serverProcesses)) {
+        if (process->state() == QProcess::Running) {
+            process->kill();
+            process->waitForFinished(2000);
+        }
+    }
+}
+
+void Tst_BenchClientScaling::idleClients_data()
+{
+    QTest::addColumn<QString>("backend");
+    QTest::addColumn<int>("numberOfClients");
+
+    for (const QString &backend : qAsConst(m_backends)) {
+        for (int clients : {100, 1000}) {
+            const QByteArray name = QStringLiteral("%1 %2 clients").arg(backend).arg(clients).toLatin1();
+            QTest::newRow(name.constData()) << backend << clients;
+        }
+    }
+}
+
+// Reports the resident memory and the number of threads per connected client and
+// the context switches per second while all clients only receive keep-alives.
+// Afterwards, every client runs a chain of dependent reads and the latency of the reads is reported.
+void Tst_BenchClientScaling::idleClients()
+{
+    QFETCH(QString, backend);
+    QFETCH(int, numberOfClients);
+
+    if (m_endpoints.size() > 1 && numberOfClients > m_endpoints.size() * sessionsPerServer)
+        QSKIP("not enough test servers for the number of clients");
+
+    const ProcessStatistics before = processStatistics();
+
+    QVector<QOpcUaClient *> clients;
+    QVector<QOpcUaNode *> nodes;
+
+    for (int i = 0; i < numberOfClients; ++i) {
+        QOpcUaClient *client = m_opcUa.createClient(backend);
+        QVERIFY(client != nullptr);
+        client->setParent(this);
+        clients.push_back(client);
+        client->connectToEndpoint(QUrl(m_endpoints.at(i % m_endpoints.size())));
+    }
+
+    for (QOpcUaClient *client : qAsConst(clients)) {
+        QTRY_VERIFY2_WITH_TIMEOUT(client->state() == QOpcUaClient::Connected, "Could not connect to server", 60000);
+        QOpcUaNode *node = client->node(monitoredNode);
+        QVERIFY(node != nullptr);
+        nodes.push_back(node);
+        node->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+    }
+
+    for (QOpcUaNode *node : qAsConst(nodes)) {
+        QTRY_VERIFY_WITH_TIMEOUT(node->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode() == QOpcUa::UaStatusCode::Good,
+                                 60000);
+    }
+
+    // Let the initial data change notifications settle
+    QTest::qWait(1000);
+
+    const ProcessStatistics connected = processStatistics();
+
+    QElapsedTimer wallClock;
+    wallClock.start();
+    QTest::qWait(measurementDuration);
+    const ProcessStatistics after = processStatistics();
+    const double elapsedSeconds = wallClock.elapsed() / 1000.0;
+
+    const double contextSwitchesPerSecond = (after.contextSwitches - connected.contextSwitches) / elapsedSeconds;
+
+    if (before.residentBytes >= 0 && connected.residentBytes >= 0) {
+        qDebug("%s: %d clients, %.1f KiB resident memory per client, %d threads",
+               qPrintable(backend), numberOfClients,
+               (connected.residentBytes - before.residentBytes) / 1024.0 / numberOfClients, connected.threads);
+    }
+    qDebug("%s: %d clients, %.0f context switches per second (%.2f per client)",
+           qPrintable(backend), numberOfClients, contextSwitchesPerSecond, contextSwitchesPerSecond / numberOfClients);
+    QTest::setBenchmarkResult(contextSwitchesPerSecond, QTest::Events);
+
+    // Each read is sent when the previous one has been answered, a backend which blocks
+    // its thread delays the reads of all clients sharing the thread
+    QElapsedTimer latencyClock;
+    latencyClock.start();
+    QVector<qint64> latencies;
+    latencies.reserve(nodes.size() * readsPerClient);
+    QVector<qint64> readStarted(nodes.size());
+    QVector<int> readsLeft(nodes.size(), readsPerClient);
+    int finishedClients = 0;
+    QVector<QMetaObject::Connection> connections;
+
+    for (int i = 0; i < nodes.size(); ++i) {
+        QOpcUaNode *node = nodes.at(i);
+        connections.push_back(QObject::connect(node, &QOpcUaNode::attributeRead, this,
+                                               [&, i, node]() {
+            latencies.push_back(latencyClock.nsecsElapsed() - readStarted.at(i));
+            if (--readsLeft[i] == 0) {
+                ++finishedClients;
+                return;
+            }
+            readStarted[i] = latencyClock.nsecsElapsed();
+            node->readAttributes(QOpcUa::NodeAttribute::Value);
+        }));
+    }
+
+    for (int i = 0; i < nodes.size(); ++i) {
+        readStarted[i] = latencyClock.nsecsElapsed();
+        QVERIFY(nodes.at(i)->readAttributes(QOpcUa::NodeAttribute::Value));
+    }
+    QTRY_COMPARE_WITH_TIMEOUT(finishedClients, nodes.size(), 120000);
+
+    for (const QMetaObject::Connection &connection : qAsConst(connections))
+        QObject::disconnect(connection);
+
+    std::sort(latencies.begin(), latencies.end());
+    qDebug("%s: %d clients, read latency median %.2f ms, 99th percentile %.2f ms, maximum %.2f ms",
+           qPrintable(backend), numberOfClients,
+           latencies.at(latencies.size() / 2) / 1e6,
+           latencies.at(latencies.size() * 99 / 100) / 1e6,
+           latencies.last() / 1e6);
+
+    qDeleteAll(nodes);
+    for (QOpcUaClient *client : qAsConst(clients)) {
+        client->disconnectFromEndpoint();
+        QTRY_VERIFY_WITH_TIMEOUT(client->state() == QOpcUaClient::Disconnected, 60000);
+        delete client;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QTEST_SET_MAIN_SOURCE_PATH
+
+    if (QOpcUaProvider::availableBackends().empty()) {
+        qDebug("No OPCUA backends found, skipping benchmarks.");
+        return EXIT_SUCCESS;
+    }
+
+    Tst_BenchClientScaling tc;
+    return QTest::qExec(&tc, argc, argv);
+}
+
+#include "tst_bench_clientscaling.moc"
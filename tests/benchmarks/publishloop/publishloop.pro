@@ -0,0 +1,7 @@
+TARGET = tst_bench_publishloop
+
+QT += testlib opcua
+CONFIG += benchmark
+
+SOURCES += \
+    tst_bench_publishloop.cpp
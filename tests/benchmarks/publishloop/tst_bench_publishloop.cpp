@@ -0,0 +1,206 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtOpcUa/QOpcUaClient>
+#include <QtOpcUa/QOpcUaNode>
+#include <QtOpcUa/QOpcUaProvider>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QProcess>
+
+#include <QtTest/QSignalSpy>
+#include <QtTest/QtTest>
+
+#include <ctime>
+
+const QString monitoredNode = QStringLiteral("ns=2;s=Demo.Static.Scalar.Double");
+const int measurementDuration = 5000; // ms
+
+class Tst_BenchPublishLoop: public QObject
+{
+    Q_OBJECT
+
+public:
+    Tst_BenchPublishLoop();
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void idleCpuPerSubscribedClient_data();
+    void idleCpuPerSubscribedClient();
+
+private:
+    QString envOrDefault(const char *env, QString def)
+    {
+        return qEnvironmentVariableIsSet(env) ? qgetenv(env).constData() : def;
+    }
+
+    QString m_endpoint;
+    QOpcUaProvider m_opcUa;
+    QStringList m_backends;
+    QProcess m_serverProcess;
+};
+
+Tst_BenchPublishLoop::Tst_BenchPublishLoop()
+{
+    m_backends = QOpcUaProvider::availableBackends();
+}
+
+void Tst_BenchPublishLoop::initTestCase()
+{
+    if (qEnvironmentVariableIsEmpty("OPCUA_HOST") && qEnvironmentVariableIsEmpty("OPCUA_PORT")) {
+        const QString testServerPath = qApp->applicationDirPath()
+#ifdef Q_OS_WIN
+                                     + QLatin1String("/..")
+#endif
+                                     + QLatin1String("/../../open62541-testserver/open62541-testserver")
+#ifdef Q_OS_WIN
+                                     + QLatin1String(".exe")
+#endif
+                ;
+        if (!QFile::exists(testServerPath)) {
+            qDebug() << "Server Path:" << testServerPath;
+            QSKIP("all benchmarks rely on an open62541-based test-server");
+        }
+
+        m_serverProcess.start(testServerPath);
+        QVERIFY2(m_serverProcess.waitForStarted(), qPrintable(m_serverProcess.errorString()));
+        // Let the server come up
+        QTest::qSleep(2000);
+    }
+    QString host = envOrDefault("OPCUA_HOST", "localhost");
+    QString port = envOrDefault("OPCUA_PORT", "43344");
+    m_endpoint = QString("opc.tcp://%1:%2").arg(host).arg(port);
+    qDebug() << "Using endpoint:" << m_endpoint;
+}
+
+void Tst_BenchPublishLoop::cleanupTestCase()
+{
+    if (m_serverProcess.state() == QProcess::Running) {
+        m_serverProcess.kill();
+        m_serverProcess.waitForFinished(2000);
+    }
+}
+
+void Tst_BenchPublishLoop::idleCpuPerSubscribedClient_data()
+{
+    QTest::addColumn<QString>("backend");
+    QTest::addColumn<int>("numberOfClients");
+
+    for (const QString &backend : qAsConst(m_backends)) {
+        for (int clients : {1, 10, 40}) {
+            const QByteArray name = QStringLiteral("%1 %2 clients").arg(backend).arg(clients).toLatin1();
+            QTest::newRow(name.constData()) << backend << clients;
+        }
+    }
+}
+
+// Measures the process CPU time used while every client has one active
+// subscription on a value which doesn't change. Only keep-alives are received,
+// so the result should be close to zero and must not grow with the poll rate.
+void Tst_BenchPublishLoop::idleCpuPerSubscribedClient()
+{
+    QFETCH(QString, backend);
+    QFETCH(int, numberOfClients);
+
+    QVector<QOpcUaClient *> clients;
+    QVector<QOpcUaNode *> nodes;
+
+    for (int i = 0; i < numberOfClients; ++i) {
+        QOpcUaClient *client = m_opcUa.createClient(backend);
+        QVERIFY(client != nullptr);
+        client->setParent(this);
+        clients.push_back(client);
+        client->connectToEndpoint(QUrl(m_endpoint));
+    }
+
+    for (QOpcUaClient *client : qAsConst(clients)) {
+        QTRY_VERIFY2(client->state() == QOpcUaClient::Connected, "Could not connect to server");
+        QOpcUaNode *node = client->node(monitoredNode);
+        QVERIFY(node != nullptr);
+        nodes.push_back(node);
+
+        QSignalSpy monitoringEnabledSpy(node, &QOpcUaNode::enableMonitoringFinished);
+        node->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+        QVERIFY(monitoringEnabledSpy.wait());
+        QCOMPARE(monitoringEnabledSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    }
+
+    // Let the initial data change notifications settle
+    QTest::qWait(1000);
+
+    QElapsedTimer wallClock;
+    wallClock.start();
+    const std::clock_t cpuStart = std::clock();
+
+    QTest::qWait(measurementDuration);
+
+    const std::clock_t cpuEnd = std::clock();
+    const double elapsedSeconds = wallClock.elapsed() / 1000.0;
+    const double cpuMsecs = 1000.0 * (cpuEnd - cpuStart) / CLOCKS_PER_SEC;
+    const double cpuMsecsPerClientAndSecond = cpuMsecs / numberOfClients / elapsedSeconds;
+
+    qDebug("%s: %d clients, %.2f ms CPU time per client and second (%.1f %% of one core in total)",
+           qPrintable(backend), numberOfClients, cpuMsecsPerClientAndSecond, cpuMsecs / elapsedSeconds / 10.0);
+    // QtTest has no metric for CPU time, the reported value is CPU milliseconds per client and second
+    QTest::setBenchmarkResult(cpuMsecsPerClientAndSecond, QTest::WalltimeMilliseconds);
+
+    qDeleteAll(nodes);
+    for (QOpcUaClient *client : qAsConst(clients)) {
+        client->disconnectFromEndpoint();
+        QTRY_VERIFY(client->state() == QOpcUaClient::Disconnected);
+        delete client;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QTEST_SET_MAIN_SOURCE_PATH
+
+    if (QOpcUaProvider::availableBackends().empty()) {
+        qDebug("No OPCUA backends found, skipping benchmarks.");
+        return EXIT_SUCCESS;
+    }
+
+    Tst_BenchPublishLoop tc;
+    return QTest::qExec(&tc, argc, argv);
+}
+
+#include "tst_bench_publishloop.moc"
@@ -39,15 +39,62 @@
 #include <QtCore/QCoreApplication>
 #include <QtCore/QDebug>
 #include <QtCore/QThread>
+#include <QtCore/QTimer>
 #include <QtCore/QVariant>
 #include <QUuid>
 
+// Address space used by tests/benchmarks. It is only created if the server is started
+// with --benchmark because the large tree slows down the startup.
+static const int benchmarkVariableCount = 100;
+static const int benchmarkTreeBranches = 100;
+static const int benchmarkTreeLeavesPerBranch = 1000;
+static const int benchmarkUpdateInterval = 10; // ms
+
+static void addBenchmarkNodes(TestServer &server, int namespaceIndex, QObject *parent)
+{
+    const UA_NodeId benchFolder = server.addFolder("ns=3;s=Bench", "Bench");
+
+    // Values which change every benchmarkUpdateInterval for the data change notification benchmarks
+    QVector<UA_NodeId> changingValues;
+    for (int i = 0; i < benchmarkVariableCount; ++i) {
+        changingValues.push_back(server.addVariable(benchFolder, QStringLiteral("ns=3;s=Bench.Value.%1").arg(i),
+                                                    QStringLiteral("Bench.Value.%1").arg(i), 0.0, QOpcUa::Types::Double));
+        server.addVariable(benchFolder, QStringLiteral("ns=3;s=Bench.Write.%1").arg(i),
+                           QStringLiteral("Bench.Write.%1").arg(i), 0.0, QOpcUa::Types::Double);
+    }
+
+    QTimer *updateTimer = new QTimer(parent);
+    QObject::connect(updateTimer, &QTimer::timeout, [&server, changingValues]() {
+        static double value = 0;
+        value += 1;
+        UA_Variant variant;
+        UA_Variant_setScalar(&variant, &value, &UA_TYPES[UA_TYPES_DOUBLE]);
+        for (const UA_NodeId &id : changingValues)
+            UA_Server_writeValue(server.m_server, id, variant);
+    });
+    updateTimer->start(benchmarkUpdateInterval);
+
+    // Objects organized in branches for the browse benchmarks
+    const UA_NodeId treeFolder = server.addFolder("ns=3;s=Bench.Tree", "Bench.Tree");
+    for (int i = 0; i < benchmarkTreeBranches; ++i) {
+        const UA_NodeId branch = server.addObject(treeFolder, namespaceIndex);
+        for (int j = 0; j < benchmarkTreeLeavesPerBranch; ++j)
+            server.addObject(branch, namespaceIndex);
+    }
+}
+
 int main(int argc, char **argv)
 {
     QCoreApplication app(argc, argv);
 
+    // Several servers can run side by side with --port <port>
+    quint16 port = 43344;
+    const int portIndex = app.arguments().indexOf(QLatin1String("--port"));
+    if (portIndex > 0 && portIndex + 1 < app.arguments().size())
+        port = app.arguments().at(portIndex + 1).toUShort();
+
     TestServer server;
-    if (!server.init()) {
+    if (!server.init(port)) {
         qCritical() << "Could not initialize server.";
         return -1;
     }
@@ -158,5 +205,8 @@ int main(int argc, char **argv)
 
     server.addEmptyArrayVariable(testFolder, "ns=2;s=EmptyBoolArray", "EmptyBoolArrayTest");
 
+    if (app.arguments().contains(QLatin1String("--benchmark")))
+        addBenchmarkNodes(server, ns2, &app);
+
     return app.exec();
 }
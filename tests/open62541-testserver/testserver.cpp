@@ -65,9 +65,9 @@ TestServer::~TestServer()
     UA_ServerConfig_delete(m_config);
 }
 
-bool TestServer::init()
+bool TestServer::init(quint16 port)
 {
-    m_config = UA_ServerConfig_new_minimal(43344, NULL);
+    m_config = UA_ServerConfig_new_minimal(port, NULL);
     if (!m_config)
         return false;
 
@@ -53,7 +53,7 @@ class TestServer : public QObject
 public:
     explicit TestServer(QObject *parent = nullptr);
     ~TestServer();
-    bool init();
+    bool init(quint16 port = 43344);
 
     int registerNamespace(const QString &ns);
     UA_NodeId addFolder(const QString &nodeString, const QString &displayName, const QString &description = QString());